@@ -0,0 +1,68 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm/string/search/aho_corasick.h>
+
+/*
+ * Match many keywords in a document, by one pass of Aho-Corasick or a pass per keyword.
+ */
+std::string get_random_word(std::mt19937_64 &rander, size_t size) {
+	std::string word(size, 'a');
+	for (auto &c: word) { c = static_cast<char>(rander() % 26 + 'a'); }
+	return word;
+}
+
+struct KeywordDocument {
+	std::vector<std::string> keyword_array;
+	std::string              document;
+
+	KeywordDocument(size_t keyword_amount, size_t document_size) {
+		std::mt19937_64 rander(keyword_amount);
+		for (size_t idx = 0; idx < keyword_amount; ++idx) { keyword_array.push_back(get_random_word(rander, rander() % 8 + 4)); }
+		while (document.size() < document_size) {
+			document += (rander() % 16 == 0) ? keyword_array[rander() % keyword_amount] : get_random_word(rander, rander() % 8 + 1);
+			document += ' ';
+		}
+	}
+};
+
+void aho_corasick(benchmark::State &state) {
+	const KeywordDocument data(state.range(0), 1 << 20);
+	const algorithm::AhoCorasick<char> matcher{data.keyword_array};
+
+	for (auto _: state) {
+		size_t match_amount = 0;
+		matcher.find_all(data.document.begin(), data.document.end(), [&match_amount](size_t, size_t) { ++match_amount; });
+		benchmark::DoNotOptimize(match_amount);
+	}
+	state.SetBytesProcessed(state.iterations() * data.document.size());
+}
+
+void string_view_find_per_keyword(benchmark::State &state) {
+	const KeywordDocument data(state.range(0), 1 << 20);
+	const std::string_view document{data.document};
+
+	for (auto _: state) {
+		size_t match_amount = 0;
+		for (const auto &keyword: data.keyword_array) {
+			for (size_t pos = document.find(keyword); pos != document.npos; pos = document.find(keyword, pos + 1)) { ++match_amount; }
+		}
+		benchmark::DoNotOptimize(match_amount);
+	}
+	state.SetBytesProcessed(state.iterations() * data.document.size());
+}
+
+BENCHMARK(aho_corasick)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(string_view_find_per_keyword)->RangeMultiplier(10)->Range(10, 1000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
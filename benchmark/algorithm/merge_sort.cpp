@@ -0,0 +1,82 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm/sort/merge_sort.h>
+
+const std::vector<uint64_t> &get_random_keys(size_t size) {
+	static std::vector<uint64_t> key_array;
+	if (key_array.size() != size) {
+		std::mt19937_64 rander(size);
+		key_array.resize(size);
+		for (auto &key: key_array) { key = rander(); }
+	}
+	return key_array;
+}
+
+template<class SortFunc>
+void sort_keys(benchmark::State &state, SortFunc &&sort_func) {
+	const std::vector<uint64_t> &key_array = get_random_keys(state.range(0));
+	std::vector<uint64_t> test_array(key_array.size());
+
+	for (auto _: state) {
+		state.PauseTiming();
+		std::copy(key_array.begin(), key_array.end(), test_array.begin());
+		state.ResumeTiming();
+
+		sort_func(test_array);
+		benchmark::DoNotOptimize(test_array.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void std_stable_sort(benchmark::State &state) {
+	sort_keys(state, [](auto &array) { std::stable_sort(array.begin(), array.end()); });
+}
+
+void merge_sort(benchmark::State &state) {
+	sort_keys(state, [](auto &array) { algorithm::merge_sort(array.begin(), array.end()); });
+}
+
+void parallel_merge_sort(benchmark::State &state) {
+	sort_keys(state, [](auto &array) { algorithm::parallel_merge_sort(array.begin(), array.end()); });
+}
+
+/*
+ * Merge sorted runs of equal length, as segments of an external sort.
+ */
+void kway_merge(benchmark::State &state) {
+	using Iterator = std::vector<uint64_t>::const_iterator;
+
+	const size_t run_amount = state.range(0);
+	std::vector<uint64_t> key_array = get_random_keys(1 << 22);
+	const size_t run_size = key_array.size() / run_amount;
+
+	std::vector<std::pair<Iterator, Iterator>> range_array;
+	for (size_t run_idx = 0; run_idx < run_amount; ++run_idx) {
+		std::sort(key_array.begin() + run_idx * run_size, key_array.begin() + (run_idx + 1) * run_size);
+		range_array.emplace_back(key_array.cbegin() + run_idx * run_size, key_array.cbegin() + (run_idx + 1) * run_size);
+	}
+
+	std::vector<uint64_t> output_array(run_size * run_amount);
+	for (auto _: state) {
+		algorithm::kway_merge(range_array, output_array.begin());
+		benchmark::DoNotOptimize(output_array.data());
+	}
+	state.SetItemsProcessed(state.iterations() * output_array.size());
+}
+
+BENCHMARK(std_stable_sort)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(merge_sort)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(parallel_merge_sort)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(kway_merge)->RangeMultiplier(4)->Range(4, 1024)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
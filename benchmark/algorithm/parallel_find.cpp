@@ -0,0 +1,100 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+#include <file/file_descriptor.h>
+#include <algorithm/string/search.h>
+
+/*
+ * Grep a mapped log-like file for a pattern appearing every 1 MiB.
+ */
+
+constexpr size_t TEXT_FILE_SIZE = 64 * 1024 * 1024;
+
+const std::string PATTERN = "ERROR upstream=db timeout=5000ms";
+
+std::string write_text_file() {
+	const std::string path = (std::filesystem::temp_directory_path() / ("parallel_find_bench_" + std::to_string(getpid()))).string();
+	const std::string_view word_array[] = {
+		"INFO ", "WARN ", "request ", "served ", "in ", "ms ", "user=", "id=", "path=/api/v1/", "status=200 ", "\n"
+	};
+	std::mt19937_64 rander(TEXT_FILE_SIZE);
+	std::string text;
+	while (text.size() < TEXT_FILE_SIZE) {
+		text += word_array[rander() % std::size(word_array)];
+		text += std::to_string(rander() % 1000);
+	}
+	text.resize(TEXT_FILE_SIZE);
+	for (size_t pos = 1024 * 1024 - PATTERN.size(); pos < text.size(); pos += 1024 * 1024) {
+		text.replace(pos, PATTERN.size(), PATTERN);
+	}
+	std::ofstream(path, std::ios::binary).write(text.data(), static_cast<std::streamsize>(text.size()));
+	return path;
+}
+
+struct TextFile {
+	std::string path;
+
+	algorithm::file::FileDescriptor descriptor;
+
+	algorithm::file::FileMapper mapper;
+
+	TextFile(): path(write_text_file()),
+	            descriptor(path, algorithm::file::FileOpenType::ReadOnly),
+	            mapper(descriptor.get_mapper(algorithm::file::FileMmapProt::Readable, algorithm::file::FileMmapFlag::Private)) {}
+
+	~TextFile() {
+		std::filesystem::remove(path);
+	}
+};
+
+const algorithm::file::FileMapper &get_mapper() {
+	static TextFile text_file;
+	return text_file.mapper;
+}
+
+std::span<const uint8_t> get_pattern() {
+	return {reinterpret_cast<const uint8_t *>(PATTERN.data()), PATTERN.size()};
+}
+
+void simd_find_all(benchmark::State &state) {
+	const std::span<const uint8_t> base = get_mapper().get_map_area();
+	const algorithm::string::SIMDSearcher<uint8_t> searcher{get_pattern().begin(), get_pattern().end()};
+
+	for (auto _: state) {
+		size_t amount = 0;
+		for (const uint8_t *ptr = base.data(); ptr < base.data() + base.size(); ++ptr) {
+			ptr = searcher.find(ptr, base.data() + base.size());
+			if (ptr == base.data() + base.size()) { break; }
+			++amount;
+		}
+		benchmark::DoNotOptimize(amount);
+	}
+	state.SetBytesProcessed(state.iterations() * TEXT_FILE_SIZE);
+}
+
+void parallel_find_all(benchmark::State &state) {
+	const auto &mapper = get_mapper();
+
+	for (auto _: state) {
+		benchmark::DoNotOptimize(algorithm::string::parallel_find_all(mapper, get_pattern(), state.range(0)));
+	}
+	state.SetBytesProcessed(state.iterations() * TEXT_FILE_SIZE);
+}
+
+BENCHMARK(simd_find_all);
+BENCHMARK(parallel_find_all)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
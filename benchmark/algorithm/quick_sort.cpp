@@ -0,0 +1,73 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+#ifdef ALGORITHM_BENCHMARK_PARALLEL_STL
+#include <execution>
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm/sort/quick_sort.h>
+
+/*
+ * Uniform random keys, shared by all cases of the same size.
+ */
+const std::vector<uint32_t> &get_random_keys(size_t size) {
+	static std::vector<uint32_t> key_array;
+	if (key_array.size() != size) {
+		std::mt19937 rander(size);
+		key_array.resize(size);
+		for (auto &key: key_array) { key = rander(); }
+	}
+	return key_array;
+}
+
+template<class SortFunc>
+void sort_keys(benchmark::State &state, SortFunc &&sort_func) {
+	const std::vector<uint32_t> &key_array = get_random_keys(state.range(0));
+	std::vector<uint32_t> test_array(key_array.size());
+
+	for (auto _: state) {
+		state.PauseTiming();
+		std::copy(key_array.begin(), key_array.end(), test_array.begin());
+		state.ResumeTiming();
+
+		sort_func(test_array);
+		benchmark::DoNotOptimize(test_array.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void std_sort(benchmark::State &state) {
+	sort_keys(state, [](auto &array) { std::sort(array.begin(), array.end()); });
+}
+
+#ifdef ALGORITHM_BENCHMARK_PARALLEL_STL
+void std_sort_par(benchmark::State &state) {
+	sort_keys(state, [](auto &array) { std::sort(std::execution::par, array.begin(), array.end()); });
+}
+#endif
+
+void quick_sort(benchmark::State &state) {
+	sort_keys(state, [](auto &array) { algorithm::quick_sort(array.begin(), array.end()); });
+}
+
+void parallel_quick_sort(benchmark::State &state) {
+	sort_keys(state, [](auto &array) { algorithm::parallel_quick_sort(array.begin(), array.end()); });
+}
+
+BENCHMARK(std_sort)->RangeMultiplier(10)->Range(1'000'000, 1'000'000'000)->Unit(benchmark::kMillisecond);
+#ifdef ALGORITHM_BENCHMARK_PARALLEL_STL
+BENCHMARK(std_sort_par)->RangeMultiplier(10)->Range(1'000'000, 1'000'000'000)->Unit(benchmark::kMillisecond)->UseRealTime();
+#endif
+BENCHMARK(quick_sort)->RangeMultiplier(10)->Range(1'000'000, 1'000'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(parallel_quick_sort)->RangeMultiplier(10)->Range(1'000'000, 1'000'000'000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
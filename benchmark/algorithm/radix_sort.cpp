@@ -0,0 +1,98 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm/sort/quick_sort.h>
+#include <algorithm/sort/radix_sort.h>
+
+template<class T>
+const std::vector<T> &get_random_keys(size_t size) {
+	static std::vector<T> key_array;
+	if (key_array.size() != size) {
+		std::mt19937_64 rander(size);
+		key_array.resize(size);
+		for (auto &key: key_array) { key = static_cast<T>(rander()); }
+	}
+	return key_array;
+}
+
+template<class T, class SortFunc>
+void sort_keys(benchmark::State &state, SortFunc &&sort_func) {
+	const std::vector<T> &key_array = get_random_keys<T>(state.range(0));
+	std::vector<T> test_array(key_array.size());
+
+	for (auto _: state) {
+		state.PauseTiming();
+		std::copy(key_array.begin(), key_array.end(), test_array.begin());
+		state.ResumeTiming();
+
+		sort_func(test_array);
+		benchmark::DoNotOptimize(test_array.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class T>
+void quick_sort(benchmark::State &state) {
+	sort_keys<T>(state, [](auto &array) { algorithm::quick_sort(array.begin(), array.end()); });
+}
+
+template<class T, size_t DIGIT_BITS>
+void radix_sort(benchmark::State &state) {
+	sort_keys<T>(state, [](auto &array) { algorithm::radix_sort<DIGIT_BITS>(array.begin(), array.end()); });
+}
+
+template<class T, size_t DIGIT_BITS>
+void parallel_radix_sort(benchmark::State &state) {
+	sort_keys<T>(state, [](auto &array) { algorithm::parallel_radix_sort<DIGIT_BITS>(array.begin(), array.end()); });
+}
+
+/*
+ * Fixed-width keys of 16 bytes, drawn from a small alphabet
+ */
+template<bool RADIX>
+void sort_string(benchmark::State &state) {
+	std::vector<std::string> key_array(state.range(0));
+	std::mt19937 rander(state.range(0));
+	for (auto &key: key_array) {
+		for (size_t i = 0; i < 16; ++i) { key.push_back(static_cast<char>('a' + rander() % 16)); }
+	}
+
+	std::vector<std::string> test_array(key_array.size());
+	for (auto _: state) {
+		state.PauseTiming();
+		std::copy(key_array.begin(), key_array.end(), test_array.begin());
+		state.ResumeTiming();
+
+		if constexpr (RADIX) { algorithm::msd_radix_sort(test_array.begin(), test_array.end()); }
+		else                 { algorithm::quick_sort(test_array.begin(), test_array.end()); }
+		benchmark::DoNotOptimize(test_array.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(quick_sort<uint32_t>)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(radix_sort<uint32_t, 8>)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(radix_sort<uint32_t, 11>)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(radix_sort<uint32_t, 16>)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(parallel_radix_sort<uint32_t, 8>)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK(quick_sort<uint64_t>)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(radix_sort<uint64_t, 8>)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(radix_sort<uint64_t, 11>)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(radix_sort<uint64_t, 16>)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(parallel_radix_sort<uint64_t, 11>)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK(sort_string<false>)->RangeMultiplier(10)->Range(100'000, 10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(sort_string<true>)->RangeMultiplier(10)->Range(100'000, 10'000'000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,86 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm/simd/search.h>
+
+/*
+ * Scan unsorted ids for an id placed at the end, so that the whole array is read.
+ */
+template<class T>
+std::vector<T> get_random_ids(size_t size) {
+	std::vector<T> id_array(size);
+	std::mt19937_64 rander(size);
+	for (auto &id: id_array) { id = static_cast<T>(rander() % 100 + 1); }
+	id_array.back() = 0;
+	return id_array;
+}
+
+template<class T>
+void std_find(benchmark::State &state) {
+	const std::vector<T> id_array = get_random_ids<T>(state.range(0));
+	for (auto _: state) {
+		benchmark::DoNotOptimize(std::find(id_array.begin(), id_array.end(), T(0)));
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template<class T>
+void simd_find(benchmark::State &state) {
+	const std::vector<T> id_array = get_random_ids<T>(state.range(0));
+	for (auto _: state) {
+		benchmark::DoNotOptimize(algorithm::simd::find(id_array.data(), id_array.size(), T(0)));
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template<class T>
+void std_count(benchmark::State &state) {
+	const std::vector<T> id_array = get_random_ids<T>(state.range(0));
+	for (auto _: state) {
+		benchmark::DoNotOptimize(std::count(id_array.begin(), id_array.end(), T(1)));
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template<class T>
+void simd_count(benchmark::State &state) {
+	const std::vector<T> id_array = get_random_ids<T>(state.range(0));
+	for (auto _: state) {
+		benchmark::DoNotOptimize(algorithm::simd::count(id_array.data(), id_array.size(), T(1)));
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template<class T>
+void simd_find_if_less(benchmark::State &state) {
+	const std::vector<T> id_array = get_random_ids<T>(state.range(0));
+	std::vector<uint64_t> mask_array(algorithm::simd::bit_mask_size(id_array.size()));
+	for (auto _: state) {
+		benchmark::DoNotOptimize(algorithm::simd::find_if_less(id_array.data(), id_array.size(), T(10), mask_array.data()));
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+BENCHMARK(std_find<uint8_t>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(simd_find<uint8_t>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(std_find<int32_t>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(simd_find<int32_t>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(std_find<uint64_t>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(simd_find<uint64_t>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(std_find<float>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(simd_find<float>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+
+BENCHMARK(std_count<int32_t>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(simd_count<int32_t>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(simd_find_if_less<int32_t>)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,77 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm/simd/sort.h>
+#include <algorithm/sort/insert_sort.h>
+#include <algorithm/sort/quick_sort.h>
+
+template<class T>
+std::vector<T> get_random_values(size_t size) {
+	std::vector<T> value_array(size);
+	std::mt19937_64 rander(size);
+	for (auto &value: value_array) { value = static_cast<T>(static_cast<int64_t>(rander())); }
+	return value_array;
+}
+
+/*
+ * Sort many small arrays, as the leaves of quick sort do.
+ */
+template<class T, bool NETWORK>
+void sort_small(benchmark::State &state) {
+	const size_t size = state.range(0);
+	const std::vector<T> value_array = get_random_values<T>(size * 1024);
+	std::vector<T> test_array(value_array.size());
+
+	for (auto _: state) {
+		state.PauseTiming();
+		std::copy(value_array.begin(), value_array.end(), test_array.begin());
+		state.ResumeTiming();
+
+		for (size_t start = 0; start < test_array.size(); start += size) {
+			if constexpr (NETWORK) { algorithm::simd::sort_network(test_array.data() + start, size); }
+			else                   { algorithm::insert_sort(test_array.data() + start, test_array.data() + start + size); }
+		}
+		benchmark::DoNotOptimize(test_array.data());
+	}
+	state.SetItemsProcessed(state.iterations() * value_array.size());
+}
+
+template<class T, bool SIMD>
+void sort_large(benchmark::State &state) {
+	const std::vector<T> value_array = get_random_values<T>(state.range(0));
+	std::vector<T> test_array(value_array.size());
+
+	for (auto _: state) {
+		state.PauseTiming();
+		std::copy(value_array.begin(), value_array.end(), test_array.begin());
+		state.ResumeTiming();
+
+		if constexpr (SIMD) { algorithm::quick_sort(test_array.begin(), test_array.end()); }
+		else                { std::sort(test_array.begin(), test_array.end()); }
+		benchmark::DoNotOptimize(test_array.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(sort_small<int32_t, false>)->Arg(16)->Arg(64);
+BENCHMARK(sort_small<int32_t, true>)->Arg(16)->Arg(64);
+BENCHMARK(sort_small<int64_t, false>)->Arg(16)->Arg(64);
+BENCHMARK(sort_small<int64_t, true>)->Arg(16)->Arg(64);
+
+BENCHMARK(sort_large<int32_t, false>)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(sort_large<int32_t, true>)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(sort_large<int64_t, false>)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(sort_large<int64_t, true>)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(sort_large<float, false>)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(sort_large<float, true>)->RangeMultiplier(10)->Range(1'000'000, 100'000'000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,80 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <functional>
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm/string/search.h>
+
+/*
+ * Grep a log-like text for a pattern appearing only at the end.
+ */
+const std::string &get_log_text(size_t size) {
+	static std::string text;
+	if (text.size() != size) {
+		const std::string_view word_array[] = {
+			"INFO ", "WARN ", "request ", "served ", "in ", "ms ", "user=", "id=", "path=/api/v1/", "status=200 ", "\n"
+		};
+		std::mt19937_64 rander(size);
+		text.clear();
+		while (text.size() < size) {
+			text += word_array[rander() % std::size(word_array)];
+			text += std::to_string(rander() % 1000);
+		}
+		text.resize(size);
+	}
+	return text;
+}
+
+template<class FindFunc>
+void find_pattern(benchmark::State &state, FindFunc &&find_func) {
+	std::string text = get_log_text(state.range(0));
+	const std::string pattern = std::string("ERROR upstream=db timeout=5000ms").substr(0, state.range(1));
+	std::copy(pattern.begin(), pattern.end(), text.end() - pattern.size());
+
+	for (auto _: state) {
+		benchmark::DoNotOptimize(find_func(std::string_view{text}, std::string_view{pattern}));
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void string_view_find(benchmark::State &state) {
+	find_pattern(state, [](std::string_view text, std::string_view pattern) {
+		return text.find(pattern);
+	});
+}
+
+void std_horspool_searcher(benchmark::State &state) {
+	find_pattern(state, [](std::string_view text, std::string_view pattern) {
+		return std::search(text.begin(), text.end(), std::boyer_moore_horspool_searcher(pattern.begin(), pattern.end()));
+	});
+}
+
+void horspool_find(benchmark::State &state) {
+	find_pattern(state, [](std::string_view text, std::string_view pattern) {
+		return algorithm::string::horspool_find(pattern.begin(), pattern.end(), text.begin(), text.end());
+	});
+}
+
+void simd_find(benchmark::State &state) {
+	find_pattern(state, [](std::string_view text, std::string_view pattern) {
+		return algorithm::string::simd_find(pattern.begin(), pattern.end(), text.begin(), text.end());
+	});
+}
+
+#define STRING_FIND_ARGS ArgsProduct({{1 << 12, 1 << 20, 1 << 24}, {4, 12, 31}})
+
+BENCHMARK(string_view_find)->STRING_FIND_ARGS;
+BENCHMARK(std_horspool_searcher)->STRING_FIND_ARGS;
+BENCHMARK(horspool_find)->STRING_FIND_ARGS;
+BENCHMARK(simd_find)->STRING_FIND_ARGS;
+
+BENCHMARK_MAIN();
@@ -0,0 +1,59 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstddef>
+
+#include <benchmark/benchmark.h>
+
+#include <allocator/allocator.h>
+#include <structure/list/list.h>
+
+/*
+ * Build a list of the given length and throw it away, as a request-scoped workload does.
+ */
+template<class Allocator>
+void build_list(benchmark::State &state) {
+	using List = algorithm::structure::List<size_t, Allocator>;
+
+	for (auto _: state) {
+		List list;
+		for (size_t i = state.range(0); i != 0; --i) {
+			list.push_back(i);
+		}
+		benchmark::DoNotOptimize(list);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/*
+ * The arena is reset after each list, which releases all nodes at once.
+ */
+void build_list_arena(benchmark::State &state) {
+	using Allocator = algorithm::allocator::ArenaAllocator<size_t>;
+	using List      = algorithm::structure::List<size_t, Allocator>;
+
+	algorithm::allocator::Arena arena;
+	algorithm::allocator::ArenaScope scope(arena);
+	for (auto _: state) {
+		{
+			List list;
+			for (size_t i = state.range(0); i != 0; --i) {
+				list.push_back(i);
+			}
+			benchmark::DoNotOptimize(list);
+		}
+		arena.reset();
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(build_list, algorithm::allocator::SimpleAllocator<size_t>)
+        ->RangeMultiplier(10)->Range(10, 100000);
+BENCHMARK_TEMPLATE(build_list, algorithm::allocator::ReserveAllocator<size_t>)
+        ->RangeMultiplier(10)->Range(10, 100000);
+BENCHMARK(build_list_arena)
+        ->RangeMultiplier(10)->Range(10, 100000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,157 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstddef>
+#include <cstdlib>
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <vector>
+
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+#include <allocator/allocator.h>
+
+namespace {
+
+	constexpr size_t BATCH_SIZE     = 256;
+	constexpr size_t MAX_BATCH_HOLD = 64;
+	constexpr size_t MAX_PAIR       = 8;
+
+	struct MallocStrategy {
+		static void *allocate(size_t size) { return std::malloc(size); }
+
+		static void deallocate(void *ptr, size_t) { std::free(ptr); }
+	};
+
+	struct ReservePoolStrategy {
+		static void *allocate(size_t size) {
+			return algorithm::allocator::get_thread_allocator_pool().allocate(size);
+		}
+
+		static void deallocate(void *ptr, size_t size) {
+			algorithm::allocator::get_thread_allocator_pool().deallocate(ptr, size);
+		}
+	};
+
+	/// Bounded queue handing batches of pointers from a producer to a consumer
+	class BatchQueue {
+	private:
+		std::mutex mutex_;
+		std::condition_variable not_empty_;
+		std::condition_variable not_full_;
+		std::deque<std::vector<void *>> batch_queue_;
+
+	public:
+		void push(std::vector<void *> &&batch) {
+			std::unique_lock lock(mutex_);
+			not_full_.wait(lock, [this] { return batch_queue_.size() < MAX_BATCH_HOLD; });
+			batch_queue_.emplace_back(std::move(batch));
+			not_empty_.notify_one();
+		}
+
+		std::vector<void *> pop() {
+			std::unique_lock lock(mutex_);
+			not_empty_.wait(lock, [this] { return !batch_queue_.empty(); });
+			std::vector<void *> batch = std::move(batch_queue_.front());
+			batch_queue_.pop_front();
+			not_full_.notify_one();
+			return batch;
+		}
+	};
+
+	std::array<BatchQueue, MAX_PAIR> batch_queue_array;
+
+	size_t resident_set_size() {
+		size_t total_page = 0, resident_page = 0;
+		std::ifstream statm("/proc/self/statm");
+		statm >> total_page >> resident_page;
+		return resident_page * sysconf(_SC_PAGESIZE);
+	}
+}
+
+/*
+ * Threads are paired as producer (even index) and consumer (odd index),
+ * so that every chunk is released by a thread other than its allocator.
+ */
+template<class Strategy>
+void producer_consumer(benchmark::State &state) {
+	const size_t alloc_size = state.range(0);
+	const bool   producer   = (state.thread_index() % 2 == 0);
+	BatchQueue &batch_queue = batch_queue_array[state.thread_index() / 2];
+
+	for (auto _: state) {
+		if (producer) {
+			std::vector<void *> batch(BATCH_SIZE);
+			for (void *&ptr: batch) {
+				ptr = Strategy::allocate(alloc_size);
+				benchmark::DoNotOptimize(ptr);
+			}
+			batch_queue.push(std::move(batch));
+		}
+		else {
+			for (void *ptr: batch_queue.pop()) {
+				Strategy::deallocate(ptr, alloc_size);
+			}
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+	if (state.thread_index() == 0) {
+		state.counters["rss_kb"] = static_cast<double>(resident_set_size() / 1024);
+	}
+}
+
+BENCHMARK_TEMPLATE(producer_consumer, MallocStrategy)
+        ->RangeMultiplier(4)->Range(16, 256)
+        ->ThreadRange(2, MAX_PAIR * 2)->UseRealTime();
+BENCHMARK_TEMPLATE(producer_consumer, ReservePoolStrategy)
+        ->RangeMultiplier(4)->Range(16, 256)
+        ->ThreadRange(2, MAX_PAIR * 2)->UseRealTime();
+
+/*
+ * Sizes are drawn from a skewed distribution up to the given bound,
+ * so that most classes of the geometric size classes are exercised.
+ */
+template<class Strategy>
+void size_mix(benchmark::State &state) {
+	constexpr size_t ALLOC_AMOUNT = 4096;
+
+	const size_t max_size = state.range(0);
+
+	std::mt19937_64 engine(0);
+	std::vector<size_t> size_array(ALLOC_AMOUNT);
+	for (size_t &size: size_array) {
+		// Square of a uniform number leans towards small sizes
+		double ratio = std::uniform_real_distribution<double>(0, 1)(engine);
+		size = 1 + static_cast<size_t>(ratio * ratio * (max_size - 1));
+	}
+
+	std::vector<void *> ptr_array(ALLOC_AMOUNT);
+	for (auto _: state) {
+		for (size_t i = 0; i < ALLOC_AMOUNT; ++i) {
+			ptr_array[i] = Strategy::allocate(size_array[i]);
+			benchmark::DoNotOptimize(ptr_array[i]);
+		}
+		for (size_t i = 0; i < ALLOC_AMOUNT; ++i) {
+			Strategy::deallocate(ptr_array[i], size_array[i]);
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations() * ALLOC_AMOUNT);
+	state.counters["rss_kb"] = static_cast<double>(resident_set_size() / 1024);
+}
+
+BENCHMARK_TEMPLATE(size_mix, MallocStrategy)
+        ->RangeMultiplier(8)->Range(64, 64 * 1024);
+BENCHMARK_TEMPLATE(size_mix, ReservePoolStrategy)
+        ->RangeMultiplier(8)->Range(64, 64 * 1024);
+
+BENCHMARK_MAIN();
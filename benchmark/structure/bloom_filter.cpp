@@ -0,0 +1,202 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <structure/map/bloom_filter.h>
+#include <structure/map/blocked_bloom_filter.h>
+#include <structure/map/cuckoo_filter.h>
+#include <structure/map/binary_fuse_filter.h>
+
+/*
+ * Filters are sized by the projected element count of range(0) and the false positive probability of 1 / range(1).
+ * Lookups query inserted and absent keys alternately, with the measured false positive rate reported as fpr.
+ * Fingerprint filters settle the probability by their fingerprints instead, and static ones are built in bulk.
+ */
+
+using namespace algorithm;
+
+structure::BloomParameter make_parameter(const benchmark::State &state) {
+	structure::BloomParameter parameter;
+	parameter.projected_element_count    = state.range(0);
+	parameter.false_positive_probability = 1.0 / state.range(1);
+	parameter.compute_optimal_parameters();
+	return parameter;
+}
+
+/// Scattered keys, where odd indices are never inserted
+std::vector<uint64_t> make_key_array(size_t size) {
+	std::vector<uint64_t> key_array(size);
+	for (size_t idx = 0; idx < size; ++idx) { key_array[idx] = idx * 0x9E3779B97F4A7C15ULL; }
+	return key_array;
+}
+
+template<class Filter>
+void insert(benchmark::State &state) {
+	const std::vector<uint64_t> key_array = make_key_array(state.range(0));
+	Filter filter(make_parameter(state));
+
+	for (auto _: state) {
+		state.PauseTiming();
+		filter.clear();
+		state.ResumeTiming();
+		for (uint64_t key: key_array) { filter.insert(key); }
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * key_array.size());
+	state.counters["bits_per_key"] = static_cast<double>(filter.size()) / key_array.size();
+}
+
+template<class Filter>
+void contains(benchmark::State &state) {
+	const std::vector<uint64_t> key_array = make_key_array(2 * state.range(0));
+	Filter filter(make_parameter(state));
+	for (size_t idx = 0; idx < key_array.size(); idx += 2) { filter.insert(key_array[idx]); }
+
+	size_t false_positive_amount = 0;
+	for (size_t idx = 1; idx < key_array.size(); idx += 2) { false_positive_amount += filter.contains(key_array[idx]); }
+
+	for (auto _: state) {
+		size_t positive_amount = 0;
+		for (uint64_t key: key_array) { positive_amount += filter.contains(key); }
+		benchmark::DoNotOptimize(positive_amount);
+	}
+	state.SetItemsProcessed(state.iterations() * key_array.size());
+	state.counters["fpr"]          = static_cast<double>(false_positive_amount) / state.range(0);
+	state.counters["bits_per_key"] = static_cast<double>(filter.size()) / state.range(0);
+}
+
+template<class Filter>
+void insert_batch(benchmark::State &state) {
+	const std::vector<uint64_t> key_array = make_key_array(state.range(0));
+	Filter filter(make_parameter(state));
+
+	for (auto _: state) {
+		state.PauseTiming();
+		filter.clear();
+		state.ResumeTiming();
+		filter.insert_batch(std::span<const uint64_t>{key_array});
+		benchmark::ClobberMemory();
+	}
+	state.SetItemsProcessed(state.iterations() * key_array.size());
+}
+
+template<class Filter>
+void contains_batch(benchmark::State &state) {
+	const std::vector<uint64_t> key_array = make_key_array(2 * state.range(0));
+	Filter filter(make_parameter(state));
+	for (size_t idx = 0; idx < key_array.size(); idx += 2) { filter.insert(key_array[idx]); }
+
+	std::vector<uint64_t> bitmap((key_array.size() + 63) / 64);
+	for (auto _: state) {
+		benchmark::DoNotOptimize(filter.contains_batch(std::span<const uint64_t>{key_array}, bitmap.data()));
+	}
+	state.SetItemsProcessed(state.iterations() * key_array.size());
+}
+
+template<class Filter>
+void build(benchmark::State &state) {
+	const std::vector<uint64_t> key_array = make_key_array(state.range(0));
+
+	size_t bit_amount = 0;
+	for (auto _: state) {
+		Filter filter(std::span<const uint64_t>{key_array});
+		bit_amount = filter.size();
+		benchmark::DoNotOptimize(filter);
+	}
+	state.SetItemsProcessed(state.iterations() * key_array.size());
+	state.counters["bits_per_key"] = static_cast<double>(bit_amount) / key_array.size();
+}
+
+template<class Filter>
+void contains_static(benchmark::State &state) {
+	const std::vector<uint64_t> key_array = make_key_array(2 * state.range(0));
+	std::vector<uint64_t> inserted_array;
+	for (size_t idx = 0; idx < key_array.size(); idx += 2) { inserted_array.push_back(key_array[idx]); }
+	const Filter filter(std::span<const uint64_t>{inserted_array});
+
+	size_t false_positive_amount = 0;
+	for (size_t idx = 1; idx < key_array.size(); idx += 2) { false_positive_amount += filter.contains(key_array[idx]); }
+
+	for (auto _: state) {
+		size_t positive_amount = 0;
+		for (uint64_t key: key_array) { positive_amount += filter.contains(key); }
+		benchmark::DoNotOptimize(positive_amount);
+	}
+	state.SetItemsProcessed(state.iterations() * key_array.size());
+	state.counters["fpr"]          = static_cast<double>(false_positive_amount) / state.range(0);
+	state.counters["bits_per_key"] = static_cast<double>(filter.size()) / state.range(0);
+}
+
+template<class Filter>
+void contains_static_batch(benchmark::State &state) {
+	const std::vector<uint64_t> key_array = make_key_array(2 * state.range(0));
+	std::vector<uint64_t> inserted_array;
+	for (size_t idx = 0; idx < key_array.size(); idx += 2) { inserted_array.push_back(key_array[idx]); }
+	const Filter filter(std::span<const uint64_t>{inserted_array});
+
+	std::vector<uint64_t> bitmap((key_array.size() + 63) / 64);
+	for (auto _: state) {
+		benchmark::DoNotOptimize(filter.contains_batch(std::span<const uint64_t>{key_array}, bitmap.data()));
+	}
+	state.SetItemsProcessed(state.iterations() * key_array.size());
+}
+
+/// Load a saved filter by mapping, where the table is verified against its checksum if range(2) is set
+template<class Filter>
+void open_mapped(benchmark::State &state) {
+	const std::vector<uint64_t> key_array = make_key_array(state.range(0));
+	Filter filter(make_parameter(state));
+	for (uint64_t key: key_array) { filter.insert(key); }
+
+	const std::string path = std::filesystem::temp_directory_path() / "bloom_filter_benchmark.bloom";
+	filter.save(path);
+
+	for (auto _: state) {
+		const Filter mapped_filter = Filter::open_mapped(path, state.range(2) != 0);
+		benchmark::DoNotOptimize(mapped_filter.contains(key_array.front()));
+	}
+	state.SetItemsProcessed(state.iterations() * key_array.size());
+	std::filesystem::remove(path);
+}
+
+#define BLOOM_FILTER_ARGS ArgsProduct({{1 << 16, 1 << 22}, {100, 1000, 100000}})
+
+BENCHMARK_TEMPLATE(insert, structure::BloomFilter<>)->BLOOM_FILTER_ARGS;
+BENCHMARK_TEMPLATE(insert, structure::BlockedBloomFilter)->BLOOM_FILTER_ARGS;
+BENCHMARK_TEMPLATE(contains, structure::BloomFilter<>)->BLOOM_FILTER_ARGS;
+BENCHMARK_TEMPLATE(contains, structure::BlockedBloomFilter)->BLOOM_FILTER_ARGS;
+BENCHMARK_TEMPLATE(insert_batch, structure::BloomFilter<>)->BLOOM_FILTER_ARGS;
+BENCHMARK_TEMPLATE(insert_batch, structure::CompressibleBloomFilter<>)->BLOOM_FILTER_ARGS;
+BENCHMARK_TEMPLATE(insert_batch, structure::BlockedBloomFilter)->BLOOM_FILTER_ARGS;
+BENCHMARK_TEMPLATE(contains_batch, structure::BloomFilter<>)->BLOOM_FILTER_ARGS;
+BENCHMARK_TEMPLATE(contains_batch, structure::CompressibleBloomFilter<>)->BLOOM_FILTER_ARGS;
+BENCHMARK_TEMPLATE(contains_batch, structure::BlockedBloomFilter)->BLOOM_FILTER_ARGS;
+BENCHMARK_TEMPLATE(open_mapped, structure::BloomFilter<>)->ArgsProduct({{1 << 16, 1 << 22}, {100, 100000}, {0, 1}});
+
+#define FINGERPRINT_FILTER_ARGS ArgsProduct({{1 << 16, 1 << 22}, {256}})
+#define STATIC_FILTER_ARGS Arg(1 << 16)->Arg(1 << 22)
+
+BENCHMARK_TEMPLATE(insert, structure::CuckooFilter<uint8_t>)->FINGERPRINT_FILTER_ARGS;
+BENCHMARK_TEMPLATE(insert, structure::CuckooFilter<uint16_t>)->FINGERPRINT_FILTER_ARGS;
+BENCHMARK_TEMPLATE(contains, structure::CuckooFilter<uint8_t>)->FINGERPRINT_FILTER_ARGS;
+BENCHMARK_TEMPLATE(contains, structure::CuckooFilter<uint16_t>)->FINGERPRINT_FILTER_ARGS;
+BENCHMARK_TEMPLATE(contains_batch, structure::CuckooFilter<uint8_t>)->FINGERPRINT_FILTER_ARGS;
+BENCHMARK_TEMPLATE(contains_batch, structure::CuckooFilter<uint16_t>)->FINGERPRINT_FILTER_ARGS;
+BENCHMARK_TEMPLATE(build, structure::BinaryFuseFilter<uint8_t>)->STATIC_FILTER_ARGS;
+BENCHMARK_TEMPLATE(build, structure::BinaryFuseFilter<uint16_t>)->STATIC_FILTER_ARGS;
+BENCHMARK_TEMPLATE(contains_static, structure::BinaryFuseFilter<uint8_t>)->STATIC_FILTER_ARGS;
+BENCHMARK_TEMPLATE(contains_static, structure::BinaryFuseFilter<uint16_t>)->STATIC_FILTER_ARGS;
+BENCHMARK_TEMPLATE(contains_static_batch, structure::BinaryFuseFilter<uint8_t>)->STATIC_FILTER_ARGS;
+BENCHMARK_TEMPLATE(contains_static_batch, structure::BinaryFuseFilter<uint16_t>)->STATIC_FILTER_ARGS;
+
+BENCHMARK_MAIN();
@@ -0,0 +1,129 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <structure/map/bptree.h>
+
+/*
+ * Maps of range(0) pairs with scattered 64-bit keys, where lookups query keys in a shuffled order,
+ * scans visit SCAN_LENGTH pairs from random positions, and insertion starts from an empty map.
+ */
+
+using namespace algorithm;
+
+using BPlusTree = structure::BPlusTree<uint64_t, uint64_t>;
+using StdMap    = std::map<uint64_t, uint64_t>;
+
+constexpr size_t SCAN_LENGTH = 100;
+
+/// Keys in the order of insertion, i.e. an odd multiplicative sequence
+std::vector<uint64_t> make_key_array(size_t size) {
+	std::vector<uint64_t> key_array(size);
+	for (size_t idx = 0; idx < size; ++idx) { key_array[idx] = idx * 0x9E3779B97F4A7C15ULL; }
+	return key_array;
+}
+
+bool map_insert(BPlusTree &map, uint64_t key, uint64_t value) { return map.insert(key, value); }
+
+bool map_insert(StdMap &map, uint64_t key, uint64_t value) { return map.emplace(key, value).second; }
+
+uint64_t map_find(const BPlusTree &map, uint64_t key) { return map.find(key).value(); }
+
+uint64_t map_find(const StdMap &map, uint64_t key) { return map.find(key)->second; }
+
+uint64_t map_scan(const BPlusTree &map, uint64_t key) {
+	uint64_t res = 0;
+	size_t amount = 0;
+	for (auto iter = map.lower_bound(key); iter != map.end() && amount < SCAN_LENGTH; ++iter, ++amount) { res += iter.value(); }
+	return res;
+}
+
+uint64_t map_scan(const StdMap &map, uint64_t key) {
+	uint64_t res = 0;
+	size_t amount = 0;
+	for (auto iter = map.lower_bound(key); iter != map.end() && amount < SCAN_LENGTH; ++iter, ++amount) { res += iter->second; }
+	return res;
+}
+
+template<class Map>
+void insert(benchmark::State &state) {
+	const std::vector<uint64_t> key_array = make_key_array(state.range(0));
+
+	for (auto _: state) {
+		Map map;
+		for (uint64_t key: key_array) { map_insert(map, key, key); }
+		benchmark::DoNotOptimize(map);
+	}
+	state.SetItemsProcessed(state.iterations() * key_array.size());
+}
+
+void bulk_load(benchmark::State &state) {
+	std::vector<uint64_t> key_array = make_key_array(state.range(0));
+	std::sort(key_array.begin(), key_array.end());
+
+	for (auto _: state) {
+		BPlusTree map;
+		map.bulk_load(key_array, key_array);
+		benchmark::DoNotOptimize(map);
+	}
+	state.SetItemsProcessed(state.iterations() * key_array.size());
+}
+
+/// Keys of the map in a shuffled order of lookup
+template<class Map>
+std::vector<uint64_t> make_query_array(Map &map, size_t size) {
+	const std::vector<uint64_t> key_array = make_key_array(size);
+	for (uint64_t key: key_array) { map_insert(map, key, key); }
+
+	std::vector<uint64_t> query_array(size);
+	for (size_t idx = 0; idx < size; ++idx) { query_array[idx] = key_array[(idx * 0x2545F4914F6CDD1DULL) % size]; }
+	return query_array;
+}
+
+template<class Map>
+void find(benchmark::State &state) {
+	Map map;
+	const std::vector<uint64_t> query_array = make_query_array(map, state.range(0));
+
+	for (auto _: state) {
+		uint64_t res = 0;
+		for (uint64_t key: query_array) { res += map_find(map, key); }
+		benchmark::DoNotOptimize(res);
+	}
+	state.SetItemsProcessed(state.iterations() * query_array.size());
+}
+
+template<class Map>
+void scan(benchmark::State &state) {
+	Map map;
+	const std::vector<uint64_t> query_array = make_query_array(map, state.range(0));
+	constexpr size_t SCAN_AMOUNT = 1 << 14;
+
+	for (auto _: state) {
+		uint64_t res = 0;
+		for (size_t idx = 0; idx < SCAN_AMOUNT; ++idx) { res += map_scan(map, query_array[idx % query_array.size()]); }
+		benchmark::DoNotOptimize(res);
+	}
+	state.SetItemsProcessed(state.iterations() * SCAN_AMOUNT * SCAN_LENGTH);
+}
+
+#define MAP_ARGS Arg(1 << 16)->Arg(1 << 22)->Unit(benchmark::kMillisecond)
+
+BENCHMARK_TEMPLATE(insert, BPlusTree)->MAP_ARGS;
+BENCHMARK_TEMPLATE(insert, StdMap)->MAP_ARGS;
+BENCHMARK(bulk_load)->MAP_ARGS;
+BENCHMARK_TEMPLATE(find, BPlusTree)->MAP_ARGS;
+BENCHMARK_TEMPLATE(find, StdMap)->MAP_ARGS;
+BENCHMARK_TEMPLATE(scan, BPlusTree)->MAP_ARGS;
+BENCHMARK_TEMPLATE(scan, StdMap)->MAP_ARGS;
+
+BENCHMARK_MAIN();
@@ -0,0 +1,112 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <thread/cpu_bind_thread.h>
+#include <structure/map/bloom_filter.h>
+#include <structure/map/concurrent_bloom_filter.h>
+
+/*
+ * Threads of range(0) insert or look up disjoint slices of KEY_AMOUNT keys, with each thread bound to a cpu.
+ * The classic filter guarded by a mutex is taken as the baseline of insertion.
+ */
+
+using namespace algorithm;
+
+constexpr size_t KEY_AMOUNT = 1 << 22;
+
+structure::BloomParameter make_parameter() {
+	structure::BloomParameter parameter;
+	parameter.projected_element_count    = KEY_AMOUNT;
+	parameter.false_positive_probability = 0.01;
+	parameter.compute_optimal_parameters();
+	return parameter;
+}
+
+const std::vector<uint64_t> &get_key_array() {
+	static const std::vector<uint64_t> key_array = [] {
+		std::vector<uint64_t> res(KEY_AMOUNT);
+		for (size_t idx = 0; idx < KEY_AMOUNT; ++idx) { res[idx] = idx * 0x9E3779B97F4A7C15ULL; }
+		return res;
+	}();
+	return key_array;
+}
+
+/// Run func(begin, end) on thread_amount bound threads over even slices of keys
+template<class Func>
+void run_sliced(size_t thread_amount, Func &&func) {
+	const std::vector<uint64_t> &key_array = get_key_array();
+	const size_t slice_size = (key_array.size() + thread_amount - 1) / thread_amount;
+
+	std::vector<std::unique_ptr<thread::CPUBindThread>> thread_array;
+	for (size_t thread_idx = 0; thread_idx < thread_amount; ++thread_idx) {
+		const size_t begin = std::min(thread_idx * slice_size, key_array.size());
+		const size_t end   = std::min(begin + slice_size, key_array.size());
+		thread_array.emplace_back(std::make_unique<thread::CPUBindThread>([&func, &key_array, begin, end] {
+			func(key_array.data() + begin, key_array.data() + end);
+		}));
+	}
+	for (auto &thread_ptr: thread_array) { thread_ptr->get_origin_thread().join(); }
+}
+
+void concurrent_insert(benchmark::State &state) {
+	structure::ConcurrentBloomFilter filter(make_parameter());
+
+	for (auto _: state) {
+		state.PauseTiming();
+		filter.clear();
+		state.ResumeTiming();
+		run_sliced(state.range(0), [&filter](const uint64_t *begin, const uint64_t *end) {
+			for (const uint64_t *ptr = begin; ptr != end; ++ptr) { filter.insert(*ptr); }
+		});
+	}
+	state.SetItemsProcessed(state.iterations() * KEY_AMOUNT);
+}
+
+void mutex_insert(benchmark::State &state) {
+	structure::BloomFilter filter(make_parameter());
+	std::mutex filter_mutex;
+
+	for (auto _: state) {
+		state.PauseTiming();
+		filter.clear();
+		state.ResumeTiming();
+		run_sliced(state.range(0), [&filter, &filter_mutex](const uint64_t *begin, const uint64_t *end) {
+			for (const uint64_t *ptr = begin; ptr != end; ++ptr) {
+				std::lock_guard<std::mutex> lock(filter_mutex);
+				filter.insert(*ptr);
+			}
+		});
+	}
+	state.SetItemsProcessed(state.iterations() * KEY_AMOUNT);
+}
+
+void concurrent_contains(benchmark::State &state) {
+	structure::ConcurrentBloomFilter filter(make_parameter());
+	for (uint64_t key: get_key_array()) { filter.insert(key); }
+
+	for (auto _: state) {
+		run_sliced(state.range(0), [&filter](const uint64_t *begin, const uint64_t *end) {
+			size_t positive_amount = 0;
+			for (const uint64_t *ptr = begin; ptr != end; ++ptr) { positive_amount += filter.contains(*ptr); }
+			benchmark::DoNotOptimize(positive_amount);
+		});
+	}
+	state.SetItemsProcessed(state.iterations() * KEY_AMOUNT);
+}
+
+BENCHMARK(concurrent_insert)->RangeMultiplier(2)->Range(1, 64)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(mutex_insert)->RangeMultiplier(2)->Range(1, 64)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(concurrent_contains)->RangeMultiplier(2)->Range(1, 64)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
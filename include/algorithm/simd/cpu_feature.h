@@ -0,0 +1,73 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_ALGORITHM_SIMD_CPU_FEATURE_H
+#define ALGORITHM_ALGORITHM_SIMD_CPU_FEATURE_H
+
+#include <cstdint>
+
+namespace algorithm::simd {
+
+	/*!
+	 * @brief Instruction sets with a vectorized implementation, in the order of preference
+	 */
+	enum class ISA : uint32_t {
+		Scalar = 0,
+		AVX2   = 1,
+		AVX512 = 2
+	};
+
+	/*!
+	 * @brief Features of the running cpu, which also take the support of OS (XCR0) into account
+	 */
+	struct CPUFeature {
+		bool popcnt_;
+		bool bmi2_;
+		bool avx2_;
+		bool avx512f_;
+		bool avx512bw_;
+		bool avx512vl_;
+		bool avx512dq_;
+	};
+
+	inline const CPUFeature &get_cpu_feature() {
+		static const CPUFeature cpu_feature = [] {
+			__builtin_cpu_init();
+			return CPUFeature {
+				.popcnt_   = static_cast<bool>(__builtin_cpu_supports("popcnt")),
+				.bmi2_     = static_cast<bool>(__builtin_cpu_supports("bmi2")),
+				.avx2_     = static_cast<bool>(__builtin_cpu_supports("avx2")),
+				.avx512f_  = static_cast<bool>(__builtin_cpu_supports("avx512f")),
+				.avx512bw_ = static_cast<bool>(__builtin_cpu_supports("avx512bw")),
+				.avx512vl_ = static_cast<bool>(__builtin_cpu_supports("avx512vl")),
+				.avx512dq_ = static_cast<bool>(__builtin_cpu_supports("avx512dq"))
+			};
+		}();
+		return cpu_feature;
+	}
+
+	/*!
+	 * @brief Acquire the best instruction set supported by the running cpu
+	 */
+	inline ISA get_isa() {
+		static const ISA isa = [] {
+			const CPUFeature &cpu_feature = get_cpu_feature();
+			const bool avx2_ready = cpu_feature.avx2_ && cpu_feature.bmi2_ && cpu_feature.popcnt_;
+			if (avx2_ready && cpu_feature.avx512f_ && cpu_feature.avx512bw_ && cpu_feature.avx512vl_ && cpu_feature.avx512dq_) {
+				return ISA::AVX512;
+			}
+			return avx2_ready ? ISA::AVX2 : ISA::Scalar;
+		}();
+		return isa;
+	}
+
+	inline bool is_isa_supported(ISA isa) {
+		return static_cast<uint32_t>(isa) <= static_cast<uint32_t>(get_isa());
+	}
+
+}
+
+#endif//ALGORITHM_ALGORITHM_SIMD_CPU_FEATURE_H
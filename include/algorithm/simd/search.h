@@ -10,83 +10,359 @@
 #include <immintrin.h>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <type_traits>
+
+#include <algorithm/simd/cpu_feature.h>
 
 namespace algorithm::simd {
 
+	/*!
+	 * @brief Types with vectorized scanning, i.e. integers of 8/16/32/64 bits and floating points
+	 */
+	template<class T>
+	concept FindableConcept = (std::integral<T> && !std::same_as<T, bool>)
+	                       || std::same_as<T, float> || std::same_as<T, double>;
 
+	/// Bit mask with the lowest amount bits set
+	inline constexpr uint64_t low_bit_mask(size_t amount) {
+		return amount >= 64 ? ~uint64_t(0) : (uint64_t(1) << amount) - 1;
+	}
+
+	/// The amount of 64-bit words of a bit mask over size elements
+	inline constexpr size_t bit_mask_size(size_t size) {
+		return (size + 63) / 64;
+	}
 
 	/*!
-	 * @brief Returns the index of the first occurrence of k in the n integers pointed by v, or n if k is not in v.
-	 * @param k Value to match
-	 * @param v The array of value
-	 * @param n The size of array
-	 * @return The position where value first appear.
-	 * @warning The address need to aligned to 16
+	 * @brief Set bits of elements starting from base in the bit mask array
+	 * @return The amount of bits set
 	 */
-	size_t find_int_sse2(int k, const int *v, size_t n) {
-		// We are going to check the integers from v four by four.
-		// This instruction copies the searched value k in each of the
-		// four 32-bits lanes of the 128 bits register. If k…k represents
-		// the 32 bits of k, the register then looks like this:
-		//
-		// [ k…k | k…k | k…k | k…k ]
-		//
-		const __m128i needle = _mm_set1_epi32(k);
-		// Here we just reinterpret the pointer v as a pointer to 128-bits
-		// vectors. This will allow accessing the integer four by four.
-		// And yes, I do use a C cast like a barbarian.
-		const __m128i *p = reinterpret_cast<const __m128i *>(v);
-		// A division! Will the compiler emit a shift for it?
-		const size_t iterations = n / 4;
-		for (size_t i = 0; i != iterations; ++i, ++p) {
-			const __m128i haystack = *p;
-			// This compares all four 32-bits values of needle (so four
-			// times the searched value) with four integers pointed by p,
-			// all at once. All bits of a 32-bits lane are set to 1 if the
-			// values are equal. The operation looks like this:
-			//
-			//       [ k…k | k…k | k…k | k…k ]
-			// cmpeq [ a…a | b…b | k…k | c…c ]
-			//     = [ 0…0 | 0…0 | 1…1 | 0…0 ]
-			//
-			const __m128i mask = _mm_cmpeq_epi32(needle, haystack);
-			// We cannot compare mask against zero directly, but we have an
-			// instruction to help us check the bits in mask.
-			// This instruction takes the most significant bit of each of
-			//  the sixteen 8-bits lanes from a 128-bits register and puts
-			// them in the low bits of a 32-bits integer.
-			//
-			// Consequently, since there are four 8-bit lanes in an
-			// integer, if k has been found in haystack, we should have a
-			// 0b1111 in eq. Otherwise, eq will be zero. For example,
-			//
-			// movemask                     [ 0…0 | 0…0 | 1…1 | 0…0 ]
-			//        = 0000 0000 0000 0000  0000  0000  1111  0000
-			//
-			const uint32_t eq = _mm_movemask_epi8(mask);
-			// Since we are back with a scalar value, we can test it directly.
-			if (eq == 0) {
-				continue;
+	inline size_t set_bit_mask(uint64_t *mask_ptr, size_t base, uint64_t mask) {
+		const size_t word_idx = base / 64;
+		const size_t shift    = base % 64;
+		mask_ptr[word_idx] |= mask << shift;
+		if (shift != 0 && (mask >> (64 - shift)) != 0) {
+			mask_ptr[word_idx + 1] |= mask >> (64 - shift);
+		}
+		return std::popcount(mask);
+	}
+
+	namespace scalar {
+
+		template<FindableConcept T>
+		inline size_t find(const T *ptr, size_t size, T value) {
+			for (size_t idx = 0; idx < size; ++idx) {
+				if (ptr[idx] == value) { return idx; }
+			}
+			return size;
+		}
+
+		template<FindableConcept T>
+		inline size_t count(const T *ptr, size_t size, T value) {
+			size_t res = 0;
+			for (size_t idx = 0; idx < size; ++idx) {
+				res += (ptr[idx] == value);
+			}
+			return res;
+		}
+
+		template<FindableConcept T>
+		inline size_t find_all(const T *ptr, size_t size, T value, uint64_t *mask_ptr) {
+			std::fill(mask_ptr, mask_ptr + bit_mask_size(size), 0);
+			size_t res = 0;
+			for (size_t idx = 0; idx < size; ++idx) {
+				if (ptr[idx] == value) { mask_ptr[idx / 64] |= uint64_t(1) << (idx % 64); ++res; }
+			}
+			return res;
+		}
+
+		template<FindableConcept T>
+		inline size_t find_if_less(const T *ptr, size_t size, T bound, uint64_t *mask_ptr) {
+			std::fill(mask_ptr, mask_ptr + bit_mask_size(size), 0);
+			size_t res = 0;
+			for (size_t idx = 0; idx < size; ++idx) {
+				if (ptr[idx] < bound) { mask_ptr[idx / 64] |= uint64_t(1) << (idx % 64); ++res; }
+			}
+			return res;
+		}
+
+		/// Filter candidates by the first byte with memchr, which is vectorized by the C library
+		inline size_t find_substring(const uint8_t *base_ptr, size_t base_size, const uint8_t *pattern_ptr, size_t pattern_size) {
+			if (base_size < pattern_size) { return base_size; }
+
+			const size_t end_pos = base_size - pattern_size + 1;
+			size_t idx = 0;
+			while (idx < end_pos) {
+				const void *first_ptr = std::memchr(base_ptr + idx, pattern_ptr[0], end_pos - idx);
+				if (first_ptr == nullptr) { break; }
+
+				idx = static_cast<const uint8_t *>(first_ptr) - base_ptr;
+				if (std::memcmp(base_ptr + idx + 1, pattern_ptr + 1, pattern_size - 1) == 0) { return idx; }
+				++idx;
+			}
+			return base_size;
+		}
+
+	}
+
+#pragma GCC push_options
+#pragma GCC target("avx2,bmi,bmi2,popcnt")
+
+	namespace avx2 {
+
+		template<FindableConcept T>
+		struct VecTraits {
+			using ValueType = T;
+			using Reg       = __m256i;
+
+			static constexpr size_t LANES = 32 / sizeof(T);
+
+			static Reg load(const ValueType *ptr) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr)); }
+
+			static Reg set1(ValueType value) {
+				if constexpr (std::same_as<T, float>)  { return _mm256_castps_si256(_mm256_set1_ps(value)); }
+				else if constexpr (std::same_as<T, double>) { return _mm256_castpd_si256(_mm256_set1_pd(value)); }
+				else if constexpr (sizeof(T) == 1) { return _mm256_set1_epi8(static_cast<char>(value)); }
+				else if constexpr (sizeof(T) == 2) { return _mm256_set1_epi16(static_cast<int16_t>(value)); }
+				else if constexpr (sizeof(T) == 4) { return _mm256_set1_epi32(static_cast<int32_t>(value)); }
+				else                               { return _mm256_set1_epi64x(static_cast<int64_t>(value)); }
+			}
+
+			/// Bit mask of lanes from the result of comparison, where 16-bit lanes are extracted from the byte mask
+			static uint64_t lane_mask(Reg cmp) {
+				if constexpr (sizeof(T) == 1)      { return static_cast<uint32_t>(_mm256_movemask_epi8(cmp)); }
+				else if constexpr (sizeof(T) == 2) { return _pext_u32(static_cast<uint32_t>(_mm256_movemask_epi8(cmp)), 0xAAAAAAAAU); }
+				else if constexpr (sizeof(T) == 4) { return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(cmp))); }
+				else                               { return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(cmp))); }
+			}
+
+			static Reg cmp_gt(Reg lhs, Reg rhs) {
+				if constexpr (sizeof(T) == 1)      { return _mm256_cmpgt_epi8(lhs, rhs); }
+				else if constexpr (sizeof(T) == 2) { return _mm256_cmpgt_epi16(lhs, rhs); }
+				else if constexpr (sizeof(T) == 4) { return _mm256_cmpgt_epi32(lhs, rhs); }
+				else                               { return _mm256_cmpgt_epi64(lhs, rhs); }
+			}
+
+			static uint64_t eq_mask(Reg reg, Reg needle) {
+				if constexpr (std::same_as<T, float>) {
+					return lane_mask(_mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(reg), _mm256_castsi256_ps(needle), _CMP_EQ_OQ)));
+				}
+				else if constexpr (std::same_as<T, double>) {
+					return lane_mask(_mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(reg), _mm256_castsi256_pd(needle), _CMP_EQ_OQ)));
+				}
+				else if constexpr (sizeof(T) == 1) { return lane_mask(_mm256_cmpeq_epi8(reg, needle)); }
+				else if constexpr (sizeof(T) == 2) { return lane_mask(_mm256_cmpeq_epi16(reg, needle)); }
+				else if constexpr (sizeof(T) == 4) { return lane_mask(_mm256_cmpeq_epi32(reg, needle)); }
+				else                               { return lane_mask(_mm256_cmpeq_epi64(reg, needle)); }
 			}
-			// Now we just have to find the offset of the lowest bit set
-			// to 1. My laptop does not support the tzcnt instruction, so I
-			// use the GCC builtin equivalent.
-			const unsigned zero_bits_count = __builtin_ctz(eq);
-			// Each 4-bits group in eq matches a 32-bits value from mask,
-			// thus we divide by 4.
-			return i * 4 + zero_bits_count / 4;
-		}
-		// Handle the last entries if the number of entries was not a
-		// multiple of four.
-		for (size_t i = iterations * 4; i != n; ++i) {
-			if (v[i] == k) {
-				return i;
+
+			/// Unsigned comparison is signed comparison with sign bits flipped
+			static uint64_t lt_mask(Reg reg, Reg bound) {
+				if constexpr (std::same_as<T, float>) {
+					return lane_mask(_mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(reg), _mm256_castsi256_ps(bound), _CMP_LT_OQ)));
+				}
+				else if constexpr (std::same_as<T, double>) {
+					return lane_mask(_mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(reg), _mm256_castsi256_pd(bound), _CMP_LT_OQ)));
+				}
+				else if constexpr (std::is_signed_v<T>) { return lane_mask(cmp_gt(bound, reg)); }
+				else {
+					const Reg sign_reg = set1(static_cast<T>(T(1) << (sizeof(T) * 8 - 1)));
+					return lane_mask(cmp_gt(_mm256_xor_si256(bound, sign_reg), _mm256_xor_si256(reg, sign_reg)));
+				}
 			}
+		};
+
+#include <algorithm/simd/search_kernel.h>
+
+		template<FindableConcept T>
+		inline size_t find(const T *ptr, size_t size, T value) {
+			return find_impl<VecTraits<T>>(ptr, size, value);
 		}
 
-		return n;
+		template<FindableConcept T>
+		inline size_t count(const T *ptr, size_t size, T value) {
+			return count_impl<VecTraits<T>>(ptr, size, value);
+		}
+
+		template<FindableConcept T>
+		inline size_t find_all(const T *ptr, size_t size, T value, uint64_t *mask_ptr) {
+			return find_all_impl<VecTraits<T>>(ptr, size, value, mask_ptr);
+		}
+
+		template<FindableConcept T>
+		inline size_t find_if_less(const T *ptr, size_t size, T bound, uint64_t *mask_ptr) {
+			return find_if_less_impl<VecTraits<T>>(ptr, size, bound, mask_ptr);
+		}
+
+		inline size_t find_substring(const uint8_t *base_ptr, size_t base_size, const uint8_t *pattern_ptr, size_t pattern_size) {
+			return find_substring_impl<VecTraits<uint8_t>>(base_ptr, base_size, pattern_ptr, pattern_size);
+		}
+
+	}
+
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512bw,avx512vl,avx512dq,avx2,bmi,bmi2,popcnt")
+
+	namespace avx512 {
+
+		template<FindableConcept T>
+		struct VecTraits {
+			using ValueType = T;
+			using Reg       = __m512i;
+
+			static constexpr size_t LANES = 64 / sizeof(T);
+
+			static Reg load(const ValueType *ptr) { return _mm512_loadu_si512(ptr); }
+
+			static Reg set1(ValueType value) {
+				if constexpr (std::same_as<T, float>)  { return _mm512_castps_si512(_mm512_set1_ps(value)); }
+				else if constexpr (std::same_as<T, double>) { return _mm512_castpd_si512(_mm512_set1_pd(value)); }
+				else if constexpr (sizeof(T) == 1) { return _mm512_set1_epi8(static_cast<char>(value)); }
+				else if constexpr (sizeof(T) == 2) { return _mm512_set1_epi16(static_cast<int16_t>(value)); }
+				else if constexpr (sizeof(T) == 4) { return _mm512_set1_epi32(static_cast<int32_t>(value)); }
+				else                               { return _mm512_set1_epi64(static_cast<int64_t>(value)); }
+			}
+
+			static uint64_t eq_mask(Reg reg, Reg needle) {
+				if constexpr (std::same_as<T, float>) {
+					return _mm512_cmp_ps_mask(_mm512_castsi512_ps(reg), _mm512_castsi512_ps(needle), _CMP_EQ_OQ);
+				}
+				else if constexpr (std::same_as<T, double>) {
+					return _mm512_cmp_pd_mask(_mm512_castsi512_pd(reg), _mm512_castsi512_pd(needle), _CMP_EQ_OQ);
+				}
+				else if constexpr (sizeof(T) == 1) { return _mm512_cmpeq_epi8_mask(reg, needle); }
+				else if constexpr (sizeof(T) == 2) { return _mm512_cmpeq_epi16_mask(reg, needle); }
+				else if constexpr (sizeof(T) == 4) { return _mm512_cmpeq_epi32_mask(reg, needle); }
+				else                               { return _mm512_cmpeq_epi64_mask(reg, needle); }
+			}
+
+			static uint64_t lt_mask(Reg reg, Reg bound) {
+				if constexpr (std::same_as<T, float>) {
+					return _mm512_cmp_ps_mask(_mm512_castsi512_ps(reg), _mm512_castsi512_ps(bound), _CMP_LT_OQ);
+				}
+				else if constexpr (std::same_as<T, double>) {
+					return _mm512_cmp_pd_mask(_mm512_castsi512_pd(reg), _mm512_castsi512_pd(bound), _CMP_LT_OQ);
+				}
+				else if constexpr (std::is_signed_v<T>) {
+					if constexpr (sizeof(T) == 1)      { return _mm512_cmplt_epi8_mask(reg, bound); }
+					else if constexpr (sizeof(T) == 2) { return _mm512_cmplt_epi16_mask(reg, bound); }
+					else if constexpr (sizeof(T) == 4) { return _mm512_cmplt_epi32_mask(reg, bound); }
+					else                               { return _mm512_cmplt_epi64_mask(reg, bound); }
+				}
+				else {
+					if constexpr (sizeof(T) == 1)      { return _mm512_cmplt_epu8_mask(reg, bound); }
+					else if constexpr (sizeof(T) == 2) { return _mm512_cmplt_epu16_mask(reg, bound); }
+					else if constexpr (sizeof(T) == 4) { return _mm512_cmplt_epu32_mask(reg, bound); }
+					else                               { return _mm512_cmplt_epu64_mask(reg, bound); }
+				}
+			}
+		};
+
+#include <algorithm/simd/search_kernel.h>
+
+		template<FindableConcept T>
+		inline size_t find(const T *ptr, size_t size, T value) {
+			return find_impl<VecTraits<T>>(ptr, size, value);
+		}
+
+		template<FindableConcept T>
+		inline size_t count(const T *ptr, size_t size, T value) {
+			return count_impl<VecTraits<T>>(ptr, size, value);
+		}
+
+		template<FindableConcept T>
+		inline size_t find_all(const T *ptr, size_t size, T value, uint64_t *mask_ptr) {
+			return find_all_impl<VecTraits<T>>(ptr, size, value, mask_ptr);
+		}
+
+		template<FindableConcept T>
+		inline size_t find_if_less(const T *ptr, size_t size, T bound, uint64_t *mask_ptr) {
+			return find_if_less_impl<VecTraits<T>>(ptr, size, bound, mask_ptr);
+		}
+
+		inline size_t find_substring(const uint8_t *base_ptr, size_t base_size, const uint8_t *pattern_ptr, size_t pattern_size) {
+			return find_substring_impl<VecTraits<uint8_t>>(base_ptr, base_size, pattern_ptr, pattern_size);
+		}
+
+	}
+
+#pragma GCC pop_options
+
+	/*!
+	 * @brief Find the first element equal to value
+	 * @return The index of the first match, or size if there is none
+	 * @note There is no requirement on alignment.
+	 */
+	template<FindableConcept T>
+	inline size_t find(const T *ptr, size_t size, T value) {
+		switch (get_isa()) {
+			case ISA::AVX512: return avx512::find(ptr, size, value);
+			case ISA::AVX2:   return avx2::find(ptr, size, value);
+			default:          return scalar::find(ptr, size, value);
+		}
+	}
+
+	/*!
+	 * @brief Count elements equal to value
+	 */
+	template<FindableConcept T>
+	inline size_t count(const T *ptr, size_t size, T value) {
+		switch (get_isa()) {
+			case ISA::AVX512: return avx512::count(ptr, size, value);
+			case ISA::AVX2:   return avx2::count(ptr, size, value);
+			default:          return scalar::count(ptr, size, value);
+		}
+	}
+
+	/*!
+	 * @brief Find all elements equal to value
+	 * @param mask_ptr Bit mask of bit_mask_size(size) words, where bit i % 64 of word i / 64 is set if element i matches
+	 * @return The amount of matches
+	 */
+	template<FindableConcept T>
+	inline size_t find_all(const T *ptr, size_t size, T value, uint64_t *mask_ptr) {
+		switch (get_isa()) {
+			case ISA::AVX512: return avx512::find_all(ptr, size, value, mask_ptr);
+			case ISA::AVX2:   return avx2::find_all(ptr, size, value, mask_ptr);
+			default:          return scalar::find_all(ptr, size, value, mask_ptr);
+		}
+	}
+
+	/*!
+	 * @brief Find all elements less than bound
+	 * @param mask_ptr Bit mask of bit_mask_size(size) words, where bit i % 64 of word i / 64 is set if element i matches
+	 * @return The amount of matches
+	 */
+	template<FindableConcept T>
+	inline size_t find_if_less(const T *ptr, size_t size, T bound, uint64_t *mask_ptr) {
+		switch (get_isa()) {
+			case ISA::AVX512: return avx512::find_if_less(ptr, size, bound, mask_ptr);
+			case ISA::AVX2:   return avx2::find_if_less(ptr, size, bound, mask_ptr);
+			default:          return scalar::find_if_less(ptr, size, bound, mask_ptr);
+		}
+	}
+
+	/*!
+	 * @brief Find the first occurrence of a byte string
+	 * @return The position of the first match, or base_size if there is none
+	 */
+	inline size_t find_substring(const uint8_t *base_ptr, size_t base_size, const uint8_t *pattern_ptr, size_t pattern_size) {
+		if (pattern_size == 0) { return 0; }
+		if (pattern_size == 1) { return find(base_ptr, base_size, pattern_ptr[0]); }
+
+		switch (get_isa()) {
+			case ISA::AVX512: return avx512::find_substring(base_ptr, base_size, pattern_ptr, pattern_size);
+			case ISA::AVX2:   return avx2::find_substring(base_ptr, base_size, pattern_ptr, pattern_size);
+			default:          return scalar::find_substring(base_ptr, base_size, pattern_ptr, pattern_size);
+		}
 	}
 
 }
 
-#endif//ALGORITHM_ALGORITHM_SIMD_SEARCH_H
\ No newline at end of file
+#endif//ALGORITHM_ALGORITHM_SIMD_SEARCH_H
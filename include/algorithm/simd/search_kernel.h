@@ -0,0 +1,179 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+/*
+ * Kernels of scanning generic over vector traits, which are included once per instruction set by simd/search.h,
+ * inside the namespace and the target region of that instruction set. Hence there is no include guard.
+ *
+ * A vector traits V provides:
+ *   ValueType, Reg, LANES
+ *   load(ptr), set1(value)
+ *   eq_mask(reg, needle), lt_mask(reg, bound) -> Bit mask of lanes
+ */
+
+/*!
+ * @brief Scan the array by vectors, and visit the bit mask of each vector with matches.
+ * The head before the first aligned vector and the tail are covered by overlapping vectors with processed bits masked off.
+ * @param mask_func Acquire the bit mask of matches in a vector
+ * @param test_func Test an element, for arrays shorter than a vector
+ * @param visit_func Visit (base index, non-zero bit mask), and return false to stop
+ */
+template<class V, class MaskFunc, class TestFunc, class VisitFunc>
+inline void scan_impl(const typename V::ValueType *ptr, size_t size, MaskFunc &&mask_func, TestFunc &&test_func, VisitFunc &&visit_func) {
+	using T = typename V::ValueType;
+	constexpr size_t LANES     = V::LANES;
+	constexpr size_t VEC_BYTES = LANES * sizeof(T);
+
+	if (size < LANES) {
+		uint64_t mask = 0;
+		for (size_t idx = 0; idx < size; ++idx) {
+			if (test_func(ptr[idx])) { mask |= uint64_t(1) << idx; }
+		}
+		if (mask != 0) { visit_func(size_t(0), mask); }
+		return;
+	}
+
+	// Elements before the first aligned vector, where misaligned elements never reach alignment
+	const uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+	const size_t head = (address % sizeof(T) != 0) ? 0 : ((VEC_BYTES - address % VEC_BYTES) % VEC_BYTES) / sizeof(T);
+	if (head != 0) {
+		const uint64_t mask = mask_func(V::load(ptr)) & low_bit_mask(head);
+		if (mask != 0 && !visit_func(size_t(0), mask)) { return; }
+	}
+
+	size_t idx = head;
+	for (; idx + 4 * LANES <= size; idx += 4 * LANES) {
+		const uint64_t mask_0 = mask_func(V::load(ptr + idx));
+		const uint64_t mask_1 = mask_func(V::load(ptr + idx + LANES));
+		const uint64_t mask_2 = mask_func(V::load(ptr + idx + 2 * LANES));
+		const uint64_t mask_3 = mask_func(V::load(ptr + idx + 3 * LANES));
+		if ((mask_0 | mask_1 | mask_2 | mask_3) == 0) { continue; }
+
+		if (mask_0 != 0 && !visit_func(idx, mask_0))             { return; }
+		if (mask_1 != 0 && !visit_func(idx + LANES, mask_1))     { return; }
+		if (mask_2 != 0 && !visit_func(idx + 2 * LANES, mask_2)) { return; }
+		if (mask_3 != 0 && !visit_func(idx + 3 * LANES, mask_3)) { return; }
+	}
+	for (; idx + LANES <= size; idx += LANES) {
+		const uint64_t mask = mask_func(V::load(ptr + idx));
+		if (mask != 0 && !visit_func(idx, mask)) { return; }
+	}
+
+	if (idx < size) {
+		const size_t tail_start = size - LANES;
+		const uint64_t mask = mask_func(V::load(ptr + tail_start)) & ~low_bit_mask(idx - tail_start);
+		if (mask != 0) { visit_func(tail_start, mask); }
+	}
+}
+
+template<class V>
+inline size_t find_impl(const typename V::ValueType *ptr, size_t size, typename V::ValueType value) {
+	const auto needle = V::set1(value);
+	size_t res = size;
+	scan_impl<V>(ptr, size,
+	             [&needle](const auto &reg) { return V::eq_mask(reg, needle); },
+	             [value](auto element) { return element == value; },
+	             [&res](size_t base, uint64_t mask) { res = base + std::countr_zero(mask); return false; });
+	return res;
+}
+
+template<class V>
+inline size_t count_impl(const typename V::ValueType *ptr, size_t size, typename V::ValueType value) {
+	const auto needle = V::set1(value);
+	size_t res = 0;
+	scan_impl<V>(ptr, size,
+	             [&needle](const auto &reg) { return V::eq_mask(reg, needle); },
+	             [value](auto element) { return element == value; },
+	             [&res](size_t, uint64_t mask) { res += std::popcount(mask); return true; });
+	return res;
+}
+
+template<class V>
+inline size_t find_all_impl(const typename V::ValueType *ptr, size_t size, typename V::ValueType value, uint64_t *mask_ptr) {
+	const auto needle = V::set1(value);
+	std::fill(mask_ptr, mask_ptr + bit_mask_size(size), 0);
+	size_t res = 0;
+	scan_impl<V>(ptr, size,
+	             [&needle](const auto &reg) { return V::eq_mask(reg, needle); },
+	             [value](auto element) { return element == value; },
+	             [&res, mask_ptr](size_t base, uint64_t mask) { res += set_bit_mask(mask_ptr, base, mask); return true; });
+	return res;
+}
+
+template<class V>
+inline size_t find_if_less_impl(const typename V::ValueType *ptr, size_t size, typename V::ValueType bound, uint64_t *mask_ptr) {
+	const auto bound_reg = V::set1(bound);
+	std::fill(mask_ptr, mask_ptr + bit_mask_size(size), 0);
+	size_t res = 0;
+	scan_impl<V>(ptr, size,
+	             [&bound_reg](const auto &reg) { return V::lt_mask(reg, bound_reg); },
+	             [bound](auto element) { return element < bound; },
+	             [&res, mask_ptr](size_t base, uint64_t mask) { res += set_bit_mask(mask_ptr, base, mask); return true; });
+	return res;
+}
+
+/*!
+ * @brief Find a substring of at least 2 bytes by comparing broadcast first and last bytes with two shifted vectors,
+ * so that only positions matching both are verified by memcmp.
+ * @return The position of the first match, or base_size if there is none
+ */
+template<class V>
+inline size_t find_substring_impl(const uint8_t *base_ptr, size_t base_size, const uint8_t *pattern_ptr, size_t pattern_size) {
+	constexpr size_t LANES = V::LANES;
+	static_assert(sizeof(typename V::ValueType) == 1);
+
+	if (base_size < pattern_size) { return base_size; }
+
+	const size_t last_offset  = pattern_size - 1;
+	const size_t end_pos      = base_size - last_offset;
+	const auto   first_reg    = V::set1(pattern_ptr[0]);
+	const auto   last_reg     = V::set1(pattern_ptr[last_offset]);
+
+	auto verify = [&](size_t base, uint64_t mask) -> size_t {
+		for (; mask != 0; mask &= mask - 1) {
+			const size_t pos = base + std::countr_zero(mask);
+			if (std::memcmp(base_ptr + pos + 1, pattern_ptr + 1, pattern_size - 2) == 0) { return pos; }
+		}
+		return base_size;
+	};
+
+	auto candidate_mask = [&](size_t pos) -> uint64_t {
+		return V::eq_mask(V::load(base_ptr + pos), first_reg) & V::eq_mask(V::load(base_ptr + pos + last_offset), last_reg);
+	};
+
+	size_t idx = 0;
+	for (; idx + 2 * LANES <= end_pos; idx += 2 * LANES) {
+		const uint64_t mask_0 = candidate_mask(idx);
+		const uint64_t mask_1 = candidate_mask(idx + LANES);
+		if ((mask_0 | mask_1) == 0) { continue; }
+
+		size_t pos = (mask_0 != 0) ? verify(idx, mask_0) : base_size;
+		if (pos == base_size && mask_1 != 0) { pos = verify(idx + LANES, mask_1); }
+		if (pos != base_size) { return pos; }
+	}
+	for (; idx + LANES <= end_pos; idx += LANES) {
+		const uint64_t mask = candidate_mask(idx);
+		if (mask != 0) {
+			const size_t pos = verify(idx, mask);
+			if (pos != base_size) { return pos; }
+		}
+	}
+
+	if (idx < end_pos) {
+		if (end_pos >= LANES) {
+			// The last vector overlaps positions already checked
+			const size_t tail_start = end_pos - LANES;
+			const uint64_t mask = candidate_mask(tail_start) & ~low_bit_mask(idx - tail_start);
+			return mask != 0 ? verify(tail_start, mask) : base_size;
+		}
+		for (; idx < end_pos; ++idx) {
+			if (base_ptr[idx] == pattern_ptr[0] && base_ptr[idx + last_offset] == pattern_ptr[last_offset]
+			    && std::memcmp(base_ptr + idx + 1, pattern_ptr + 1, pattern_size - 2) == 0) {
+				return idx;
+			}
+		}
+	}
+	return base_size;
+}
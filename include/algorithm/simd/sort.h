@@ -0,0 +1,485 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_ALGORITHM_SIMD_SORT_H
+#define ALGORITHM_ALGORITHM_SIMD_SORT_H
+
+#include <immintrin.h>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <limits>
+
+#include <algorithm/simd/cpu_feature.h>
+#include <algorithm/sort/insert_sort.h>
+
+namespace algorithm::simd {
+
+	/*!
+	 * @brief Types with vectorized sorting networks and partition
+	 */
+	template<class T>
+	concept SortableConcept = std::same_as<T, int32_t> || std::same_as<T, int64_t>
+	                       || std::same_as<T, float> || std::same_as<T, double>;
+
+	/// The max amount of elements sorted by a sorting network
+	inline constexpr size_t SORT_NETWORK_MAX_SIZE = 64;
+
+	/// The value padded after elements, which goes last
+	template<class T>
+	inline constexpr T sort_pad_value() {
+		if constexpr (std::numeric_limits<T>::has_infinity) { return std::numeric_limits<T>::infinity(); }
+		else                                                { return std::numeric_limits<T>::max(); }
+	}
+
+	template<bool LESS_EQUAL, class T>
+	inline T *scalar_partition(T *start_ptr, T *end_ptr, T pivot) {
+		if constexpr (LESS_EQUAL) { return std::partition(start_ptr, end_ptr, [pivot](T value) { return !(pivot < value); }); }
+		else                      { return std::partition(start_ptr, end_ptr, [pivot](T value) { return value < pivot; }); }
+	}
+
+	/*!
+	 * @brief Permutation moving lanes in the mask to the front and the others to the back, both in order.
+	 * Indices are of 32-bit lanes, so that a 64-bit lane takes two of them.
+	 */
+	template<size_t LANES, size_t LANE_BYTES>
+	inline constexpr auto PARTITION_PERMUTE_TABLE = [] {
+		constexpr size_t SUB_LANES = LANE_BYTES / 4;
+
+		std::array<std::array<int32_t, LANES * SUB_LANES>, (1 << LANES)> permute_table{};
+		for (size_t mask = 0; mask < (1 << LANES); ++mask) {
+			size_t pos = 0;
+			for (int pass = 0; pass < 2; ++pass) {
+				for (size_t lane = 0; lane < LANES; ++lane) {
+					if (((mask >> lane) & 1) != static_cast<size_t>(pass == 0)) { continue; }
+					for (size_t sub_lane = 0; sub_lane < SUB_LANES; ++sub_lane) {
+						permute_table[mask][pos * SUB_LANES + sub_lane] = static_cast<int32_t>(lane * SUB_LANES + sub_lane);
+					}
+					++pos;
+				}
+			}
+		}
+		return permute_table;
+	}();
+
+	namespace scalar {
+
+		template<SortableConcept T>
+		inline void sort_network(T *ptr, size_t size) {
+			insert_sort(ptr, ptr + size);
+		}
+
+		template<SortableConcept T>
+		inline T *partition_less(T *start_ptr, T *end_ptr, T pivot) {
+			return scalar_partition<false>(start_ptr, end_ptr, pivot);
+		}
+
+		template<SortableConcept T>
+		inline T *partition_less_equal(T *start_ptr, T *end_ptr, T pivot) {
+			return scalar_partition<true>(start_ptr, end_ptr, pivot);
+		}
+
+	}
+
+#pragma GCC push_options
+#pragma GCC target("avx2,bmi,bmi2,popcnt")
+
+	namespace avx2 {
+
+		template<class T>
+		struct VecTraits;
+
+		/// Select lanes of 32 bits by the bit mask
+		inline __m256i lane_mask_32(uint32_t mask) {
+			const __m256i bit_reg = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+			return _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<int32_t>(mask)), bit_reg), bit_reg);
+		}
+
+		/// Select lanes of 64 bits by the bit mask
+		inline __m256i lane_mask_64(uint32_t mask) {
+			const __m256i bit_reg = _mm256_setr_epi64x(1, 2, 4, 8);
+			return _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(mask), bit_reg), bit_reg);
+		}
+
+		/// Indices of 32-bit lanes, where lane i takes lane i ^ j
+		inline __m256i xor_index(size_t j) {
+			return _mm256_xor_si256(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int32_t>(j)));
+		}
+
+		/// Indices of 32-bit lanes moving lanes in the mask to the front
+		template<size_t LANES>
+		inline __m256i permute_index(uint32_t mask) {
+			return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(PARTITION_PERMUTE_TABLE<LANES, 32 / LANES>[mask].data()));
+		}
+
+		template<>
+		struct VecTraits<int32_t> {
+			using ValueType = int32_t;
+			using Reg       = __m256i;
+
+			static constexpr size_t LANES = 8;
+
+			static Reg load(const ValueType *ptr) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr)); }
+
+			static void store(ValueType *ptr, Reg reg) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr), reg); }
+
+			static Reg set1(ValueType value) { return _mm256_set1_epi32(value); }
+
+			static Reg min(Reg lhs, Reg rhs) { return _mm256_min_epi32(lhs, rhs); }
+
+			static Reg max(Reg lhs, Reg rhs) { return _mm256_max_epi32(lhs, rhs); }
+
+			static Reg shuffle_xor(Reg reg, size_t j) { return _mm256_permutevar8x32_epi32(reg, xor_index(j)); }
+
+			static Reg blend(Reg lhs, Reg rhs, uint32_t mask) { return _mm256_blendv_epi8(lhs, rhs, lane_mask_32(mask)); }
+
+			static uint32_t cmp_lt(Reg reg, Reg pivot) {
+				return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pivot, reg)));
+			}
+
+			static uint32_t cmp_le(Reg reg, Reg pivot) {
+				return ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(reg, pivot))) & 0xFF;
+			}
+
+			static void partition_store(Reg reg, uint32_t mask, [[maybe_unused]] size_t count, ValueType *left_ptr, ValueType *right_ptr) {
+				const Reg permuted = _mm256_permutevar8x32_epi32(reg, permute_index<LANES>(mask));
+				store(left_ptr, permuted);
+				store(right_ptr - LANES, permuted);
+			}
+		};
+
+		template<>
+		struct VecTraits<float> {
+			using ValueType = float;
+			using Reg       = __m256;
+
+			static constexpr size_t LANES = 8;
+
+			static Reg load(const ValueType *ptr) { return _mm256_loadu_ps(ptr); }
+
+			static void store(ValueType *ptr, Reg reg) { _mm256_storeu_ps(ptr, reg); }
+
+			static Reg set1(ValueType value) { return _mm256_set1_ps(value); }
+
+			static Reg min(Reg lhs, Reg rhs) { return _mm256_min_ps(lhs, rhs); }
+
+			static Reg max(Reg lhs, Reg rhs) { return _mm256_max_ps(lhs, rhs); }
+
+			static Reg shuffle_xor(Reg reg, size_t j) { return _mm256_permutevar8x32_ps(reg, xor_index(j)); }
+
+			static Reg blend(Reg lhs, Reg rhs, uint32_t mask) { return _mm256_blendv_ps(lhs, rhs, _mm256_castsi256_ps(lane_mask_32(mask))); }
+
+			static uint32_t cmp_lt(Reg reg, Reg pivot) { return _mm256_movemask_ps(_mm256_cmp_ps(reg, pivot, _CMP_LT_OQ)); }
+
+			static uint32_t cmp_le(Reg reg, Reg pivot) { return ~_mm256_movemask_ps(_mm256_cmp_ps(pivot, reg, _CMP_LT_OQ)) & 0xFF; }
+
+			static void partition_store(Reg reg, uint32_t mask, [[maybe_unused]] size_t count, ValueType *left_ptr, ValueType *right_ptr) {
+				const Reg permuted = _mm256_permutevar8x32_ps(reg, permute_index<LANES>(mask));
+				store(left_ptr, permuted);
+				store(right_ptr - LANES, permuted);
+			}
+		};
+
+		template<>
+		struct VecTraits<int64_t> {
+			using ValueType = int64_t;
+			using Reg       = __m256i;
+
+			static constexpr size_t LANES = 4;
+
+			static Reg load(const ValueType *ptr) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr)); }
+
+			static void store(ValueType *ptr, Reg reg) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr), reg); }
+
+			static Reg set1(ValueType value) { return _mm256_set1_epi64x(value); }
+
+			static Reg min(Reg lhs, Reg rhs) { return _mm256_blendv_epi8(lhs, rhs, _mm256_cmpgt_epi64(lhs, rhs)); }
+
+			static Reg max(Reg lhs, Reg rhs) { return _mm256_blendv_epi8(rhs, lhs, _mm256_cmpgt_epi64(lhs, rhs)); }
+
+			static Reg shuffle_xor(Reg reg, size_t j) { return _mm256_permutevar8x32_epi32(reg, xor_index(j * 2)); }
+
+			static Reg blend(Reg lhs, Reg rhs, uint32_t mask) { return _mm256_blendv_epi8(lhs, rhs, lane_mask_64(mask)); }
+
+			static uint32_t cmp_lt(Reg reg, Reg pivot) {
+				return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(pivot, reg)));
+			}
+
+			static uint32_t cmp_le(Reg reg, Reg pivot) {
+				return ~_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(reg, pivot))) & 0xF;
+			}
+
+			static void partition_store(Reg reg, uint32_t mask, [[maybe_unused]] size_t count, ValueType *left_ptr, ValueType *right_ptr) {
+				const Reg permuted = _mm256_permutevar8x32_epi32(reg, permute_index<LANES>(mask));
+				store(left_ptr, permuted);
+				store(right_ptr - LANES, permuted);
+			}
+		};
+
+		template<>
+		struct VecTraits<double> {
+			using ValueType = double;
+			using Reg       = __m256d;
+
+			static constexpr size_t LANES = 4;
+
+			static Reg load(const ValueType *ptr) { return _mm256_loadu_pd(ptr); }
+
+			static void store(ValueType *ptr, Reg reg) { _mm256_storeu_pd(ptr, reg); }
+
+			static Reg set1(ValueType value) { return _mm256_set1_pd(value); }
+
+			static Reg min(Reg lhs, Reg rhs) { return _mm256_min_pd(lhs, rhs); }
+
+			static Reg max(Reg lhs, Reg rhs) { return _mm256_max_pd(lhs, rhs); }
+
+			static Reg shuffle_xor(Reg reg, size_t j) {
+				return _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(reg), xor_index(j * 2)));
+			}
+
+			static Reg blend(Reg lhs, Reg rhs, uint32_t mask) { return _mm256_blendv_pd(lhs, rhs, _mm256_castsi256_pd(lane_mask_64(mask))); }
+
+			static uint32_t cmp_lt(Reg reg, Reg pivot) { return _mm256_movemask_pd(_mm256_cmp_pd(reg, pivot, _CMP_LT_OQ)); }
+
+			static uint32_t cmp_le(Reg reg, Reg pivot) { return ~_mm256_movemask_pd(_mm256_cmp_pd(pivot, reg, _CMP_LT_OQ)) & 0xF; }
+
+			static void partition_store(Reg reg, uint32_t mask, [[maybe_unused]] size_t count, ValueType *left_ptr, ValueType *right_ptr) {
+				const __m256i index = permute_index<LANES>(mask);
+				const Reg permuted  = _mm256_castps_pd(_mm256_permutevar8x32_ps(_mm256_castpd_ps(reg), index));
+				store(left_ptr, permuted);
+				store(right_ptr - LANES, permuted);
+			}
+		};
+
+#include <algorithm/simd/sort_kernel.h>
+
+		template<SortableConcept T>
+		inline void sort_network(T *ptr, size_t size) {
+			sort_network_impl<VecTraits<T>>(ptr, size);
+		}
+
+		template<SortableConcept T>
+		inline T *partition_less(T *start_ptr, T *end_ptr, T pivot) {
+			return partition_impl<VecTraits<T>, false>(start_ptr, end_ptr, pivot);
+		}
+
+		template<SortableConcept T>
+		inline T *partition_less_equal(T *start_ptr, T *end_ptr, T pivot) {
+			return partition_impl<VecTraits<T>, true>(start_ptr, end_ptr, pivot);
+		}
+
+	}
+
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512bw,avx512vl,avx512dq,avx2,bmi,bmi2,popcnt")
+
+	namespace avx512 {
+
+		template<class T>
+		struct VecTraits;
+
+		/// Indices of 32-bit lanes, where lane i takes lane i ^ j
+		inline __m512i xor_index_32(size_t j) {
+			return _mm512_xor_si512(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+			                        _mm512_set1_epi32(static_cast<int32_t>(j)));
+		}
+
+		/// Indices of 64-bit lanes, where lane i takes lane i ^ j
+		inline __m512i xor_index_64(size_t j) {
+			return _mm512_xor_si512(_mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7), _mm512_set1_epi64(static_cast<int64_t>(j)));
+		}
+
+		template<>
+		struct VecTraits<int32_t> {
+			using ValueType = int32_t;
+			using Reg       = __m512i;
+
+			static constexpr size_t LANES = 16;
+
+			static Reg load(const ValueType *ptr) { return _mm512_loadu_si512(ptr); }
+
+			static void store(ValueType *ptr, Reg reg) { _mm512_storeu_si512(ptr, reg); }
+
+			static Reg set1(ValueType value) { return _mm512_set1_epi32(value); }
+
+			static Reg min(Reg lhs, Reg rhs) { return _mm512_min_epi32(lhs, rhs); }
+
+			static Reg max(Reg lhs, Reg rhs) { return _mm512_max_epi32(lhs, rhs); }
+
+			static Reg shuffle_xor(Reg reg, size_t j) { return _mm512_permutexvar_epi32(xor_index_32(j), reg); }
+
+			static Reg blend(Reg lhs, Reg rhs, uint32_t mask) { return _mm512_mask_blend_epi32(static_cast<__mmask16>(mask), lhs, rhs); }
+
+			static uint32_t cmp_lt(Reg reg, Reg pivot) { return _mm512_cmplt_epi32_mask(reg, pivot); }
+
+			static uint32_t cmp_le(Reg reg, Reg pivot) { return _mm512_cmple_epi32_mask(reg, pivot); }
+
+			static void partition_store(Reg reg, uint32_t mask, size_t count, ValueType *left_ptr, ValueType *right_ptr) {
+				_mm512_mask_compressstoreu_epi32(left_ptr, static_cast<__mmask16>(mask), reg);
+				_mm512_mask_compressstoreu_epi32(right_ptr - (LANES - count), static_cast<__mmask16>(~mask), reg);
+			}
+		};
+
+		template<>
+		struct VecTraits<float> {
+			using ValueType = float;
+			using Reg       = __m512;
+
+			static constexpr size_t LANES = 16;
+
+			static Reg load(const ValueType *ptr) { return _mm512_loadu_ps(ptr); }
+
+			static void store(ValueType *ptr, Reg reg) { _mm512_storeu_ps(ptr, reg); }
+
+			static Reg set1(ValueType value) { return _mm512_set1_ps(value); }
+
+			static Reg min(Reg lhs, Reg rhs) { return _mm512_min_ps(lhs, rhs); }
+
+			static Reg max(Reg lhs, Reg rhs) { return _mm512_max_ps(lhs, rhs); }
+
+			static Reg shuffle_xor(Reg reg, size_t j) { return _mm512_permutexvar_ps(xor_index_32(j), reg); }
+
+			static Reg blend(Reg lhs, Reg rhs, uint32_t mask) { return _mm512_mask_blend_ps(static_cast<__mmask16>(mask), lhs, rhs); }
+
+			static uint32_t cmp_lt(Reg reg, Reg pivot) { return _mm512_cmp_ps_mask(reg, pivot, _CMP_LT_OQ); }
+
+			static uint32_t cmp_le(Reg reg, Reg pivot) { return static_cast<__mmask16>(~_mm512_cmp_ps_mask(pivot, reg, _CMP_LT_OQ)); }
+
+			static void partition_store(Reg reg, uint32_t mask, size_t count, ValueType *left_ptr, ValueType *right_ptr) {
+				_mm512_mask_compressstoreu_ps(left_ptr, static_cast<__mmask16>(mask), reg);
+				_mm512_mask_compressstoreu_ps(right_ptr - (LANES - count), static_cast<__mmask16>(~mask), reg);
+			}
+		};
+
+		template<>
+		struct VecTraits<int64_t> {
+			using ValueType = int64_t;
+			using Reg       = __m512i;
+
+			static constexpr size_t LANES = 8;
+
+			static Reg load(const ValueType *ptr) { return _mm512_loadu_si512(ptr); }
+
+			static void store(ValueType *ptr, Reg reg) { _mm512_storeu_si512(ptr, reg); }
+
+			static Reg set1(ValueType value) { return _mm512_set1_epi64(value); }
+
+			static Reg min(Reg lhs, Reg rhs) { return _mm512_min_epi64(lhs, rhs); }
+
+			static Reg max(Reg lhs, Reg rhs) { return _mm512_max_epi64(lhs, rhs); }
+
+			static Reg shuffle_xor(Reg reg, size_t j) { return _mm512_permutexvar_epi64(xor_index_64(j), reg); }
+
+			static Reg blend(Reg lhs, Reg rhs, uint32_t mask) { return _mm512_mask_blend_epi64(static_cast<__mmask8>(mask), lhs, rhs); }
+
+			static uint32_t cmp_lt(Reg reg, Reg pivot) { return _mm512_cmplt_epi64_mask(reg, pivot); }
+
+			static uint32_t cmp_le(Reg reg, Reg pivot) { return _mm512_cmple_epi64_mask(reg, pivot); }
+
+			static void partition_store(Reg reg, uint32_t mask, size_t count, ValueType *left_ptr, ValueType *right_ptr) {
+				_mm512_mask_compressstoreu_epi64(left_ptr, static_cast<__mmask8>(mask), reg);
+				_mm512_mask_compressstoreu_epi64(right_ptr - (LANES - count), static_cast<__mmask8>(~mask), reg);
+			}
+		};
+
+		template<>
+		struct VecTraits<double> {
+			using ValueType = double;
+			using Reg       = __m512d;
+
+			static constexpr size_t LANES = 8;
+
+			static Reg load(const ValueType *ptr) { return _mm512_loadu_pd(ptr); }
+
+			static void store(ValueType *ptr, Reg reg) { _mm512_storeu_pd(ptr, reg); }
+
+			static Reg set1(ValueType value) { return _mm512_set1_pd(value); }
+
+			static Reg min(Reg lhs, Reg rhs) { return _mm512_min_pd(lhs, rhs); }
+
+			static Reg max(Reg lhs, Reg rhs) { return _mm512_max_pd(lhs, rhs); }
+
+			static Reg shuffle_xor(Reg reg, size_t j) { return _mm512_permutexvar_pd(xor_index_64(j), reg); }
+
+			static Reg blend(Reg lhs, Reg rhs, uint32_t mask) { return _mm512_mask_blend_pd(static_cast<__mmask8>(mask), lhs, rhs); }
+
+			static uint32_t cmp_lt(Reg reg, Reg pivot) { return _mm512_cmp_pd_mask(reg, pivot, _CMP_LT_OQ); }
+
+			static uint32_t cmp_le(Reg reg, Reg pivot) { return static_cast<__mmask8>(~_mm512_cmp_pd_mask(pivot, reg, _CMP_LT_OQ)); }
+
+			static void partition_store(Reg reg, uint32_t mask, size_t count, ValueType *left_ptr, ValueType *right_ptr) {
+				_mm512_mask_compressstoreu_pd(left_ptr, static_cast<__mmask8>(mask), reg);
+				_mm512_mask_compressstoreu_pd(right_ptr - (LANES - count), static_cast<__mmask8>(~mask), reg);
+			}
+		};
+
+#include <algorithm/simd/sort_kernel.h>
+
+		template<SortableConcept T>
+		inline void sort_network(T *ptr, size_t size) {
+			sort_network_impl<VecTraits<T>>(ptr, size);
+		}
+
+		template<SortableConcept T>
+		inline T *partition_less(T *start_ptr, T *end_ptr, T pivot) {
+			return partition_impl<VecTraits<T>, false>(start_ptr, end_ptr, pivot);
+		}
+
+		template<SortableConcept T>
+		inline T *partition_less_equal(T *start_ptr, T *end_ptr, T pivot) {
+			return partition_impl<VecTraits<T>, true>(start_ptr, end_ptr, pivot);
+		}
+
+	}
+
+#pragma GCC pop_options
+
+	/*!
+	 * @brief Sort at most SORT_NETWORK_MAX_SIZE elements by bitonic sorting networks
+	 */
+	template<SortableConcept T>
+	inline void sort_network(T *ptr, size_t size) {
+		switch (get_isa()) {
+			case ISA::AVX512: avx512::sort_network(ptr, size); break;
+			case ISA::AVX2:   avx2::sort_network(ptr, size);   break;
+			default:          scalar::sort_network(ptr, size); break;
+		}
+	}
+
+	/*!
+	 * @brief Partition in place, with elements less than pivot on the left
+	 * @return The start of elements no less than pivot
+	 */
+	template<SortableConcept T>
+	inline T *partition_less(T *start_ptr, T *end_ptr, T pivot) {
+		switch (get_isa()) {
+			case ISA::AVX512: return avx512::partition_less(start_ptr, end_ptr, pivot);
+			case ISA::AVX2:   return avx2::partition_less(start_ptr, end_ptr, pivot);
+			default:          return scalar::partition_less(start_ptr, end_ptr, pivot);
+		}
+	}
+
+	/*!
+	 * @brief Partition in place, with elements no greater than pivot on the left
+	 * @return The start of elements greater than pivot
+	 */
+	template<SortableConcept T>
+	inline T *partition_less_equal(T *start_ptr, T *end_ptr, T pivot) {
+		switch (get_isa()) {
+			case ISA::AVX512: return avx512::partition_less_equal(start_ptr, end_ptr, pivot);
+			case ISA::AVX2:   return avx2::partition_less_equal(start_ptr, end_ptr, pivot);
+			default:          return scalar::partition_less_equal(start_ptr, end_ptr, pivot);
+		}
+	}
+
+}
+
+#endif//ALGORITHM_ALGORITHM_SIMD_SORT_H
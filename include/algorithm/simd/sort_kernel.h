@@ -0,0 +1,169 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+/*
+ * Kernels of sorting generic over vector traits, which are included once per instruction set by simd/sort.h,
+ * inside the namespace and the target region of that instruction set. Hence there is no include guard.
+ *
+ * A vector traits V provides:
+ *   ValueType, Reg, LANES
+ *   load(ptr), store(ptr, reg), set1(value), min(a, b), max(a, b)
+ *   shuffle_xor(reg, j)       Lane i takes lane i ^ j
+ *   blend(a, b, mask)         Lanes with the mask bit set take b
+ *   cmp_lt(reg, pivot), cmp_le(reg, pivot) -> Bit mask of lanes
+ *   partition_store(reg, mask, count, left_ptr, right_ptr)
+ *                             Store lanes in mask at left_ptr, and the others ending at right_ptr,
+ *                             which may write garbage to LANES elements on both sides.
+ */
+
+/*!
+ * @brief Lanes taking the max in a step of bitonic sort, where the pair (i, i ^ j) is sorted descending if i & k
+ */
+inline constexpr uint32_t bitonic_max_mask(size_t base, size_t lanes, size_t j, size_t k) {
+	uint32_t mask = 0;
+	for (size_t lane = 0; lane < lanes; ++lane) {
+		const size_t idx = base + lane;
+		if (((idx & j) != 0) != ((idx & k) != 0)) { mask |= uint32_t(1) << lane; }
+	}
+	return mask;
+}
+
+/*!
+ * @brief Bitonic sort on REG_AMOUNT registers, with steps crossing registers done by min/max between registers,
+ * and the others by shuffling inside registers.
+ */
+template<class V, size_t REG_AMOUNT>
+inline void bitonic_sort_reg(typename V::Reg *reg_array) {
+	constexpr size_t LANES = V::LANES;
+	constexpr size_t SIZE  = LANES * REG_AMOUNT;
+
+	for (size_t k = 2; k <= SIZE; k *= 2) {
+		for (size_t j = k / 2; j > 0; j /= 2) {
+			if (j >= LANES) {
+				const size_t reg_j = j / LANES;
+				for (size_t reg_idx = 0; reg_idx < REG_AMOUNT; ++reg_idx) {
+					const size_t partner_idx = reg_idx ^ reg_j;
+					if (partner_idx < reg_idx) { continue; }
+
+					const auto min_reg = V::min(reg_array[reg_idx], reg_array[partner_idx]);
+					const auto max_reg = V::max(reg_array[reg_idx], reg_array[partner_idx]);
+					const bool descend = ((reg_idx * LANES) & k) != 0;
+					reg_array[reg_idx]     = descend ? max_reg : min_reg;
+					reg_array[partner_idx] = descend ? min_reg : max_reg;
+				}
+			}
+			else {
+				for (size_t reg_idx = 0; reg_idx < REG_AMOUNT; ++reg_idx) {
+					const auto partner_reg = V::shuffle_xor(reg_array[reg_idx], j);
+					const auto min_reg     = V::min(reg_array[reg_idx], partner_reg);
+					const auto max_reg     = V::max(reg_array[reg_idx], partner_reg);
+					reg_array[reg_idx] = V::blend(min_reg, max_reg, bitonic_max_mask(reg_idx * LANES, LANES, j, k));
+				}
+			}
+		}
+	}
+}
+
+template<class V, size_t REG_AMOUNT>
+inline void sort_network_fixed(typename V::ValueType *buffer_ptr) {
+	typename V::Reg reg_array[REG_AMOUNT];
+	for (size_t reg_idx = 0; reg_idx < REG_AMOUNT; ++reg_idx) {
+		reg_array[reg_idx] = V::load(buffer_ptr + reg_idx * V::LANES);
+	}
+	bitonic_sort_reg<V, REG_AMOUNT>(reg_array);
+	for (size_t reg_idx = 0; reg_idx < REG_AMOUNT; ++reg_idx) {
+		V::store(buffer_ptr + reg_idx * V::LANES, reg_array[reg_idx]);
+	}
+}
+
+/*!
+ * @brief Sort at most SORT_NETWORK_MAX_SIZE elements, which are padded by the max value to a power of two
+ */
+template<class V>
+inline void sort_network_impl(typename V::ValueType *ptr, size_t size) {
+	using T = typename V::ValueType;
+	constexpr size_t LANES = V::LANES;
+
+	if (size <= 1) { return; }
+
+	alignas(64) T buffer[SORT_NETWORK_MAX_SIZE];
+	const size_t padded_size = std::max(LANES, std::bit_ceil(size));
+	std::copy(ptr, ptr + size, buffer);
+	std::fill(buffer + size, buffer + padded_size, sort_pad_value<T>());
+
+	// Only networks within the max size are instantiated.
+	switch (padded_size / LANES) {
+		case 1:  sort_network_fixed<V, 1>(buffer); break;
+		case 2:  if constexpr (LANES * 2 <= SORT_NETWORK_MAX_SIZE)  { sort_network_fixed<V, 2>(buffer); }  break;
+		case 4:  if constexpr (LANES * 4 <= SORT_NETWORK_MAX_SIZE)  { sort_network_fixed<V, 4>(buffer); }  break;
+		case 8:  if constexpr (LANES * 8 <= SORT_NETWORK_MAX_SIZE)  { sort_network_fixed<V, 8>(buffer); }  break;
+		case 16: if constexpr (LANES * 16 <= SORT_NETWORK_MAX_SIZE) { sort_network_fixed<V, 16>(buffer); } break;
+		default: break;
+	}
+	std::copy(buffer, buffer + size, ptr);
+}
+
+/*!
+ * @brief In-place partition, with vectors from both ends kept aside to open a gap of 2 * LANES,
+ * and each vector read from the side of less room, so that stores never overtake reads.
+ * @tparam LESS_EQUAL Whether elements equal to pivot go to the left
+ * @return The start of the right part
+ */
+template<class V, bool LESS_EQUAL>
+inline typename V::ValueType *partition_impl(typename V::ValueType *start_ptr, typename V::ValueType *end_ptr, typename V::ValueType pivot) {
+	using T = typename V::ValueType;
+	constexpr size_t LANES = V::LANES;
+
+	if (static_cast<size_t>(end_ptr - start_ptr) < 2 * LANES) {
+		return scalar_partition<LESS_EQUAL>(start_ptr, end_ptr, pivot);
+	}
+
+	const auto pivot_reg = V::set1(pivot);
+	auto split_mask = [&pivot_reg](const auto &reg) {
+		if constexpr (LESS_EQUAL) { return V::cmp_le(reg, pivot_reg); }
+		else                      { return V::cmp_lt(reg, pivot_reg); }
+	};
+
+	const auto left_reg  = V::load(start_ptr);
+	const auto right_reg = V::load(end_ptr - LANES);
+
+	T *read_left_ptr   = start_ptr + LANES;
+	T *read_right_ptr  = end_ptr - LANES;
+	T *store_left_ptr  = start_ptr;
+	T *store_right_ptr = end_ptr;
+
+	while (static_cast<size_t>(read_right_ptr - read_left_ptr) >= LANES) {
+		typename V::Reg reg;
+		if (read_left_ptr - store_left_ptr <= store_right_ptr - read_right_ptr) {
+			reg = V::load(read_left_ptr);
+			read_left_ptr += LANES;
+		}
+		else {
+			read_right_ptr -= LANES;
+			reg = V::load(read_right_ptr);
+		}
+
+		const uint32_t mask  = split_mask(reg);
+		const size_t   count = std::popcount(mask);
+		V::partition_store(reg, mask, count, store_left_ptr, store_right_ptr);
+		store_left_ptr  += count;
+		store_right_ptr -= LANES - count;
+	}
+
+	// The rest and the vectors kept aside fill the gap exactly.
+	alignas(64) T rest_array[3 * LANES];
+	const size_t rest_size = read_right_ptr - read_left_ptr;
+	std::copy(read_left_ptr, read_right_ptr, rest_array);
+	V::store(rest_array + rest_size, left_reg);
+	V::store(rest_array + rest_size + LANES, right_reg);
+
+	for (size_t idx = 0; idx < rest_size + 2 * LANES; ++idx) {
+		const T value = rest_array[idx];
+		const bool go_left = LESS_EQUAL ? !(pivot < value) : (value < pivot);
+		if (go_left) { *store_left_ptr++ = value; }
+		else         { *--store_right_ptr = value; }
+	}
+	return store_left_ptr;
+}
@@ -0,0 +1,61 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_ALGORITHM_SORT_HEAP_SORT_H
+#define ALGORITHM_ALGORITHM_SORT_HEAP_SORT_H
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace algorithm {
+
+	inline namespace sort {
+
+		/*!
+		 * @brief Move the element at hole down until the max-heap of [start_iter, start_iter + size) holds
+		 */
+		template<class Iterator, class Cmp>
+		inline void heap_sift_down(Iterator start_iter, size_t hole_idx, size_t size, Cmp cmp_func) {
+			auto value = std::move(start_iter[hole_idx]);
+			while (true) {
+				size_t child_idx = hole_idx * 2 + 1;
+				if (child_idx >= size) { break; }
+				if (child_idx + 1 < size && cmp_func(start_iter[child_idx], start_iter[child_idx + 1])) {
+					++child_idx;
+				}
+				if (!cmp_func(value, start_iter[child_idx])) { break; }
+
+				start_iter[hole_idx] = std::move(start_iter[child_idx]);
+				hole_idx = child_idx;
+			}
+			start_iter[hole_idx] = std::move(value);
+		}
+
+		template<class Iterator, class Cmp>
+		inline void heap_sort(Iterator start_iter, Iterator end_iter, Cmp cmp_func) {
+			const size_t size = end_iter - start_iter;
+			if (size <= 1) { return; }
+
+			for (size_t idx = size / 2; idx != 0; --idx) {
+				heap_sift_down(start_iter, idx - 1, size, cmp_func);
+			}
+			for (size_t heap_size = size - 1; heap_size != 0; --heap_size) {
+				std::iter_swap(start_iter, start_iter + heap_size);
+				heap_sift_down(start_iter, 0, heap_size, cmp_func);
+			}
+		}
+
+		template<class Iterator>
+		inline void heap_sort(Iterator start_iter, Iterator end_iter) {
+			heap_sort(start_iter, end_iter, std::less<>());
+		}
+
+	}
+}
+
+#endif//ALGORITHM_ALGORITHM_SORT_HEAP_SORT_H
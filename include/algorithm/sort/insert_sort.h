@@ -7,7 +7,9 @@
 #ifndef ALGORITHM_ALGORITHM_SORT_INSERT_SORT_H
 #define ALGORITHM_ALGORITHM_SORT_INSERT_SORT_H
 
-#include <util/compare.h>
+#include <functional>
+#include <iterator>
+#include <utility>
 
 namespace algorithm {
 
@@ -15,22 +17,26 @@ namespace algorithm {
 
 		template<class Iterator, class Cmp>
 		inline void insert_sort(Iterator start_iter, Iterator end_iter, Cmp cmp_func) {
-			for (Iterator iter = start_iter; iter != end_iter; ++iter) {
-				Iterator ultimate_iter = util::func::argidx(iter, end_iter, cmp_func);
-				if (iter != ultimate_iter) {
-					std::swap(*iter, *ultimate_iter);
-				}
+			if (start_iter == end_iter) { return; }
+
+			for (Iterator iter = std::next(start_iter); iter != end_iter; ++iter) {
+				// Shift larger elements right, leaving a hole for the current one
+				if (!cmp_func(*iter, *std::prev(iter))) { continue; }
+
+				auto value = std::move(*iter);
+				Iterator hole_iter = iter;
+				do {
+					Iterator prev_iter = std::prev(hole_iter);
+					*hole_iter = std::move(*prev_iter);
+					hole_iter = prev_iter;
+				} while (hole_iter != start_iter && cmp_func(value, *std::prev(hole_iter)));
+				*hole_iter = std::move(value);
 			}
 		}
 
 		template<class Iterator>
 		inline void insert_sort(Iterator start_iter, Iterator end_iter) {
-			for (Iterator iter = start_iter; iter != end_iter; ++iter) {
-				Iterator ultimate_iter = util::func::argmin(iter, end_iter);
-				if (iter != ultimate_iter) {
-					std::swap(*iter, *ultimate_iter);
-				}
-			}
+			insert_sort(start_iter, end_iter, std::less<>());
 		}
 	}
 
@@ -1,5 +1,5 @@
 /*
- * @author: BL-GS 
+ * @author: BL-GS
  * @date:   2023/5/15
  */
 
@@ -7,19 +7,39 @@
 #ifndef ALGORITHM_ALGORITHM_SORT_MERGE_SORT_H
 #define ALGORITHM_ALGORITHM_SORT_MERGE_SORT_H
 
+#include <cstddef>
+#include <algorithm>
+#include <functional>
 #include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <algorithm/sort/insert_sort.h>
+#include <algorithm/sort/sort_scratch.h>
+#include <thread/thread_pool.h>
 
 namespace algorithm {
 
 	inline namespace sort {
 
-		template<class Iterator, class Cmp>
+		/// Runs of this length are sorted by insert_sort before merging
+		inline constexpr size_t MERGE_SORT_RUN_SIZE           = 32;
+		/// Ranges no longer than this are not split across threads
+		inline constexpr size_t MERGE_SORT_PARALLEL_THRESHOLD = 16 * 1024;
+
+		/*!
+		 * @brief Merge two sorted arrays into the target, where elements of the first one go first on ties.
+		 */
+		template<class Iterator, class TargetIterator, class Cmp>
 		inline void merge_two_array(Iterator first_start_iter, Iterator first_end_iter,
 		                            Iterator second_start_iter, Iterator second_end_iter,
-		                            Iterator target_start_iter,
+		                            TargetIterator target_start_iter,
 		                            Cmp cmp_func) {
 			while (first_start_iter != first_end_iter && second_start_iter != second_end_iter) {
-				if (cmp_func(*first_start_iter, *second_start_iter)) {
+				if (!cmp_func(*second_start_iter, *first_start_iter)) {
 					*target_start_iter = *first_start_iter;
 					++first_start_iter;
 				}
@@ -41,13 +61,13 @@ namespace algorithm {
 			}
 		}
 
-		template<class Iterator, class Cmp>
+		template<class Iterator, class TargetIterator, class Cmp>
 		inline void merge_two_array_move(Iterator first_start_iter, Iterator first_end_iter,
 		                                 Iterator second_start_iter, Iterator second_end_iter,
-		                                 Iterator target_start_iter,
+		                                 TargetIterator target_start_iter,
 		                                 Cmp cmp_func) {
 			while (first_start_iter != first_end_iter && second_start_iter != second_end_iter) {
-				if (cmp_func(*first_start_iter, *second_start_iter)) {
+				if (!cmp_func(*second_start_iter, *first_start_iter)) {
 					*target_start_iter = std::move(*first_start_iter);
 					++first_start_iter;
 				}
@@ -69,6 +89,320 @@ namespace algorithm {
 			}
 		}
 
+		/*!
+		 * @brief Merge each pair of adjacent runs of the width from source to target
+		 */
+		template<class Iterator, class TargetIterator, class Cmp>
+		inline void merge_sort_pass(Iterator src_iter, TargetIterator dst_iter, size_t size, size_t width, Cmp &cmp_func) {
+			for (size_t low = 0; low < size; low += 2 * width) {
+				const size_t mid  = std::min(size, low + width);
+				const size_t high = std::min(size, low + 2 * width);
+				merge_two_array_move(src_iter + low, src_iter + mid, src_iter + mid, src_iter + high, dst_iter + low, cmp_func);
+			}
+		}
+
+		/*!
+		 * @brief Bottom-up merge sort, which ping-pongs between the data and the scratch of equal size.
+		 * @return Whether the result lies in the scratch
+		 */
+		template<class Iterator, class ScratchIterator, class Cmp>
+		inline bool merge_sort_bottom_up(Iterator data_iter, ScratchIterator scratch_iter, size_t size, Cmp &cmp_func) {
+			for (size_t low = 0; low < size; low += MERGE_SORT_RUN_SIZE) {
+				insert_sort(data_iter + low, data_iter + std::min(size, low + MERGE_SORT_RUN_SIZE), cmp_func);
+			}
+
+			bool in_scratch = false;
+			for (size_t width = MERGE_SORT_RUN_SIZE; width < size; width *= 2) {
+				if (in_scratch) { merge_sort_pass(scratch_iter, data_iter, size, width, cmp_func); }
+				else            { merge_sort_pass(data_iter, scratch_iter, size, width, cmp_func); }
+				in_scratch = !in_scratch;
+			}
+			return in_scratch;
+		}
+
+		/*!
+		 * @brief Stable merge sort with one scratch buffer of the range size
+		 * @tparam Allocator The allocator of scratch
+		 */
+		template<class Allocator = DefaultSortAllocator, class Iterator, class Cmp>
+		inline void merge_sort(Iterator start_iter, Iterator end_iter, Cmp cmp_func) {
+			using ValueType   = std::iter_value_t<Iterator>;
+			using ScratchType = SortScratch<Iterator, Allocator>;
+
+			const size_t size = end_iter - start_iter;
+			if (size <= MERGE_SORT_RUN_SIZE) {
+				insert_sort(start_iter, end_iter, cmp_func);
+				return;
+			}
+
+			ScratchType scratch(start_iter, size);
+			ValueType *buffer_ptr = scratch.get_buffer();
+			if constexpr (ScratchType::data_in_scratch()) {
+				if (!merge_sort_bottom_up(buffer_ptr, start_iter, size, cmp_func)) {
+					std::move(buffer_ptr, buffer_ptr + size, start_iter);
+				}
+			}
+			else {
+				if (merge_sort_bottom_up(start_iter, buffer_ptr, size, cmp_func)) {
+					std::move(buffer_ptr, buffer_ptr + size, start_iter);
+				}
+			}
+		}
+
+		template<class Iterator>
+		inline void merge_sort(Iterator start_iter, Iterator end_iter) {
+			merge_sort(start_iter, end_iter, std::less<>());
+		}
+
+		/*!
+		 * @brief Merge each pair of adjacent runs of the width in parallel.
+		 * A pair is cut into pieces by splitting the first run evenly and searching the second run for the bounds.
+		 */
+		template<class Iterator, class TargetIterator, class Cmp>
+		inline void parallel_merge_sort_pass(Iterator src_iter, TargetIterator dst_iter, size_t size, size_t width,
+		                                     Cmp &cmp_func, thread::ThreadPool &pool) {
+			const size_t pair_amount  = (size + 2 * width - 1) / (2 * width);
+			const size_t max_piece    = std::max<size_t>(1, 2 * width / MERGE_SORT_PARALLEL_THRESHOLD);
+			const size_t piece_amount = std::clamp<size_t>((pool.get_worker_amount() * 2 + pair_amount - 1) / pair_amount, 1, max_piece);
+
+			// The start of each piece in both runs, which are searched ahead since merging moves elements out.
+			std::vector<std::pair<size_t, size_t>> bound_array(pair_amount * (piece_amount + 1));
+			for (size_t pair_idx = 0; pair_idx < pair_amount; ++pair_idx) {
+				const size_t low  = pair_idx * 2 * width;
+				const size_t mid  = std::min(size, low + width);
+				const size_t high = std::min(size, low + 2 * width);
+
+				auto *pair_bound_ptr = bound_array.data() + pair_idx * (piece_amount + 1);
+				pair_bound_ptr[0]            = {low, mid};
+				pair_bound_ptr[piece_amount] = {mid, high};
+				for (size_t piece_idx = 1; piece_idx < piece_amount; ++piece_idx) {
+					const size_t first_idx = low + (mid - low) * piece_idx / piece_amount;
+					auto second_iter = std::lower_bound(src_iter + mid, src_iter + high, src_iter[first_idx],
+					                                    [&cmp_func](const auto &lhs, const auto &rhs) { return cmp_func(lhs, rhs); });
+					pair_bound_ptr[piece_idx] = {first_idx, static_cast<size_t>(second_iter - src_iter)};
+				}
+			}
+
+			pool.parallel_for(0, pair_amount * piece_amount, [&](size_t task_idx) {
+				const size_t pair_idx  = task_idx / piece_amount;
+				const size_t piece_idx = task_idx % piece_amount;
+				const size_t mid       = std::min(size, pair_idx * 2 * width + width);
+
+				const auto *pair_bound_ptr             = bound_array.data() + pair_idx * (piece_amount + 1);
+				const auto [first_start, second_start] = pair_bound_ptr[piece_idx];
+				const auto [first_end, second_end]     = pair_bound_ptr[piece_idx + 1];
+				merge_two_array_move(src_iter + first_start, src_iter + first_end,
+				                     src_iter + second_start, src_iter + second_end,
+				                     dst_iter + (first_start + second_start - mid), cmp_func);
+			}, 1);
+		}
+
+		/*!
+		 * @return Whether the result lies in the scratch
+		 */
+		template<class Iterator, class ScratchIterator, class Cmp>
+		inline bool parallel_merge_sort_bottom_up(Iterator data_iter, ScratchIterator scratch_iter, size_t size,
+		                                          Cmp &cmp_func, thread::ThreadPool &pool) {
+			// Chunks are sorted independently, with results gathered back into the data.
+			const size_t chunk_amount = pool.get_worker_amount() * 2;
+			const size_t chunk_size   = std::max(MERGE_SORT_PARALLEL_THRESHOLD, (size + chunk_amount - 1) / chunk_amount);
+			pool.parallel_for(0, (size + chunk_size - 1) / chunk_size, [&](size_t chunk_idx) {
+				const size_t low        = chunk_idx * chunk_size;
+				const size_t chunk_span = std::min(size, low + chunk_size) - low;
+				if (merge_sort_bottom_up(data_iter + low, scratch_iter + low, chunk_span, cmp_func)) {
+					std::move(scratch_iter + low, scratch_iter + (low + chunk_span), data_iter + low);
+				}
+			}, 1);
+
+			bool in_scratch = false;
+			for (size_t width = chunk_size; width < size; width *= 2) {
+				if (in_scratch) { parallel_merge_sort_pass(scratch_iter, data_iter, size, width, cmp_func, pool); }
+				else            { parallel_merge_sort_pass(data_iter, scratch_iter, size, width, cmp_func, pool); }
+				in_scratch = !in_scratch;
+			}
+			return in_scratch;
+		}
+
+		/*!
+		 * @brief Stable bottom-up merge sort, with chunks sorted and runs merged across workers of the pool
+		 * @note The comparator is shared by all workers, which should be safe to call concurrently.
+		 */
+		template<class Allocator = DefaultSortAllocator, class Iterator, class Cmp>
+		inline void parallel_merge_sort(Iterator start_iter, Iterator end_iter, Cmp cmp_func, thread::ThreadPool &pool) {
+			using ValueType   = std::iter_value_t<Iterator>;
+			using ScratchType = SortScratch<Iterator, Allocator>;
+
+			const size_t size = end_iter - start_iter;
+			if (size <= MERGE_SORT_PARALLEL_THRESHOLD) {
+				merge_sort<Allocator>(start_iter, end_iter, cmp_func);
+				return;
+			}
+
+			ScratchType scratch(start_iter, size);
+			ValueType *buffer_ptr = scratch.get_buffer();
+			if constexpr (ScratchType::data_in_scratch()) {
+				if (!parallel_merge_sort_bottom_up(buffer_ptr, start_iter, size, cmp_func, pool)) {
+					std::move(buffer_ptr, buffer_ptr + size, start_iter);
+				}
+			}
+			else {
+				if (parallel_merge_sort_bottom_up(start_iter, buffer_ptr, size, cmp_func, pool)) {
+					std::move(buffer_ptr, buffer_ptr + size, start_iter);
+				}
+			}
+		}
+
+		template<class Allocator = DefaultSortAllocator, class Iterator, class Cmp>
+		inline void parallel_merge_sort(Iterator start_iter, Iterator end_iter, Cmp cmp_func) {
+			parallel_merge_sort<Allocator>(start_iter, end_iter, cmp_func, thread::get_default_thread_pool());
+		}
+
+		template<class Iterator>
+		inline void parallel_merge_sort(Iterator start_iter, Iterator end_iter) {
+			parallel_merge_sort(start_iter, end_iter, std::less<>());
+		}
+
+		/*!
+		 * @brief Loser tree over k sorted runs, which yields the least head in log(k) comparisons per element.
+		 * Runs are only read forward, so that they can be streams of segments, and ties go to the run added first.
+		 * @tparam Iterator Input iterator of runs
+		 */
+		template<class Iterator, class Cmp = std::less<>>
+		class LoserTree {
+		public:
+			using ValueType = std::iter_value_t<Iterator>;
+
+		private:
+			struct Run {
+				Iterator cur_iter_;
+				Iterator end_iter_;
+			};
+
+			Cmp cmp_func_;
+
+			std::vector<Run> run_array_;
+			/// Losers of inner nodes in [1, k), with the overall winner at 0
+			std::vector<size_t> tree_array_;
+
+		public:
+			explicit LoserTree(Cmp cmp_func = Cmp()): cmp_func_(cmp_func) {}
+
+			/*!
+			 * @param run_range A range of pairs of iterators, each of which bounds a sorted run
+			 */
+			template<std::ranges::input_range RunRange>
+			explicit LoserTree(const RunRange &run_range, Cmp cmp_func = Cmp()): cmp_func_(cmp_func) {
+				for (const auto &[start_iter, end_iter]: run_range) {
+					run_array_.push_back({start_iter, end_iter});
+				}
+				rebuild();
+			}
+
+		public:
+			/*!
+			 * @brief Add a run, which takes O(k) to rebuild the tree
+			 */
+			void add_run(Iterator start_iter, Iterator end_iter) {
+				run_array_.push_back({start_iter, end_iter});
+				rebuild();
+			}
+
+			[[nodiscard]] bool empty() const {
+				return run_array_.empty() || exhausted(tree_array_[0]);
+			}
+
+			/*!
+			 * @brief Acquire the least head among all runs
+			 */
+			[[nodiscard]] decltype(auto) top() const {
+				return *run_array_[tree_array_[0]].cur_iter_;
+			}
+
+			/*!
+			 * @brief Acquire the index of run holding the least head
+			 */
+			[[nodiscard]] size_t top_run() const {
+				return tree_array_[0];
+			}
+
+			/*!
+			 * @brief Advance the run holding the least head, and replay the matches on its path.
+			 */
+			void pop() {
+				const size_t run_amount = run_array_.size();
+				size_t winner_idx = tree_array_[0];
+				++run_array_[winner_idx].cur_iter_;
+
+				for (size_t node_idx = (winner_idx + run_amount) / 2; node_idx > 0; node_idx /= 2) {
+					if (beat(tree_array_[node_idx], winner_idx)) {
+						std::swap(tree_array_[node_idx], winner_idx);
+					}
+				}
+				tree_array_[0] = winner_idx;
+			}
+
+		private:
+			[[nodiscard]] bool exhausted(size_t run_idx) const {
+				return run_array_[run_idx].cur_iter_ == run_array_[run_idx].end_iter_;
+			}
+
+			/// Whether the head of the first run goes before that of the second one
+			[[nodiscard]] bool beat(size_t first_idx, size_t second_idx) const {
+				if (exhausted(first_idx))  { return exhausted(second_idx) && first_idx < second_idx; }
+				if (exhausted(second_idx)) { return true; }
+
+				const auto &first_value  = *run_array_[first_idx].cur_iter_;
+				const auto &second_value = *run_array_[second_idx].cur_iter_;
+				if (cmp_func_(first_value, second_value)) { return true; }
+				if (cmp_func_(second_value, first_value)) { return false; }
+				return first_idx < second_idx;
+			}
+
+			/// Play the matches below the node, with leaves placed at [k, 2k)
+			size_t build(size_t node_idx) {
+				const size_t run_amount = run_array_.size();
+				if (node_idx >= run_amount) { return node_idx - run_amount; }
+
+				size_t left_winner  = build(node_idx * 2);
+				size_t right_winner = build(node_idx * 2 + 1);
+				if (beat(left_winner, right_winner)) {
+					tree_array_[node_idx] = right_winner;
+					return left_winner;
+				}
+				tree_array_[node_idx] = left_winner;
+				return right_winner;
+			}
+
+			void rebuild() {
+				tree_array_.assign(std::max<size_t>(1, run_array_.size()), 0);
+				if (!run_array_.empty()) {
+					tree_array_[0] = build(1);
+				}
+			}
+		};
+
+		/*!
+		 * @brief Merge k sorted runs into the output by a loser tree, stable across runs in the given order
+		 * @return The end of output
+		 */
+		template<std::ranges::input_range RunRange, class OutputIterator, class Cmp>
+		inline OutputIterator kway_merge(const RunRange &run_range, OutputIterator output_iter, Cmp cmp_func) {
+			using Iterator = typename std::ranges::range_value_t<RunRange>::first_type;
+
+			LoserTree<Iterator, Cmp> loser_tree(run_range, cmp_func);
+			while (!loser_tree.empty()) {
+				*output_iter = loser_tree.top();
+				++output_iter;
+				loser_tree.pop();
+			}
+			return output_iter;
+		}
+
+		template<std::ranges::input_range RunRange, class OutputIterator>
+		inline OutputIterator kway_merge(const RunRange &run_range, OutputIterator output_iter) {
+			return kway_merge(run_range, output_iter, std::less<>());
+		}
+
 	}
 
 }
@@ -1,5 +1,5 @@
 /*
- * @author: BL-GS 
+ * @author: BL-GS
  * @date:   2023/5/15
  */
 
@@ -7,60 +7,289 @@
 #ifndef ALGORITHM_ALGORITHM_SORT_QUICK_SORT_H
 #define ALGORITHM_ALGORITHM_SORT_QUICK_SORT_H
 
+#include <cstddef>
+#include <bit>
+#include <concepts>
+#include <functional>
 #include <iterator>
+#include <utility>
+
+#include <algorithm/sort/insert_sort.h>
+#include <algorithm/sort/heap_sort.h>
+#include <algorithm/simd/sort.h>
+#include <thread/thread_pool.h>
 
 namespace algorithm {
 
 	inline namespace sort {
 
+		/// Ranges no longer than this are sorted by insert_sort
+		inline constexpr size_t QUICK_SORT_INSERT_THRESHOLD   = 24;
+		/// Ranges longer than this take the ninther as pivot, rather than the median of three
+		inline constexpr size_t QUICK_SORT_NINTHER_THRESHOLD  = 128;
+		/// Ranges no longer than this are not split across threads
+		inline constexpr size_t QUICK_SORT_PARALLEL_THRESHOLD = 16 * 1024;
+
+		/*!
+		 * @brief Sort three elements, so that the median is placed at the second one
+		 */
+		template<class Iterator, class Cmp>
+		inline void quick_sort_three(Iterator first_iter, Iterator second_iter, Iterator third_iter, Cmp &cmp_func) {
+			if (cmp_func(*second_iter, *first_iter)) { std::iter_swap(first_iter, second_iter); }
+			if (cmp_func(*third_iter, *second_iter)) {
+				std::iter_swap(second_iter, third_iter);
+				if (cmp_func(*second_iter, *first_iter)) { std::iter_swap(first_iter, second_iter); }
+			}
+		}
+
+		/*!
+		 * @brief Move the pivot to the start, which is the median of three or the ninther (median of medians).
+		 * An element no less than the pivot is left in the range behind it, as the sentinel of partition.
+		 */
+		template<class Iterator, class Cmp>
+		inline void quick_sort_pivot(Iterator start_iter, Iterator end_iter, Cmp &cmp_func) {
+			const size_t size = end_iter - start_iter;
+			const size_t half = size / 2;
+
+			if (size > QUICK_SORT_NINTHER_THRESHOLD) {
+				quick_sort_three(start_iter, start_iter + half, end_iter - 1, cmp_func);
+				quick_sort_three(start_iter + 1, start_iter + (half - 1), end_iter - 2, cmp_func);
+				quick_sort_three(start_iter + 2, start_iter + (half + 1), end_iter - 3, cmp_func);
+				quick_sort_three(start_iter + (half - 1), start_iter + half, start_iter + (half + 1), cmp_func);
+				std::iter_swap(start_iter, start_iter + half);
+			}
+			else {
+				quick_sort_three(start_iter + half, start_iter, end_iter - 1, cmp_func);
+			}
+		}
+
+		/*!
+		 * @brief Partition around the pivot at the start, with less elements on the left and the others on the right.
+		 * @return The final position of pivot
+		 */
+		template<class Iterator, class Cmp>
+		inline Iterator quick_sort_partition(Iterator start_iter, Iterator end_iter, Cmp &cmp_func) {
+			auto pivot = std::move(*start_iter);
+
+			Iterator first_iter = start_iter;
+			Iterator last_iter  = end_iter;
+			// An element no less than pivot lies behind, so that no bound check is needed.
+			while (cmp_func(*++first_iter, pivot));
+
+			if (first_iter - 1 == start_iter) {
+				while (first_iter < last_iter && !cmp_func(*--last_iter, pivot));
+			}
+			else {
+				// An element less than pivot lies ahead.
+				while (!cmp_func(*--last_iter, pivot));
+			}
+
+			while (first_iter < last_iter) {
+				std::iter_swap(first_iter, last_iter);
+				while (cmp_func(*++first_iter, pivot));
+				while (!cmp_func(*--last_iter, pivot));
+			}
+
+			Iterator pivot_iter = first_iter - 1;
+			*start_iter = std::move(*pivot_iter);
+			*pivot_iter = std::move(pivot);
+			return pivot_iter;
+		}
+
+		/*!
+		 * @brief Three-way partition for a range no less than the pivot at the start, which arises on duplicates.
+		 * As the less part is empty, elements equal to pivot are gathered on the left, and the greater ones on the right.
+		 * @return The last position of elements equal to pivot
+		 */
 		template<class Iterator, class Cmp>
-		inline Iterator quick_sort_pivot(Iterator start_iter, Iterator end_iter, Cmp cmp_func) {
-			Iterator last_iter = end_iter; --last_iter;
+		inline Iterator quick_sort_partition_equal(Iterator start_iter, Iterator end_iter, Cmp &cmp_func) {
+			auto pivot = std::move(*start_iter);
 
-			if (last_iter == start_iter) { return start_iter; }
+			Iterator first_iter = start_iter;
+			Iterator last_iter  = end_iter;
+			// The sample no greater than pivot lies ahead.
+			while (cmp_func(pivot, *--last_iter));
 
-			Iterator pivot_iter = start_iter; ++start_iter;
-			if (cmp_func(*start_iter, *pivot_iter)) {
-				std::swap(*pivot_iter, *start_iter);
+			if (last_iter + 1 == end_iter) {
+				while (first_iter < last_iter && !cmp_func(pivot, *++first_iter));
+			}
+			else {
+				while (!cmp_func(pivot, *++first_iter));
 			}
 
+			while (first_iter < last_iter) {
+				std::iter_swap(first_iter, last_iter);
+				while (cmp_func(pivot, *--last_iter));
+				while (!cmp_func(pivot, *++first_iter));
+			}
+
+			*start_iter = std::move(*last_iter);
+			*last_iter  = std::move(pivot);
+			return last_iter;
+		}
+
+		/*!
+		 * @brief Whether the range is sorted by the vectorized loop, which holds for arithmetic types in contiguous memory
+		 * compared by std::less
+		 */
+		template<class Iterator, class Cmp>
+		inline constexpr bool QUICK_SORT_SIMD_ENABLE = std::contiguous_iterator<Iterator>
+		                                               && simd::SortableConcept<std::iter_value_t<Iterator>>
+		                                               && (std::same_as<Cmp, std::less<>> || std::same_as<Cmp, std::less<std::iter_value_t<Iterator>>>);
+
+		/*!
+		 * @brief Introsort loop on arithmetic types, with partitions vectorized and small ranges sorted by sorting networks
+		 */
+		template<simd::SortableConcept T>
+		inline void quick_sort_simd_loop(T *start_ptr, T *end_ptr, int depth_limit, bool leftmost) {
+			std::less<> cmp_func;
 			while (true) {
-				while (start_iter != last_iter && cmp_func(*pivot_iter, *last_iter)) {
-					--last_iter;
+				const size_t size = end_ptr - start_ptr;
+				if (size <= simd::SORT_NETWORK_MAX_SIZE) {
+					simd::sort_network(start_ptr, size);
+					return;
+				}
+				if (depth_limit-- == 0) {
+					heap_sort(start_ptr, end_ptr, cmp_func);
+					return;
 				}
-				if (start_iter == last_iter) { break; }
 
-				std::swap(*start_iter, *last_iter);
+				quick_sort_pivot(start_ptr, end_ptr, cmp_func);
+				const T pivot = *start_ptr;
+				if (!leftmost && !(start_ptr[-1] < pivot)) {
+					start_ptr = simd::partition_less_equal(start_ptr + 1, end_ptr, pivot);
+					continue;
+				}
 
-				while (start_iter != last_iter && !cmp_func(*pivot_iter, *start_iter)) {
-					++start_iter;
+				T *pivot_ptr = simd::partition_less(start_ptr + 1, end_ptr, pivot) - 1;
+				std::swap(*start_ptr, *pivot_ptr);
+				if (pivot_ptr - start_ptr < end_ptr - pivot_ptr) {
+					quick_sort_simd_loop(start_ptr, pivot_ptr, depth_limit, leftmost);
+					start_ptr = pivot_ptr + 1;
+					leftmost  = false;
 				}
-				if (start_iter == last_iter) { break; }
+				else {
+					quick_sort_simd_loop(pivot_ptr + 1, end_ptr, depth_limit, false);
+					end_ptr = pivot_ptr;
+				}
+			}
+		}
 
-				std::swap(*start_iter, *last_iter);
+		/*!
+		 * @brief Introsort loop, which recurses into the smaller part and iterates on the larger one.
+		 * @param depth_limit The remaining depth before falling back to heap_sort
+		 * @param leftmost Whether no element lies ahead of the range, otherwise the one ahead is no greater than all
+		 */
+		template<class Iterator, class Cmp>
+		inline void quick_sort_loop(Iterator start_iter, Iterator end_iter, Cmp &cmp_func, int depth_limit, bool leftmost) {
+			if constexpr (QUICK_SORT_SIMD_ENABLE<Iterator, Cmp>) {
+				if (simd::get_isa() != simd::ISA::Scalar) {
+					quick_sort_simd_loop(std::to_address(start_iter), std::to_address(end_iter), depth_limit, leftmost);
+					return;
+				}
 			}
 
-			return last_iter;
+			while (true) {
+				const size_t size = end_iter - start_iter;
+				if (size <= QUICK_SORT_INSERT_THRESHOLD) {
+					insert_sort(start_iter, end_iter, cmp_func);
+					return;
+				}
+				if (depth_limit-- == 0) {
+					heap_sort(start_iter, end_iter, cmp_func);
+					return;
+				}
+
+				quick_sort_pivot(start_iter, end_iter, cmp_func);
+				// The pivot equals the element ahead, so that no element is less than pivot.
+				if (!leftmost && !cmp_func(*(start_iter - 1), *start_iter)) {
+					start_iter = quick_sort_partition_equal(start_iter, end_iter, cmp_func) + 1;
+					continue;
+				}
+
+				Iterator pivot_iter = quick_sort_partition(start_iter, end_iter, cmp_func);
+				if (pivot_iter - start_iter < end_iter - pivot_iter) {
+					quick_sort_loop(start_iter, pivot_iter, cmp_func, depth_limit, leftmost);
+					start_iter = pivot_iter + 1;
+					leftmost   = false;
+				}
+				else {
+					quick_sort_loop(pivot_iter + 1, end_iter, cmp_func, depth_limit, false);
+					end_iter = pivot_iter;
+				}
+			}
+		}
+
+		inline int quick_sort_depth_limit(size_t size) {
+			return 2 * static_cast<int>(std::bit_width(size));
 		}
 
 		template<class Iterator, class Cmp>
 		inline void quick_sort(Iterator start_iter, Iterator end_iter, Cmp cmp_func) {
-			while (true) {
-				size_t count = end_iter - start_iter;
-				if (count <= 1) { break; }
-				
-				Iterator mid_iter = quick_sort_pivot(start_iter, end_iter, cmp_func);
-				// Recursive resolution
-				quick_sort(mid_iter, end_iter, cmp_func);
-				// Iterative resolution
-				end_iter = mid_iter;
-			}
+			const size_t size = end_iter - start_iter;
+			if (size <= 1) { return; }
+
+			quick_sort_loop(start_iter, end_iter, cmp_func, quick_sort_depth_limit(size), true);
 		}
 
 		template<class Iterator>
 		inline void quick_sort(Iterator start_iter, Iterator end_iter) {
-			constexpr std::less<decltype(*start_iter)> cmp_func;
-			quick_sort(start_iter, end_iter, cmp_func);
+			quick_sort(start_iter, end_iter, std::less<>());
+		}
+
+		/*!
+		 * @brief Partition large ranges sequentially, and hand the left parts to other workers
+		 */
+		template<class Iterator, class Cmp>
+		inline void parallel_quick_sort_loop(Iterator start_iter, Iterator end_iter, Cmp &cmp_func, int depth_limit, bool leftmost,
+		                                     thread::ThreadPool &pool, thread::WaitGroup &group) {
+			while (static_cast<size_t>(end_iter - start_iter) > QUICK_SORT_PARALLEL_THRESHOLD) {
+				if (depth_limit-- == 0) {
+					heap_sort(start_iter, end_iter, cmp_func);
+					return;
+				}
+
+				quick_sort_pivot(start_iter, end_iter, cmp_func);
+				if (!leftmost && !cmp_func(*(start_iter - 1), *start_iter)) {
+					start_iter = quick_sort_partition_equal(start_iter, end_iter, cmp_func) + 1;
+					continue;
+				}
+
+				Iterator pivot_iter = quick_sort_partition(start_iter, end_iter, cmp_func);
+				pool.submit(group, [start_iter, pivot_iter, &cmp_func, depth_limit, leftmost, &pool, &group] {
+					parallel_quick_sort_loop(start_iter, pivot_iter, cmp_func, depth_limit, leftmost, pool, group);
+				});
+				start_iter = pivot_iter + 1;
+				leftmost   = false;
+			}
+			quick_sort_loop(start_iter, end_iter, cmp_func, depth_limit, leftmost);
+		}
+
+		/*!
+		 * @brief Quick sort with partitions split across workers of the pool
+		 * @note The comparator is shared by all workers, which should be safe to call concurrently.
+		 */
+		template<class Iterator, class Cmp>
+		inline void parallel_quick_sort(Iterator start_iter, Iterator end_iter, Cmp cmp_func, thread::ThreadPool &pool) {
+			const size_t size = end_iter - start_iter;
+			if (size <= QUICK_SORT_PARALLEL_THRESHOLD) {
+				quick_sort(start_iter, end_iter, cmp_func);
+				return;
+			}
+
+			thread::WaitGroup group;
+			parallel_quick_sort_loop(start_iter, end_iter, cmp_func, quick_sort_depth_limit(size), true, pool, group);
+			pool.wait(group);
+		}
+
+		template<class Iterator, class Cmp>
+		inline void parallel_quick_sort(Iterator start_iter, Iterator end_iter, Cmp cmp_func) {
+			parallel_quick_sort(start_iter, end_iter, cmp_func, thread::get_default_thread_pool());
+		}
+
+		template<class Iterator>
+		inline void parallel_quick_sort(Iterator start_iter, Iterator end_iter) {
+			parallel_quick_sort(start_iter, end_iter, std::less<>());
 		}
 
 	}
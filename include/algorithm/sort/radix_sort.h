@@ -0,0 +1,333 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_ALGORITHM_SORT_RADIX_SORT_H
+#define ALGORITHM_ALGORITHM_SORT_RADIX_SORT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <algorithm/sort/insert_sort.h>
+#include <algorithm/sort/sort_scratch.h>
+#include <thread/thread_pool.h>
+
+namespace algorithm {
+
+	inline namespace sort {
+
+		/// Ranges no longer than this are sorted by insert_sort
+		inline constexpr size_t RADIX_SORT_INSERT_THRESHOLD   = 64;
+		/// Ranges no longer than this are not split across threads
+		inline constexpr size_t RADIX_SORT_PARALLEL_THRESHOLD = 64 * 1024;
+
+		/*!
+		 * @brief Key extractor yielding an integer, which is the element itself by default
+		 */
+		template<class KeyFunc, class Iterator>
+		concept RadixKeyFuncConcept = std::integral<std::remove_cvref_t<std::invoke_result_t<KeyFunc &, std::iter_reference_t<Iterator>>>>;
+
+		template<class KeyFunc, class Iterator>
+		using RadixKeyType = std::make_unsigned_t<std::remove_cvref_t<std::invoke_result_t<KeyFunc &, std::iter_reference_t<Iterator>>>>;
+
+		/*!
+		 * @brief Map the integer to an unsigned one of the same order, with the sign bit flipped for signed integers
+		 */
+		template<std::integral Key>
+		inline constexpr std::make_unsigned_t<Key> radix_key(Key key) {
+			using UnsignedKey = std::make_unsigned_t<Key>;
+			if constexpr (std::is_signed_v<Key>) {
+				return static_cast<UnsignedKey>(key) ^ (UnsignedKey(1) << (sizeof(Key) * 8 - 1));
+			}
+			else {
+				return static_cast<UnsignedKey>(key);
+			}
+		}
+
+		template<size_t DIGIT_BITS, class UnsignedKey>
+		inline constexpr size_t radix_digit(UnsignedKey key, size_t pass_idx) {
+			return static_cast<size_t>(key >> (pass_idx * DIGIT_BITS)) & ((size_t(1) << DIGIT_BITS) - 1);
+		}
+
+		/*!
+		 * @brief Move elements from source to target by the digit of pass, with the start of each bucket given
+		 */
+		template<size_t DIGIT_BITS, class Iterator, class TargetIterator, class KeyFunc>
+		inline void radix_sort_scatter(Iterator src_iter, TargetIterator dst_iter, size_t start, size_t end,
+		                               size_t pass_idx, size_t *offset_ptr, KeyFunc &key_func) {
+			for (size_t idx = start; idx < end; ++idx) {
+				const size_t digit = radix_digit<DIGIT_BITS>(radix_key(key_func(src_iter[idx])), pass_idx);
+				dst_iter[offset_ptr[digit]++] = std::move(src_iter[idx]);
+			}
+		}
+
+		/*!
+		 * @brief LSD radix sort ping-ponging between the data and the scratch, where histograms of all digits are built
+		 * in one read, and passes on which all keys share the digit are skipped.
+		 * @return Whether the result lies in the scratch
+		 */
+		template<size_t DIGIT_BITS, class Iterator, class ScratchIterator, class KeyFunc>
+		inline bool radix_sort_lsd(Iterator data_iter, ScratchIterator scratch_iter, size_t size, KeyFunc &key_func) {
+			using KeyType = RadixKeyType<KeyFunc, Iterator>;
+
+			constexpr size_t BUCKET_AMOUNT = size_t(1) << DIGIT_BITS;
+			constexpr size_t PASS_AMOUNT   = (sizeof(KeyType) * 8 + DIGIT_BITS - 1) / DIGIT_BITS;
+
+			std::vector<size_t> count_array(PASS_AMOUNT * BUCKET_AMOUNT, 0);
+			for (size_t idx = 0; idx < size; ++idx) {
+				const KeyType key = radix_key(key_func(data_iter[idx]));
+				for (size_t pass_idx = 0; pass_idx < PASS_AMOUNT; ++pass_idx) {
+					++count_array[pass_idx * BUCKET_AMOUNT + radix_digit<DIGIT_BITS>(key, pass_idx)];
+				}
+			}
+
+			bool in_scratch = false;
+			for (size_t pass_idx = 0; pass_idx < PASS_AMOUNT; ++pass_idx) {
+				size_t *offset_ptr = count_array.data() + pass_idx * BUCKET_AMOUNT;
+				if (std::find(offset_ptr, offset_ptr + BUCKET_AMOUNT, size) != offset_ptr + BUCKET_AMOUNT) { continue; }
+
+				std::exclusive_scan(offset_ptr, offset_ptr + BUCKET_AMOUNT, offset_ptr, size_t(0));
+				if (in_scratch) { radix_sort_scatter<DIGIT_BITS>(scratch_iter, data_iter, 0, size, pass_idx, offset_ptr, key_func); }
+				else            { radix_sort_scatter<DIGIT_BITS>(data_iter, scratch_iter, 0, size, pass_idx, offset_ptr, key_func); }
+				in_scratch = !in_scratch;
+			}
+			return in_scratch;
+		}
+
+		/*!
+		 * @brief Stable LSD radix sort on integer keys
+		 * @tparam DIGIT_BITS The bits sorted per pass, where 8, 11 and 16 usually fit in L1, L2 and L3 respectively
+		 * @tparam Allocator The allocator of scratch
+		 * @param key_func Extract the integer key from an element, e.g. a field of struct
+		 */
+		template<size_t DIGIT_BITS = 8, class Allocator = DefaultSortAllocator, class Iterator, class KeyFunc = std::identity>
+		    requires RadixKeyFuncConcept<KeyFunc, Iterator>
+		inline void radix_sort(Iterator start_iter, Iterator end_iter, KeyFunc key_func = KeyFunc()) {
+			static_assert(DIGIT_BITS >= 1 && DIGIT_BITS <= 16, "The digit should be no wider than 16 bits");
+			using ValueType   = std::iter_value_t<Iterator>;
+			using ScratchType = SortScratch<Iterator, Allocator>;
+
+			const size_t size = end_iter - start_iter;
+			if (size <= RADIX_SORT_INSERT_THRESHOLD) {
+				insert_sort(start_iter, end_iter, [&key_func](const auto &lhs, const auto &rhs) {
+					return radix_key(key_func(lhs)) < radix_key(key_func(rhs));
+				});
+				return;
+			}
+
+			ScratchType scratch(start_iter, size);
+			ValueType *buffer_ptr = scratch.get_buffer();
+			if constexpr (ScratchType::data_in_scratch()) {
+				if (!radix_sort_lsd<DIGIT_BITS>(buffer_ptr, start_iter, size, key_func)) {
+					std::move(buffer_ptr, buffer_ptr + size, start_iter);
+				}
+			}
+			else {
+				if (radix_sort_lsd<DIGIT_BITS>(start_iter, buffer_ptr, size, key_func)) {
+					std::move(buffer_ptr, buffer_ptr + size, start_iter);
+				}
+			}
+		}
+
+		/*!
+		 * @brief LSD radix sort with each pass split into chunks: chunks count digits in parallel,
+		 * a prefix sum in (digit, chunk) order gives every chunk its own offsets, and chunks scatter in parallel.
+		 * @return Whether the result lies in the scratch
+		 */
+		template<size_t DIGIT_BITS, class Iterator, class ScratchIterator, class KeyFunc>
+		inline bool parallel_radix_sort_lsd(Iterator data_iter, ScratchIterator scratch_iter, size_t size,
+		                                    KeyFunc &key_func, thread::ThreadPool &pool) {
+			using KeyType = RadixKeyType<KeyFunc, Iterator>;
+
+			constexpr size_t BUCKET_AMOUNT = size_t(1) << DIGIT_BITS;
+			constexpr size_t PASS_AMOUNT   = (sizeof(KeyType) * 8 + DIGIT_BITS - 1) / DIGIT_BITS;
+
+			const size_t chunk_amount = std::min(pool.get_worker_amount(), (size + RADIX_SORT_PARALLEL_THRESHOLD - 1) / RADIX_SORT_PARALLEL_THRESHOLD);
+			const size_t chunk_size   = (size + chunk_amount - 1) / chunk_amount;
+			std::vector<size_t> count_array(chunk_amount * BUCKET_AMOUNT);
+
+			bool in_scratch = false;
+			for (size_t pass_idx = 0; pass_idx < PASS_AMOUNT; ++pass_idx) {
+				std::fill(count_array.begin(), count_array.end(), 0);
+				pool.parallel_for(0, chunk_amount, [&](size_t chunk_idx) {
+					size_t *chunk_count_ptr = count_array.data() + chunk_idx * BUCKET_AMOUNT;
+					const size_t end = std::min(size, (chunk_idx + 1) * chunk_size);
+					for (size_t idx = chunk_idx * chunk_size; idx < end; ++idx) {
+						const KeyType key = in_scratch ? radix_key(key_func(scratch_iter[idx])) : radix_key(key_func(data_iter[idx]));
+						++chunk_count_ptr[radix_digit<DIGIT_BITS>(key, pass_idx)];
+					}
+				}, 1);
+
+				size_t offset = 0;
+				bool skip_pass = false;
+				for (size_t digit = 0; digit < BUCKET_AMOUNT && !skip_pass; ++digit) {
+					const size_t digit_start = offset;
+					for (size_t chunk_idx = 0; chunk_idx < chunk_amount; ++chunk_idx) {
+						size_t &count = count_array[chunk_idx * BUCKET_AMOUNT + digit];
+						offset += std::exchange(count, offset);
+					}
+					skip_pass = (offset - digit_start == size);
+				}
+				if (skip_pass) { continue; }
+
+				pool.parallel_for(0, chunk_amount, [&](size_t chunk_idx) {
+					size_t *chunk_offset_ptr = count_array.data() + chunk_idx * BUCKET_AMOUNT;
+					const size_t start = chunk_idx * chunk_size;
+					const size_t end   = std::min(size, start + chunk_size);
+					if (in_scratch) { radix_sort_scatter<DIGIT_BITS>(scratch_iter, data_iter, start, end, pass_idx, chunk_offset_ptr, key_func); }
+					else            { radix_sort_scatter<DIGIT_BITS>(data_iter, scratch_iter, start, end, pass_idx, chunk_offset_ptr, key_func); }
+				}, 1);
+				in_scratch = !in_scratch;
+			}
+			return in_scratch;
+		}
+
+		/*!
+		 * @brief Stable LSD radix sort on integer keys, with histograms and scatters split across workers of the pool
+		 * @note The key extractor is shared by all workers, which should be safe to call concurrently.
+		 */
+		template<size_t DIGIT_BITS = 8, class Allocator = DefaultSortAllocator, class Iterator, class KeyFunc>
+		    requires RadixKeyFuncConcept<KeyFunc, Iterator>
+		inline void parallel_radix_sort(Iterator start_iter, Iterator end_iter, KeyFunc key_func, thread::ThreadPool &pool) {
+			static_assert(DIGIT_BITS >= 1 && DIGIT_BITS <= 16, "The digit should be no wider than 16 bits");
+			using ValueType   = std::iter_value_t<Iterator>;
+			using ScratchType = SortScratch<Iterator, Allocator>;
+
+			const size_t size = end_iter - start_iter;
+			if (size <= RADIX_SORT_PARALLEL_THRESHOLD) {
+				radix_sort<DIGIT_BITS, Allocator>(start_iter, end_iter, key_func);
+				return;
+			}
+
+			ScratchType scratch(start_iter, size);
+			ValueType *buffer_ptr = scratch.get_buffer();
+			if constexpr (ScratchType::data_in_scratch()) {
+				if (!parallel_radix_sort_lsd<DIGIT_BITS>(buffer_ptr, start_iter, size, key_func, pool)) {
+					std::move(buffer_ptr, buffer_ptr + size, start_iter);
+				}
+			}
+			else {
+				if (parallel_radix_sort_lsd<DIGIT_BITS>(start_iter, buffer_ptr, size, key_func, pool)) {
+					std::move(buffer_ptr, buffer_ptr + size, start_iter);
+				}
+			}
+		}
+
+		template<size_t DIGIT_BITS = 8, class Allocator = DefaultSortAllocator, class Iterator, class KeyFunc = std::identity>
+		    requires RadixKeyFuncConcept<KeyFunc, Iterator>
+		inline void parallel_radix_sort(Iterator start_iter, Iterator end_iter, KeyFunc key_func = KeyFunc()) {
+			parallel_radix_sort<DIGIT_BITS, Allocator>(start_iter, end_iter, key_func, thread::get_default_thread_pool());
+		}
+
+		/*!
+		 * @brief View a contiguous range of byte-sized elements as unsigned bytes,
+		 * e.g. std::string, std::string_view, or std::array<char, N> for fixed-width keys.
+		 */
+		template<std::ranges::contiguous_range ByteRange>
+		    requires (sizeof(std::ranges::range_value_t<ByteRange>) == 1)
+		inline std::span<const uint8_t> radix_byte_view(const ByteRange &byte_range) {
+			return {reinterpret_cast<const uint8_t *>(std::ranges::data(byte_range)), std::ranges::size(byte_range)};
+		}
+
+		/*!
+		 * @brief Compare two byte strings from the depth on, with a prefix going first
+		 */
+		inline bool radix_byte_less(std::span<const uint8_t> lhs, std::span<const uint8_t> rhs, size_t depth) {
+			const size_t lhs_size = lhs.size() - depth;
+			const size_t rhs_size = rhs.size() - depth;
+			const int res = std::memcmp(lhs.data() + depth, rhs.data() + depth, std::min(lhs_size, rhs_size));
+			return res < 0 || (res == 0 && lhs_size < rhs_size);
+		}
+
+		/*!
+		 * @brief In-place MSD radix sort (American flag sort) on byte strings sharing the first depth bytes.
+		 * Bucket 0 collects strings ending at the depth, and small buckets are left to insert_sort.
+		 */
+		template<class Iterator, class KeyFunc>
+		inline void msd_radix_sort_loop(Iterator start_iter, Iterator end_iter, size_t depth, KeyFunc &key_func) {
+			constexpr size_t BUCKET_AMOUNT = 257;
+
+			auto bucket_of = [&key_func, depth](const auto &value) -> size_t {
+				const auto &key_value = key_func(value);
+				auto key = radix_byte_view(key_value);
+				return depth < key.size() ? static_cast<size_t>(key[depth]) + 1 : 0;
+			};
+
+			while (true) {
+				const size_t size = end_iter - start_iter;
+				if (size <= RADIX_SORT_INSERT_THRESHOLD) {
+					insert_sort(start_iter, end_iter, [&key_func, depth](const auto &lhs, const auto &rhs) {
+						return radix_byte_less(radix_byte_view(key_func(lhs)), radix_byte_view(key_func(rhs)), depth);
+					});
+					return;
+				}
+
+				std::array<size_t, BUCKET_AMOUNT> count_array{};
+				for (Iterator iter = start_iter; iter != end_iter; ++iter) {
+					++count_array[bucket_of(*iter)];
+				}
+
+				// All strings share the byte, so that we go deeper directly.
+				if (count_array[0] == size) { return; }
+				if (std::find(count_array.begin() + 1, count_array.end(), size) != count_array.end()) {
+					++depth;
+					continue;
+				}
+
+				std::array<size_t, BUCKET_AMOUNT> head_array;
+				std::array<size_t, BUCKET_AMOUNT> tail_array;
+				std::exclusive_scan(count_array.begin(), count_array.end(), head_array.begin(), size_t(0));
+				std::inclusive_scan(count_array.begin(), count_array.end(), tail_array.begin());
+
+				// Cycle each misplaced element to the head of its bucket
+				for (size_t bucket = 0; bucket < BUCKET_AMOUNT; ++bucket) {
+					while (head_array[bucket] < tail_array[bucket]) {
+						const size_t target = bucket_of(start_iter[head_array[bucket]]);
+						if (target == bucket) {
+							++head_array[bucket];
+						}
+						else {
+							std::iter_swap(start_iter + head_array[bucket], start_iter + head_array[target]++);
+						}
+					}
+				}
+
+				size_t bucket_start = count_array[0];
+				for (size_t bucket = 1; bucket < BUCKET_AMOUNT; ++bucket) {
+					if (count_array[bucket] > 1) {
+						msd_radix_sort_loop(start_iter + bucket_start, start_iter + (bucket_start + count_array[bucket]), depth + 1, key_func);
+					}
+					bucket_start += count_array[bucket];
+				}
+				return;
+			}
+		}
+
+		/*!
+		 * @brief MSD radix sort on byte strings in lexicographical order of unsigned bytes, which is not stable
+		 * @param key_func Extract the byte string from an element, e.g. std::string, std::string_view or std::array<char, N>
+		 */
+		template<class Iterator, class KeyFunc = std::identity>
+		inline void msd_radix_sort(Iterator start_iter, Iterator end_iter, KeyFunc key_func = KeyFunc()) {
+			msd_radix_sort_loop(start_iter, end_iter, 0, key_func);
+		}
+
+	}
+
+}
+
+#endif//ALGORITHM_ALGORITHM_SORT_RADIX_SORT_H
@@ -0,0 +1,71 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_ALGORITHM_SORT_SORT_SCRATCH_H
+#define ALGORITHM_ALGORITHM_SORT_SORT_SCRATCH_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include <allocator/reserve_allocator/reserve_allocator.h>
+
+namespace algorithm {
+
+	inline namespace sort {
+
+		/// The allocator of scratch by default, rebound to the element type
+		using DefaultSortAllocator = allocator::ReserveAllocator<std::byte>;
+
+		/*!
+		 * @brief Hold the scratch of the range size for out-of-place sorts, drawn from the allocator rebound to elements.
+		 * Trivially copyable elements are left uninitialized, while others are constructed by moving the data in,
+		 * which makes the scratch hold the data and the range hold the scratch.
+		 */
+		template<class Iterator, class Allocator = DefaultSortAllocator>
+		class SortScratch {
+		public:
+			using ValueType = std::iter_value_t<Iterator>;
+
+			using ValueAllocator = typename Allocator::template Rebind<ValueType>::type;
+
+			static constexpr bool TRIVIAL = std::is_trivially_copyable_v<ValueType>;
+
+		private:
+			ValueAllocator allocator_;
+
+			ValueType *buffer_ptr_;
+
+			size_t size_;
+
+		public:
+			SortScratch(Iterator start_iter, size_t size): buffer_ptr_(allocator_.allocate(size)), size_(size) {
+				if constexpr (!TRIVIAL) {
+					std::uninitialized_move(start_iter, start_iter + size, buffer_ptr_);
+				}
+			}
+
+			SortScratch(const SortScratch &other) = delete;
+
+			~SortScratch() {
+				if constexpr (!TRIVIAL) {
+					std::destroy_n(buffer_ptr_, size_);
+				}
+				allocator_.deallocate(buffer_ptr_, size_);
+			}
+
+			ValueType *get_buffer() const { return buffer_ptr_; }
+
+			/// Whether the data has been moved into the scratch at construction
+			static constexpr bool data_in_scratch() { return !TRIVIAL; }
+		};
+
+	}
+
+}
+
+#endif//ALGORITHM_ALGORITHM_SORT_SORT_SCRATCH_H
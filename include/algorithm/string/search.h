@@ -13,5 +13,10 @@
 #include <algorithm/string/search/binary.h>
 #include <algorithm/string/search/kmp.h>
 #include <algorithm/string/search/boyer_moore.h>
+#include <algorithm/string/search/horspool.h>
+#include <algorithm/string/search/simd.h>
+#include <algorithm/string/search/aho_corasick.h>
+#include <algorithm/string/search/stream.h>
+#include <algorithm/string/search/parallel.h>
 
 #endif//ALGORITHM_ALGORITHM_STRING_SEARCH_H
@@ -0,0 +1,319 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_ALGORITHM_STRING_AHO_CORASICK_H
+#define ALGORITHM_ALGORITHM_STRING_AHO_CORASICK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <span>
+#include <vector>
+
+#include <logger/logger.h>
+#include <algorithm/string/search/base.h>
+
+namespace algorithm {
+
+	inline namespace string {
+
+		/*!
+		 * @brief Aho-Corasick automaton matching many patterns in one pass.
+		 * States are numbered in BFS order, so that shallow states, which most transitions land on, come first.
+		 * States shallower than DENSE_DEPTH own a full row of transitions with failures resolved,
+		 * while deeper states keep only their sorted trie edges and follow failure links on a miss,
+		 * which always ends in a dense state.
+		 * Dense rows are limited to DENSE_MAX_TABLE_SIZE entries in total, taken by the shallowest states first,
+		 * so that a wide alphabet like uint16_t keeps only the root and one more state dense.
+		 * Alphabets wider than DENSE_MAX_VALUE_AMOUNT, e.g. the whole range of int, keep all states sparse.
+		 * @tparam Value The type of elements, within [min_value, max_value]
+		 */
+		template<class Value>
+		class AhoCorasick {
+		public:
+			using ValueType = Value;
+
+			/// The offset of a value from min_value, as wide as values
+			using ValueIndexType = std::conditional_t<(sizeof(Value) <= sizeof(uint32_t)), uint32_t, uint64_t>;
+
+			/// States with depth less than it have dense transitions
+			static constexpr size_t DENSE_DEPTH = 2;
+
+			/// The max amount of kinds of value of a dense row
+			static constexpr size_t DENSE_MAX_VALUE_AMOUNT = 64 * 1024;
+
+			/// The max amount of entries of all dense rows, enough for all shallow states of 8-bit values
+			static constexpr size_t DENSE_MAX_TABLE_SIZE = 128 * 1024;
+
+			static_assert(DENSE_MAX_VALUE_AMOUNT <= DENSE_MAX_TABLE_SIZE, "The root should always fit in dense rows");
+
+			static constexpr uint32_t ROOT_STATE = 0;
+
+			static constexpr uint32_t NONE_STATE = std::numeric_limits<uint32_t>::max();
+
+		private:
+			/// The minimal value
+			ValueType min_value_;
+			/// The maximal value
+			ValueType max_value_;
+			/// The amount of kinds of value, or 0 if too wide for dense rows
+			size_t value_amount_;
+			/// The amount of states with dense transitions
+			uint32_t dense_amount_;
+
+			/// Transitions of dense states, indexed by state * value_amount + value index
+			std::vector<uint32_t> dense_table_;
+			/// Failure links of all states
+			std::vector<uint32_t> fail_array_;
+			/// Range of sparse edges of state s (offset by dense amount) is [edge_offset[s], edge_offset[s + 1])
+			std::vector<uint32_t> edge_offset_array_;
+			/// Value indices of sparse edges, sorted inside each state
+			std::vector<ValueIndexType> edge_value_array_;
+			/// Targets of sparse edges
+			std::vector<uint32_t> edge_target_array_;
+
+			/// Range of pattern ids ending at state s is [output_offset[s], output_offset[s + 1])
+			std::vector<uint32_t> output_offset_array_;
+			std::vector<uint32_t> output_id_array_;
+			/// The nearest state on the failure chain with outputs
+			std::vector<uint32_t> output_link_array_;
+			/// The size of each pattern
+			std::vector<size_t> pattern_size_array_;
+
+			/// Current state of streaming
+			uint32_t stream_state_;
+			/// The amount of elements fed
+			size_t stream_offset_;
+
+		public:
+			/*!
+			 * @brief Build the automaton from a range of patterns, each of which is a range of values.
+			 * The id of a pattern is its index in the range. Empty patterns never match.
+			 */
+			template<class PatternRange>
+			explicit AhoCorasick(const PatternRange &pattern_range):
+			        AhoCorasick(pattern_range, std::numeric_limits<ValueType>::min(), std::numeric_limits<ValueType>::max()) {}
+
+			template<class PatternRange>
+			AhoCorasick(const PatternRange &pattern_range, const ValueType &min_value, const ValueType &max_value):
+			        min_value_(min_value), max_value_(max_value),
+			        value_amount_(value_range_size(min_value, max_value, DENSE_MAX_VALUE_AMOUNT)),
+			        dense_amount_(0), stream_state_(ROOT_STATE), stream_offset_(0) {
+
+				build(pattern_range);
+			}
+
+		public:
+			size_t pattern_amount() const { return pattern_size_array_.size(); }
+
+			size_t state_amount() const { return fail_array_.size(); }
+
+			size_t dense_state_amount() const { return dense_amount_; }
+
+			/*!
+			 * @brief The size of transitions and failure links in bytes
+			 */
+			size_t table_bytes() const {
+				return dense_table_.size() * sizeof(uint32_t) + fail_array_.size() * sizeof(uint32_t)
+				       + edge_offset_array_.size() * sizeof(uint32_t) + edge_value_array_.size() * sizeof(ValueIndexType)
+				       + edge_target_array_.size() * sizeof(uint32_t);
+			}
+
+			/*!
+			 * @brief Transit from state by a value
+			 */
+			uint32_t next_state(uint32_t state, const ValueType &value) const {
+				if (value < min_value_ || max_value_ < value) { return ROOT_STATE; }
+				const ValueIndexType value_idx = static_cast<ValueIndexType>(value_offset(value, min_value_));
+
+				while (state >= dense_amount_) {
+					const uint32_t sparse_idx = state - dense_amount_;
+					const auto edge_start_iter = edge_value_array_.begin() + edge_offset_array_[sparse_idx];
+					const auto edge_end_iter   = edge_value_array_.begin() + edge_offset_array_[sparse_idx + 1];
+					const auto edge_iter       = std::lower_bound(edge_start_iter, edge_end_iter, value_idx);
+					if (edge_iter != edge_end_iter && *edge_iter == value_idx) {
+						return edge_target_array_[edge_iter - edge_value_array_.begin()];
+					}
+					// Only reached without dense states
+					if (state == ROOT_STATE) { return ROOT_STATE; }
+					state = fail_array_[state];
+				}
+				return dense_table_[state * value_amount_ + value_idx];
+			}
+
+			/*!
+			 * @brief Find all matches in [start_iter, end_iter)
+			 * @param callback Called with (pattern id, offset of the match start) for each match, in the order of match ends
+			 */
+			template<class Iterator, class Callback>
+			void find_all(Iterator start_iter, Iterator end_iter, Callback &&callback) const {
+				scan(start_iter, end_iter, ROOT_STATE, 0, callback);
+			}
+
+			/*!
+			 * @brief Feed a chunk of a stream, with matches across chunks reported,
+			 * and offsets counted from the start of the stream.
+			 * @param callback Called with (pattern id, offset of the match start) for each match
+			 */
+			template<class Iterator, class Callback>
+			void feed(Iterator start_iter, Iterator end_iter, Callback &&callback) {
+				stream_state_   = scan(start_iter, end_iter, stream_state_, stream_offset_, callback);
+				stream_offset_ += std::distance(start_iter, end_iter);
+			}
+
+			template<class Callback>
+			void feed(std::span<const ValueType> chunk, Callback &&callback) {
+				feed(chunk.begin(), chunk.end(), callback);
+			}
+
+			/*!
+			 * @brief Restart the stream
+			 */
+			void reset() {
+				stream_state_  = ROOT_STATE;
+				stream_offset_ = 0;
+			}
+
+		private:
+			template<class Iterator, class Callback>
+			uint32_t scan(Iterator start_iter, Iterator end_iter, uint32_t state, size_t offset, Callback &callback) const {
+				for (Iterator iter = start_iter; iter != end_iter; ++iter, ++offset) {
+					state = next_state(state, *iter);
+					for (uint32_t output_state = state; output_state != NONE_STATE; output_state = output_link_array_[output_state]) {
+						for (uint32_t idx = output_offset_array_[output_state]; idx < output_offset_array_[output_state + 1]; ++idx) {
+							const uint32_t pattern_id = output_id_array_[idx];
+							callback(static_cast<size_t>(pattern_id), offset + 1 - pattern_size_array_[pattern_id]);
+						}
+					}
+				}
+				return state;
+			}
+
+			template<class PatternRange>
+			void build(const PatternRange &pattern_range) {
+				struct TrieNode {
+					std::map<ValueIndexType, uint32_t> child_map;
+					std::vector<uint32_t>        output_array;
+					size_t                       depth;
+				};
+
+				// Build the trie
+				std::vector<TrieNode> trie_array(1, TrieNode{{}, {}, 0});
+				for (const auto &pattern: pattern_range) {
+					const uint32_t pattern_id = static_cast<uint32_t>(pattern_size_array_.size());
+					pattern_size_array_.push_back(std::distance(std::begin(pattern), std::end(pattern)));
+					if (pattern_size_array_.back() == 0) { continue; }
+
+					const bool out_of_range = std::any_of(std::begin(pattern), std::end(pattern), [this](const auto &value) {
+						return value < min_value_ || max_value_ < value;
+					});
+					if (out_of_range) {
+						util::logger::logger_warn("Pattern out of the range of values is ignored: ", pattern_id);
+						continue;
+					}
+
+					uint32_t node = ROOT_STATE;
+					for (const auto &value: pattern) {
+						const ValueIndexType value_idx = static_cast<ValueIndexType>(value_offset(value, min_value_));
+						auto child_iter = trie_array[node].child_map.find(value_idx);
+						if (child_iter == trie_array[node].child_map.end()) {
+							const uint32_t child = static_cast<uint32_t>(trie_array.size());
+							trie_array[node].child_map.emplace(value_idx, child);
+							trie_array.push_back(TrieNode{{}, {}, trie_array[node].depth + 1});
+							node = child;
+						}
+						else {
+							node = child_iter->second;
+						}
+					}
+					trie_array[node].output_array.push_back(pattern_id);
+				}
+
+				// Number states in BFS order, where failure links are computed in the old numbering
+				const size_t state_amount = trie_array.size();
+				std::vector<uint32_t> order_array{ROOT_STATE};
+				std::vector<uint32_t> trie_fail_array(state_amount, ROOT_STATE);
+				order_array.reserve(state_amount);
+				for (size_t order_idx = 0; order_idx < order_array.size(); ++order_idx) {
+					const uint32_t node = order_array[order_idx];
+					for (const auto &[value_idx, child]: trie_array[node].child_map) {
+						if (node != ROOT_STATE) {
+							uint32_t fail = trie_fail_array[node];
+							while (fail != ROOT_STATE && !trie_array[fail].child_map.contains(value_idx)) {
+								fail = trie_fail_array[fail];
+							}
+							auto fail_iter = trie_array[fail].child_map.find(value_idx);
+							trie_fail_array[child] = (fail_iter != trie_array[fail].child_map.end()) ? fail_iter->second : ROOT_STATE;
+						}
+						order_array.push_back(child);
+					}
+				}
+
+				// Dense states are a prefix of the BFS order, whose failure states are dense as well
+				const size_t max_dense_amount = (value_amount_ != 0) ? DENSE_MAX_TABLE_SIZE / value_amount_ : 0;
+				std::vector<uint32_t> rank_array(state_amount);
+				for (size_t order_idx = 0; order_idx < state_amount; ++order_idx) {
+					rank_array[order_array[order_idx]] = static_cast<uint32_t>(order_idx);
+					if (order_idx < max_dense_amount && trie_array[order_array[order_idx]].depth < DENSE_DEPTH) { dense_amount_ = static_cast<uint32_t>(order_idx + 1); }
+				}
+
+				// Flatten failure links, outputs and output links
+				fail_array_.resize(state_amount);
+				output_link_array_.resize(state_amount);
+				output_offset_array_.reserve(state_amount + 1);
+				for (uint32_t state = 0; state < state_amount; ++state) {
+					const uint32_t node = order_array[state];
+					fail_array_[state] = rank_array[trie_fail_array[node]];
+
+					output_offset_array_.push_back(static_cast<uint32_t>(output_id_array_.size()));
+					output_id_array_.insert(output_id_array_.end(), trie_array[node].output_array.begin(), trie_array[node].output_array.end());
+
+					// Failure links point to shallower states, which are flattened before
+					const uint32_t fail = fail_array_[state];
+					if (state == ROOT_STATE) {
+						output_link_array_[state] = NONE_STATE;
+					}
+					else {
+						const bool fail_has_output = !trie_array[order_array[fail]].output_array.empty();
+						output_link_array_[state] = fail_has_output ? fail : output_link_array_[fail];
+					}
+				}
+				output_offset_array_.push_back(static_cast<uint32_t>(output_id_array_.size()));
+
+				// Dense rows take trie edges, and the row of the failure state for the rest
+				dense_table_.assign(static_cast<size_t>(dense_amount_) * value_amount_, ROOT_STATE);
+				for (uint32_t state = 0; state < dense_amount_; ++state) {
+					auto row_iter = dense_table_.begin() + state * value_amount_;
+					if (state != ROOT_STATE) {
+						const auto fail_row_iter = dense_table_.begin() + fail_array_[state] * value_amount_;
+						std::copy(fail_row_iter, fail_row_iter + value_amount_, row_iter);
+					}
+					for (const auto &[value_idx, child]: trie_array[order_array[state]].child_map) {
+						row_iter[value_idx] = rank_array[child];
+					}
+				}
+
+				// Sparse edges of deep states
+				edge_offset_array_.reserve(state_amount - dense_amount_ + 1);
+				for (uint32_t state = dense_amount_; state < state_amount; ++state) {
+					edge_offset_array_.push_back(static_cast<uint32_t>(edge_value_array_.size()));
+					for (const auto &[value_idx, child]: trie_array[order_array[state]].child_map) {
+						edge_value_array_.push_back(value_idx);
+						edge_target_array_.push_back(rank_array[child]);
+					}
+				}
+				edge_offset_array_.push_back(static_cast<uint32_t>(edge_value_array_.size()));
+			}
+		};
+
+	}
+
+}
+
+#endif//ALGORITHM_ALGORITHM_STRING_AHO_CORASICK_H
@@ -7,8 +7,12 @@
 #ifndef ALGORITHM_ALGORITHM_STRING_BASE_H
 #define ALGORITHM_ALGORITHM_STRING_BASE_H
 
+#include <bit>
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
+#include <type_traits>
 
 namespace algorithm {
 
@@ -16,6 +20,37 @@ namespace algorithm {
 
 		constexpr size_t STRING_NO_FOUND_POS = std::numeric_limits<size_t>::max();
 
+		/*!
+		 * @brief The offset of value from min_value, computed in the unsigned type so that it never overflows
+		 */
+		template<std::integral Value>
+		inline constexpr uint64_t value_offset(const Value &value, const Value &min_value) {
+			using UnsignedType = std::make_unsigned_t<Value>;
+			return static_cast<UnsignedType>(static_cast<UnsignedType>(value) - static_cast<UnsignedType>(min_value));
+		}
+
+		/*!
+		 * @brief The amount of values in [min_value, max_value]
+		 * @return The amount, or 0 if it is beyond limit, where the range of 64-bit types may not fit in size_t
+		 */
+		template<std::integral Value>
+		inline constexpr size_t value_range_size(const Value &min_value, const Value &max_value, size_t limit) {
+			if (max_value < min_value) { return 0; }
+			const uint64_t max_offset = value_offset(max_value, min_value);
+			return (max_offset < limit) ? static_cast<size_t>(max_offset) + 1 : 0;
+		}
+
+		/*!
+		 * @brief The size of a table indexed by value_offset & (size - 1), i.e. a power of 2 covering [min_value, max_value],
+		 * which is clamped to limit for wider alphabets, where values sharing a slot should be handled conservatively.
+		 * @param limit A power of 2
+		 */
+		template<std::integral Value>
+		inline constexpr size_t value_table_size(const Value &min_value, const Value &max_value, size_t limit) {
+			const size_t range_size = value_range_size(min_value, max_value, limit);
+			return (range_size == 0) ? limit : std::bit_ceil(range_size);
+		}
+
 	}
 
 }
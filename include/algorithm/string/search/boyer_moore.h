@@ -1,5 +1,5 @@
 /*
- * @author: BL-GS 
+ * @author: BL-GS
  * @date:   2023/5/17
  */
 
@@ -9,8 +9,11 @@
 
 #include <cstddef>
 #include <cstring>
+#include <algorithm>
+#include <iterator>
 #include <limits>
 #include <span>
+#include <vector>
 
 #include <algorithm/string/search/base.h>
 
@@ -23,50 +26,43 @@ namespace algorithm {
 		public:
 			using ValueType = Value;
 
+			/// The max amount of slots of the bad character table, beyond which values share slots
+			static constexpr size_t BAD_CHARACTER_MAX_SIZE = 64 * 1024;
+
 		private:
-			std::span<ssize_t> bad_character_heuristic_;
+			std::vector<ssize_t> bad_character_heuristic_;
 
-			std::span<ssize_t> good_suffix_heuristic_;
+			std::vector<ssize_t> good_suffix_heuristic_;
 
-			std::span<ValueType> pattern_;
+			std::vector<ValueType> pattern_;
 
 			ValueType min_value_;
 
 		public:
 			template<class Iterator>
-			BoyerMoore(Iterator start_iter, Iterator end_iter) {
-				this(start_iter, end_iter, std::numeric_limits<ValueType>::min(), std::numeric_limits<ValueType>::max());
-			}
+			BoyerMoore(Iterator start_iter, Iterator end_iter):
+			        BoyerMoore(start_iter, end_iter, std::numeric_limits<ValueType>::min(), std::numeric_limits<ValueType>::max()) {}
 
 			template<class Iterator>
-			BoyerMoore(Iterator start_iter, Iterator end_iter, const ValueType &min_value, const ValueType &max_value): min_value_(min_value) {
-		        using PatternValueType = std::remove_reference_t<decltype(*start_iter)>;
+			BoyerMoore(Iterator start_iter, Iterator end_iter, const ValueType &min_value, const ValueType &max_value):
+			        pattern_(start_iter, end_iter), min_value_(min_value) {
 
-				std::span<PatternValueType> pattern{start_iter, end_iter};
-				size_t pattern_size = pattern.size();
-				size_t value_range = max_value - min_value + 1;
+				const size_t pattern_size = pattern_.size();
+				const size_t table_size   = value_table_size(min_value, max_value, BAD_CHARACTER_MAX_SIZE);
 
-				bad_character_heuristic_ = std::span<ssize_t>{new ssize_t[value_range], value_range};
-				good_suffix_heuristic_ = std::span<ssize_t>{new ssize_t[pattern_size], pattern_size};
+				bad_character_heuristic_.resize(table_size);
+				good_suffix_heuristic_.resize(pattern_size);
 
 				// Build two tables of heuristic
-				build_bad_character_heuristic(pattern, bad_character_heuristic_, min_value);
-				build_good_suffix_heuristic(pattern, good_suffix_heuristic_);
-
-				// Copy the pattern
-				pattern_ = {new ValueType[pattern_size], pattern_size};
-				std::copy(start_iter, end_iter, pattern_.begin());
-			}
-
-			~BoyerMoore() {
-				delete[] bad_character_heuristic_.data();
-				delete[] good_suffix_heuristic_.data();
-				delete[] pattern_.data();
+				build_bad_character_heuristic(pattern_, bad_character_heuristic_, min_value);
+				build_good_suffix_heuristic(pattern_, good_suffix_heuristic_);
 			}
 
 		public:
+			size_t pattern_size() const { return pattern_.size(); }
+
 			template<class Iterator>
-			Iterator find(Iterator start_iter, Iterator end_iter) {
+			Iterator find(Iterator start_iter, Iterator end_iter) const {
 				return find(start_iter, end_iter,
 				            pattern_,
 				            bad_character_heuristic_,
@@ -75,7 +71,7 @@ namespace algorithm {
 			}
 
 			template<class Iterator>
-			std::vector<Iterator> find_all(Iterator start_iter, Iterator end_iter) {
+			std::vector<Iterator> find_all(Iterator start_iter, Iterator end_iter) const {
 				return find_all(start_iter, end_iter,
 				                pattern_,
 				                bad_character_heuristic_,
@@ -84,23 +80,26 @@ namespace algorithm {
 			}
 
 		public:
-			static constexpr void build_suffix_length_array(std::span<ValueType> pattern,
+			/*!
+			 * @brief The length of the longest suffix of pattern[0, i] which is also a suffix of pattern
+			 */
+			static constexpr void build_suffix_length_array(std::span<const ValueType> pattern,
 			                                                std::span<ssize_t> suffix_length_array) {
-				ssize_t pattern_size = pattern.size();
+				const ssize_t pattern_size = pattern.size();
 
 				ssize_t upper = pattern_size - 1;
 				ssize_t lower = upper;
 
 				suffix_length_array[pattern_size - 1] = pattern_size;
-				for (ssize_t cur_pos = upper - 1; cur_pos >= 0; --cur_pos) {
-					if (cur_pos > lower && suffix_length_array[pattern_size - 1 - (upper - cur_pos)] <= cur_pos - lower) {
-						suffix_length_array[cur_pos] = suffix_length_array[pattern_size - 1 - (upper - cur_pos)];
+				for (ssize_t cur_pos = pattern_size - 2; cur_pos >= 0; --cur_pos) {
+					if (cur_pos > lower && suffix_length_array[cur_pos + pattern_size - 1 - upper] < cur_pos - lower) {
+						suffix_length_array[cur_pos] = suffix_length_array[cur_pos + pattern_size - 1 - upper];
 					}
 					else {
+						lower = std::min(lower, cur_pos);
 						upper = cur_pos;
-						lower = std::min(lower, upper);
 
-						while (lower >= 0 && pattern[lower] == pattern[pattern_size - 1 - (upper - lower)]) {
+						while (lower >= 0 && pattern[lower] == pattern[lower + pattern_size - 1 - upper]) {
 							--lower;
 						}
 						suffix_length_array[cur_pos] = upper - lower;
@@ -108,99 +107,103 @@ namespace algorithm {
 				}
 			}
 
-			static constexpr void build_bad_character_heuristic(std::span<ValueType> pattern,
+			/*!
+			 * @brief The last position of each value in pattern (the last value excluded), in slots indexed by
+			 * value_offset masked with the size of table, where values sharing a slot take the rightmost position
+			 */
+			static constexpr void build_bad_character_heuristic(std::span<const ValueType> pattern,
 			                                                    std::span<ssize_t> bad_character_heuristic_array,
 			                                                    const Value &min_value) {
-				ssize_t pattern_size = pattern.size();
+				const ssize_t pattern_size = pattern.size();
 				std::fill(bad_character_heuristic_array.begin(), bad_character_heuristic_array.end(), -1);
 				for (ssize_t i = 0; i < pattern_size - 1; ++i) {
-					bad_character_heuristic_array[pattern[i] - min_value] = i;
+					bad_character_heuristic_array[value_offset(pattern[i], min_value) & (bad_character_heuristic_array.size() - 1)] = i;
 				}
 			}
 
-			static constexpr void build_good_suffix_heuristic(std::span<ValueType> pattern,
+			static constexpr void build_good_suffix_heuristic(std::span<const ValueType> pattern,
 			                                                  std::span<ssize_t> good_suffix_heuristic_array) {
-				ssize_t pattern_size = pattern.size();
-				std::fill(good_suffix_heuristic_array.begin(), good_suffix_heuristic_array.end(), pattern_size);
+				const ssize_t pattern_size = pattern.size();
+				if (pattern_size == 0) { return; }
 
-				ssize_t upper = pattern_size - 1;
-				ssize_t lower = upper;
-
-				ssize_t *suffix_length_array = new ssize_t[pattern_size];
-				std::span<ssize_t> suffix_length_array_span{suffix_length_array, static_cast<size_t>(pattern_size)};
-				build_suffix_length_array(pattern, suffix_length_array_span);
+				std::vector<ssize_t> suffix_length_array(pattern_size);
+				build_suffix_length_array(pattern, suffix_length_array);
 
+				// Shift to the longest prefix which is also a suffix
 				std::fill(good_suffix_heuristic_array.begin(), good_suffix_heuristic_array.end(), pattern_size);
-				for (ssize_t i = 0, j = pattern_size; j > 0; --j) {
-					if (j == suffix_length_array_span[j - 1]) {
-						while (i < pattern_size - j) {
-							good_suffix_heuristic_array[i++] = pattern_size - j;
+				for (ssize_t i = pattern_size - 1, j = 0; i >= 0; --i) {
+					if (suffix_length_array[i] == i + 1) {
+						for (; j < pattern_size - 1 - i; ++j) {
+							if (good_suffix_heuristic_array[j] == pattern_size) {
+								good_suffix_heuristic_array[j] = pattern_size - 1 - i;
+							}
 						}
 					}
 				}
+				// Shift to the rightmost reoccurrence of the matched suffix
 				for (ssize_t i = 0; i < pattern_size - 1; ++i) {
-					good_suffix_heuristic_array[pattern_size - 1 - suffix_length_array_span[i]] = pattern_size - 1 - i;
+					good_suffix_heuristic_array[pattern_size - 1 - suffix_length_array[i]] = pattern_size - 1 - i;
 				}
-
-				delete[] suffix_length_array;
 			}
 
 			template<class Iterator>
 			static constexpr Iterator find(Iterator start_iter, Iterator end_iter,
-			                               std::span<ValueType> pattern,
-			                               std::span<ssize_t> bad_character_heuristic_array,
-			                               std::span<ssize_t> good_suffix_heuristic_array,
+			                               std::span<const ValueType> pattern,
+			                               std::span<const ssize_t> bad_character_heuristic_array,
+			                               std::span<const ssize_t> good_suffix_heuristic_array,
 			                               const ValueType &min_value) {
-				using BaseValueType = std::remove_reference_t<decltype(*start_iter)>;
-
-				std::span<BaseValueType> base{start_iter, end_iter};
-				ssize_t base_size = base.size();
-				ssize_t pattern_size = pattern.size();
-
-				ssize_t base_idx = 0;
-				while (base_idx <= base_size - pattern_size) {
-					ssize_t pattern_idx = pattern_size - 1;
-
-					while (base[base_idx + pattern_idx] == pattern[pattern_idx]) {
-						if (--pattern_idx < 0) {
-							return start_iter + base_idx;
-						}
-					}
-					base_idx += std::max(good_suffix_heuristic_array[pattern_idx],
-					                     pattern_idx - bad_character_heuristic_array[base[base_idx + pattern_idx] - min_value]);
-				}
-				return end_iter;
+				Iterator res_iter = end_iter;
+				search(start_iter, end_iter, pattern, bad_character_heuristic_array, good_suffix_heuristic_array, min_value,
+				       [&res_iter](Iterator iter) { res_iter = iter; return false; });
+				return res_iter;
 			}
 
 			template<class Iterator>
-			static constexpr Iterator find_all(Iterator start_iter, Iterator end_iter,
-			                                   std::span<ValueType> pattern,
-			                                   std::span<ssize_t> bad_character_heuristic_array,
-			                                   std::span<ssize_t> good_suffix_heuristic_array,
-			                                   const ValueType &min_value) {
-				using BaseValueType = std::remove_reference_t<decltype(*start_iter)>;
-
-				std::span<BaseValueType> base{start_iter, end_iter};
-				ssize_t base_size = base.size();
-				ssize_t pattern_size = pattern.size();
+			static constexpr std::vector<Iterator> find_all(Iterator start_iter, Iterator end_iter,
+			                                                std::span<const ValueType> pattern,
+			                                                std::span<const ssize_t> bad_character_heuristic_array,
+			                                                std::span<const ssize_t> good_suffix_heuristic_array,
+			                                                const ValueType &min_value) {
+				std::vector<Iterator> res_iters;
+				search(start_iter, end_iter, pattern, bad_character_heuristic_array, good_suffix_heuristic_array, min_value,
+				       [&res_iters](Iterator iter) { res_iters.emplace_back(iter); return true; });
+				return res_iters;
+			}
 
-				std::vector<ValueType> res_iters;
+		private:
+			/*!
+			 * @brief Visit the start of each match, which returns false to stop
+			 */
+			template<class Iterator, class Visit>
+			static constexpr void search(Iterator start_iter, Iterator end_iter,
+			                             std::span<const ValueType> pattern,
+			                             std::span<const ssize_t> bad_character_heuristic_array,
+			                             std::span<const ssize_t> good_suffix_heuristic_array,
+			                             const ValueType &min_value,
+			                             Visit &&visit) {
+				const ssize_t base_size    = std::distance(start_iter, end_iter);
+				const ssize_t pattern_size = pattern.size();
+				if (pattern_size == 0) {
+					visit(start_iter);
+					return;
+				}
 
 				ssize_t base_idx = 0;
 				while (base_idx <= base_size - pattern_size) {
 					ssize_t pattern_idx = pattern_size - 1;
+					while (pattern_idx >= 0 && start_iter[base_idx + pattern_idx] == pattern[pattern_idx]) {
+						--pattern_idx;
+					}
 
-					bool found = false;
-					while (base[base_idx + pattern_idx] == pattern[pattern_idx]) {
-						if (--pattern_idx < 0) {
-							res_iters.emplace_back(start_iter + base_idx);
-							base_idx += 1;
-							found = true;
-						}
+					if (pattern_idx < 0) {
+						if (!visit(start_iter + base_idx)) { return; }
+						// Shift by the period of pattern, so that overlapping matches are kept
+						base_idx += good_suffix_heuristic_array[0];
 					}
-					if (!found) {
-						base_idx += std::max(good_suffix_heuristic_array[pattern_idx],
-						                     pattern_idx - bad_character_heuristic_array[base[base_idx + pattern_idx] - min_value]);
+					else {
+						const size_t  bad_character_slot  = value_offset<ValueType>(start_iter[base_idx + pattern_idx], min_value) & (bad_character_heuristic_array.size() - 1);
+						const ssize_t bad_character_shift = pattern_idx - bad_character_heuristic_array[bad_character_slot];
+						base_idx += std::max(good_suffix_heuristic_array[pattern_idx], bad_character_shift);
 					}
 				}
 			}
@@ -210,14 +213,14 @@ namespace algorithm {
 		Iterator boyer_moore_find(VIterator value_start_iter, VIterator value_end_iter,
 		                          Iterator start_iter, Iterator end_iter,
 		                          const Value &min_value, const Value &max_value) {
-	        BoyerMoore<Value> finder{value_start_iter, value_end_iter, min_value, max_value};
+			const BoyerMoore<Value> finder{value_start_iter, value_end_iter, min_value, max_value};
 			return finder.find(start_iter, end_iter);
 		}
 
 		template<class VIterator, class Iterator>
 		Iterator boyer_moore_find(VIterator value_start_iter, VIterator value_end_iter,
 		                          Iterator start_iter, Iterator end_iter) {
-			using ValueType = std::remove_reference_t<decltype(*start_iter)>;
+			using ValueType = std::iter_value_t<Iterator>;
 			return boyer_moore_find(value_start_iter, value_end_iter,
 			                        start_iter, end_iter,
 			                        std::numeric_limits<ValueType>::min(),
@@ -1,5 +1,5 @@
 /*
- * @author: BL-GS 
+ * @author: BL-GS
  * @date:   2023/5/17
  */
 
@@ -8,9 +8,11 @@
 #define ALGORITHM_ALGORITHM_STRING_HORSPOOL_H
 
 #include <cstddef>
-#include <cstring>
+#include <algorithm>
+#include <iterator>
 #include <limits>
 #include <span>
+#include <vector>
 
 #include <algorithm/string/search/base.h>
 
@@ -18,65 +20,94 @@ namespace algorithm {
 
 	inline namespace string {
 
-		template<class Value>
-		void build_bad_character_heuristic(std::span<Value> pattern, std::span<ssize_t> bad_character_heuristic_array,
-		                                   const Value &min_value) {
-			ssize_t pattern_size = pattern.size();
-			std::fill(bad_character_heuristic_array.begin(), bad_character_heuristic_array.end(), -1);
-			for (ssize_t i = 0; i < pattern_size - 1; ++i) {
-				bad_character_heuristic_array[pattern[i] - min_value] = i;
+		/*!
+		 * @brief Shift on a mismatch, decided by the base value aligned with the last value of pattern,
+		 * which is the distance from its last occurrence in pattern (the last value excluded) to the end.
+		 * Slots are indexed by value_offset masked with the size of table, where values sharing a slot take the least shift.
+		 */
+		template<class Value, class VIterator>
+		void build_horspool_shift_table(VIterator value_start_iter, VIterator value_end_iter,
+		                                std::span<size_t> shift_array, const Value &min_value) {
+			const size_t pattern_size = std::distance(value_start_iter, value_end_iter);
+			std::fill(shift_array.begin(), shift_array.end(), pattern_size);
+
+			size_t pattern_idx = 0;
+			for (VIterator iter = value_start_iter; pattern_idx + 1 < pattern_size; ++iter, ++pattern_idx) {
+				shift_array[value_offset<Value>(*iter, min_value) & (shift_array.size() - 1)] = pattern_size - 1 - pattern_idx;
 			}
 		}
 
-		template<class Value, class VIterator, class Iterator>
-		Iterator boyer_moore_find(VIterator value_start_iter, VIterator value_end_iter,
-		                          Iterator start_iter, Iterator end_iter,
-		                          const Value &min_value, const Value &max_value) {
+		template<class Value>
+		class Horspool {
+		public:
+			using ValueType = Value;
 
-			using PatternValueType = std::remove_reference_t<decltype(*value_start_iter)>;
-			using BaseValueType = std::remove_reference_t<decltype(*start_iter)>;
+			/// The max amount of slots of the shift table, beyond which values share slots
+			static constexpr size_t SHIFT_TABLE_MAX_SIZE = 64 * 1024;
 
-			std::span<PatternValueType> pattern{value_start_iter, value_end_iter};
-			size_t pattern_size = pattern.size();
-			size_t value_range = max_value - min_value + 1;
+		private:
+			std::vector<size_t> shift_array_;
 
-			ssize_t *bc_heuristic = new ssize_t[value_range];
+			std::vector<ValueType> pattern_;
 
-			std::span<ssize_t> bc_array{bc_heuristic, value_range};
+			ValueType min_value_;
 
-			build_bad_character_heuristic(pattern, bc_array, min_value);
+		public:
+			template<class Iterator>
+			Horspool(Iterator start_iter, Iterator end_iter):
+			        Horspool(start_iter, end_iter, std::numeric_limits<ValueType>::min(), std::numeric_limits<ValueType>::max()) {}
 
-			std::span<BaseValueType> base{start_iter, end_iter};
-			ssize_t base_size = base.size();
+			template<class Iterator>
+			Horspool(Iterator start_iter, Iterator end_iter, const ValueType &min_value, const ValueType &max_value):
+			        shift_array_(value_table_size(min_value, max_value, SHIFT_TABLE_MAX_SIZE)),
+			        pattern_(start_iter, end_iter), min_value_(min_value) {
 
-			ssize_t base_idx = 0;
-			while (base_idx <= base_size - pattern_size) {
-				ssize_t pattern_idx = pattern_size - 1;
+				build_horspool_shift_table(pattern_.begin(), pattern_.end(), std::span<size_t>{shift_array_}, min_value);
+			}
 
-				while (base[base_idx + pattern_idx] == pattern[pattern_idx]) {
-					if (--pattern_idx < 0) {
-						delete[] bc_heuristic;
+		public:
+			size_t pattern_size() const { return pattern_.size(); }
+
+			template<class Iterator>
+			Iterator find(Iterator start_iter, Iterator end_iter) const {
+				const size_t pattern_size = pattern_.size();
+				const size_t base_size    = std::distance(start_iter, end_iter);
+				if (pattern_size == 0)        { return start_iter; }
+				if (pattern_size > base_size) { return end_iter; }
+
+				const ValueType &last_value = pattern_.back();
+				size_t base_idx = 0;
+				while (base_idx <= base_size - pattern_size) {
+					const auto &base_last_value = start_iter[base_idx + pattern_size - 1];
+					if (base_last_value == last_value
+					    && std::equal(pattern_.begin(), pattern_.end() - 1, start_iter + base_idx)) {
 						return start_iter + base_idx;
 					}
+					base_idx += shift_array_[value_offset<ValueType>(base_last_value, min_value_) & (shift_array_.size() - 1)];
 				}
-				base_idx += pattern_idx - bc_heuristic[base[base_idx + pattern_idx] - min_value];
+				return end_iter;
 			}
+		};
 
-			delete[] bc_heuristic;
-			return end_iter;
+		template<class Value, class VIterator, class Iterator>
+		Iterator horspool_find(VIterator value_start_iter, VIterator value_end_iter,
+		                       Iterator start_iter, Iterator end_iter,
+		                       const Value &min_value, const Value &max_value) {
+			const Horspool<Value> finder{value_start_iter, value_end_iter, min_value, max_value};
+			return finder.find(start_iter, end_iter);
 		}
 
 		template<class VIterator, class Iterator>
-		Iterator boyer_moore_find(VIterator value_start_iter, VIterator value_end_iter,
-		                          Iterator start_iter, Iterator end_iter) {
-			using ValueType = std::remove_reference_t<decltype(*start_iter)>;
-			return boyer_moore_find(value_start_iter, value_end_iter,
-			                        start_iter, end_iter,
-			                        std::numeric_limits<ValueType>::min(),
-			                        std::numeric_limits<ValueType>::max());
+		Iterator horspool_find(VIterator value_start_iter, VIterator value_end_iter,
+		                       Iterator start_iter, Iterator end_iter) {
+			using ValueType = std::iter_value_t<Iterator>;
+			return horspool_find(value_start_iter, value_end_iter,
+			                     start_iter, end_iter,
+			                     std::numeric_limits<ValueType>::min(),
+			                     std::numeric_limits<ValueType>::max());
 		}
 	}
 
 }
 
-#endif//UTIL_ALGORITHM_HORSPOOL_H
+#endif//ALGORITHM_ALGORITHM_STRING_HORSPOOL_H
@@ -1,5 +1,5 @@
 /*
- * @author: BL-GS 
+ * @author: BL-GS
  * @date:   2023/5/17
  */
 
@@ -8,7 +8,9 @@
 #define ALGORITHM_ALGORITHM_STRING_KMP_H
 
 #include <cstddef>
-#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <iterator>
 #include <limits>
 #include <span>
 #include <vector>
@@ -19,147 +21,257 @@ namespace algorithm {
 
 	inline namespace string {
 
+		enum class KMPMatchMode {
+			/// Matches may share values, e.g. "aa" matches "aaa" twice
+			Overlapping,
+			/// Scanning restarts after a match
+			NonOverlapping
+		};
+
+		/*!
+		 * @brief KMP automaton built once and searched without allocation.
+		 * Short patterns over a small alphabet compile to a DFA over classes of values,
+		 * where values absent from the pattern share one class, and states take 16 bits.
+		 * Other patterns use the failure function, which takes O(pattern size) memory.
+		 */
 		template<class Value>
 		class KMP {
 		public:
 			using ValueType = Value;
 
+			using DFAState = uint16_t;
+
+			using ClassType = uint16_t;
+
+			/// The max size of the DFA table
+			static constexpr size_t DFA_MAX_BYTES = 64 * 1024;
+
+			/// The max amount of kinds of value mapped to classes
+			static constexpr size_t CLASS_MAP_MAX_SIZE = 64 * 1024;
+
 		private:
-			size_t *dp_array_;
-			/// The size of pattern
-			size_t pattern_size_;
-			/// The amount of kinds of value
-			size_t value_amount_;
+			std::vector<ValueType> pattern_;
+			/// The length of the longest proper border of pattern[0, i]
+			std::vector<uint32_t> fail_array_;
+
+			/// Class of each value in [min_value, max_value], where class 0 is for values absent from pattern
+			std::vector<ClassType> class_map_;
+			/// Transitions of DFA, indexed by state * class_amount + class
+			std::vector<DFAState> dfa_table_;
+			/// The amount of classes
+			size_t class_amount_;
+
 			/// The minimal value
 			ValueType min_value_;
+			/// The maximal value
+			ValueType max_value_;
+
+			/// Current state of streaming
+			uint32_t stream_state_;
+			/// The amount of elements fed
+			size_t stream_offset_;
 
 		public:
 			template<class Iterator>
-			KMP(Iterator start_iter, Iterator end_iter) : dp_array_(nullptr), pattern_size_(end_iter - start_iter),
-			                                              value_amount_(std::numeric_limits<ValueType>::max() - std::numeric_limits<ValueType>::min() + 1),
-			                                              min_value_(std::numeric_limits<ValueType>::min()) {
+			KMP(Iterator start_iter, Iterator end_iter):
+			        KMP(start_iter, end_iter, std::numeric_limits<ValueType>::min(), std::numeric_limits<ValueType>::max()) {}
 
-				size_t total_size = pattern_size_ * value_amount_;
-				dp_array_ = new size_t[total_size];
-
-				build_dp_table({start_iter, end_iter}, dp_array_, pattern_size_, value_amount_);
+			template<class Iterator>
+			KMP(Iterator start_iter, Iterator end_iter, const ValueType &min_value, const ValueType &max_value):
+			        pattern_(start_iter, end_iter), class_amount_(0),
+			        min_value_(min_value), max_value_(max_value),
+			        stream_state_(0), stream_offset_(0) {
+
+				build_fail_array();
+
+				// Patterns with values out of range, or alphabets wider than the class map, are left to the failure function.
+				const size_t value_amount = value_range_size(min_value, max_value, CLASS_MAP_MAX_SIZE);
+				const bool in_range = std::all_of(pattern_.begin(), pattern_.end(), [this](const ValueType &value) {
+					return !(value < min_value_ || max_value_ < value);
+				});
+				if (value_amount != 0 && in_range && !pattern_.empty()) {
+					build_class_map(value_amount);
+					if ((pattern_.size() + 1) * class_amount_ * sizeof(DFAState) <= DFA_MAX_BYTES) {
+						build_dfa_table();
+					}
+					else {
+						class_map_.clear();
+						class_amount_ = 0;
+					}
+				}
 			}
 
-			template<class Iterator>
-			KMP(Iterator start_iter, Iterator end_iter,
-			    const ValueType &min_value, const ValueType &max_value) : dp_array_(nullptr), pattern_size_(end_iter - start_iter),
-			                                                                                                      value_amount_(max_value - min_value + 1), min_value_(min_value) {
+		public:
+			size_t pattern_size() const { return pattern_.size(); }
 
-				size_t total_size = pattern_size_ * value_amount_;
-				dp_array_ = new size_t[total_size];
+			bool is_dfa() const { return !dfa_table_.empty(); }
 
-				build_dp_table({start_iter, end_iter}, dp_array_, pattern_size_, value_amount_);
+			/*!
+			 * @brief Transit from state, i.e. the length of the matched prefix, by a value.
+			 * The state after a full match continues with the border of pattern.
+			 */
+			uint32_t next_state(uint32_t state, const ValueType &value) const {
+				return is_dfa() ? next_state_impl<true>(state, value) : next_state_impl<false>(state, value);
 			}
 
-			~KMP() noexcept {
-				delete[] dp_array_;
+			/*!
+			 * @brief Find the first occurrence of pattern
+			 * @return The start of the match, or end_iter if there is none
+			 */
+			template<class Iterator>
+			Iterator find(Iterator start_iter, Iterator end_iter) const {
+				size_t match_pos = 0;
+				bool   found     = pattern_.empty();
+				scan(start_iter, end_iter, 0, 0, KMPMatchMode::Overlapping, [&](size_t offset) {
+					match_pos = offset;
+					found     = true;
+					return false;
+				});
+				return found ? std::next(start_iter, match_pos) : end_iter;
 			}
 
-		public:
+			/*!
+			 * @brief Find all overlapping occurrences of pattern
+			 * @return The starts of matches
+			 */
 			template<class Iterator>
-			Iterator find(Iterator start_iter, Iterator end_iter) {
-				size_t total_size = pattern_size_ * value_amount_;
-				return find(start_iter, end_iter, {dp_array_, total_size}, pattern_size_);
+			std::vector<Iterator> find_all(Iterator start_iter, Iterator end_iter) const {
+				std::vector<Iterator> res_iters;
+				scan(start_iter, end_iter, 0, 0, KMPMatchMode::Overlapping, [&](size_t offset) {
+					res_iters.emplace_back(std::next(start_iter, offset));
+					return true;
+				});
+				return res_iters;
 			}
 
-			template<class Iterator>
-			std::vector<Iterator> find_all(Iterator start_iter, Iterator end_iter) {
-				size_t total_size = pattern_size_ * value_amount_;
-				return find_all(start_iter, end_iter, {dp_array_, total_size}, pattern_size_);
+			/*!
+			 * @brief Find occurrences of pattern into a buffer provided by the caller, without allocation
+			 * @return The amount of positions written, which stops at the size of buffer
+			 */
+			size_t find_all(std::span<const ValueType> base, std::span<size_t> pos_array,
+			                KMPMatchMode mode = KMPMatchMode::Overlapping) const {
+				size_t amount = 0;
+				if (pos_array.empty()) { return 0; }
+				scan(base.begin(), base.end(), 0, 0, mode, [&](size_t offset) {
+					pos_array[amount++] = offset;
+					return amount < pos_array.size();
+				});
+				return amount;
 			}
 
-		private:
-			constexpr size_t get_dp_idx(size_t pattern_idx, const ValueType &pattern_value) {
-				return get_dp_idx(pattern_idx, pattern_value, value_amount_, min_value_);
+			/*!
+			 * @brief Feed a chunk of a stream, with matches across chunks reported,
+			 * and offsets counted from the start of the stream.
+			 * @param callback Called with the offset of the match start
+			 */
+			template<class Callback>
+			void feed(std::span<const ValueType> chunk, Callback &&callback,
+			          KMPMatchMode mode = KMPMatchMode::Overlapping) {
+				stream_state_ = scan(chunk.begin(), chunk.end(), stream_state_, stream_offset_, mode, [&](size_t offset) {
+					callback(offset);
+					return true;
+				});
+				stream_offset_ += chunk.size();
 			}
 
-		public:
-			static constexpr size_t get_dp_idx(size_t pattern_idx, const ValueType &pattern_value,
-			                                   size_t value_amount, const ValueType &min_value) {
-				return pattern_idx * value_amount + (pattern_value - min_value);
+			/*!
+			 * @brief Restart the stream
+			 */
+			void reset() {
+				stream_state_  = 0;
+				stream_offset_ = 0;
 			}
 
-			static constexpr size_t get_dp_idx(size_t pattern_idx, size_t pattern_value_idx,
-			                                   size_t value_amount) {
-				return pattern_idx * value_amount + pattern_value_idx;
+		private:
+			ClassType get_class(const ValueType &value) const {
+				if (value < min_value_ || max_value_ < value) { return 0; }
+				return class_map_[value_offset(value, min_value_)];
 			}
 
-			static constexpr void build_dp_table(std::span<ValueType> pattern, std::span<size_t> dp_array,
-			                                     size_t pattern_size, size_t value_amount,
-			                                     const ValueType &min_value) {
-				auto inner_dp = [&](size_t pattern_idx, const ValueType &pattern_value) -> std::add_lvalue_reference_t<size_t> {
-					return dp_array[get_dp_idx(pattern_idx, pattern_value, value_amount, min_value)];
-				};
+			template<bool DFA>
+			uint32_t next_state_impl(uint32_t state, const ValueType &value) const {
+				if constexpr (DFA) {
+					return dfa_table_[state * class_amount_ + get_class(value)];
+				}
+				else {
+					const uint32_t pattern_size = static_cast<uint32_t>(pattern_.size());
+					if (state == pattern_size) { state = fail_array_[state - 1]; }
+					while (state > 0 && !(pattern_[state] == value)) {
+						state = fail_array_[state - 1];
+					}
+					return (pattern_[state] == value) ? state + 1 : 0;
+				}
+			}
 
-				auto inner_dp_direct = [&](size_t pattern_idx, size_t pattern_value_idx) -> std::add_lvalue_reference_t<size_t> {
-					return dp_array[get_dp_idx(pattern_idx, pattern_value_idx, value_amount)];
-				};
+			/*!
+			 * @brief Scan from state, where offset is that of the first element
+			 * @param visit Called with the offset of each match start, which returns false to stop
+			 * @return The state after scanning
+			 */
+			template<class Iterator, class Visit>
+			uint32_t scan(Iterator start_iter, Iterator end_iter, uint32_t state, size_t offset,
+			              KMPMatchMode mode, Visit &&visit) const {
+				if (is_dfa()) { return scan_impl<true>(start_iter, end_iter, state, offset, mode, visit); }
+				return scan_impl<false>(start_iter, end_iter, state, offset, mode, visit);
+			}
 
-				size_t total_size = pattern_size * value_amount;
-				assert(dp_array.size() >= total_size);
+			template<bool DFA, class Iterator, class Visit>
+			uint32_t scan_impl(Iterator start_iter, Iterator end_iter, uint32_t state, size_t offset,
+			                   KMPMatchMode mode, Visit &visit) const {
+				const size_t pattern_size = pattern_.size();
+				if (pattern_size == 0) { return state; }
+
+				for (Iterator iter = start_iter; iter != end_iter; ++iter, ++offset) {
+					state = next_state_impl<DFA>(state, *iter);
+					if (state == pattern_size) {
+						if (!visit(offset + 1 - pattern_size)) { break; }
+						if (mode == KMPMatchMode::NonOverlapping) { state = 0; }
+					}
+				}
+				return state;
+			}
 
-				// Calculate DP array
-				std::memset(dp_array.data(), 0, total_size * sizeof(size_t));
-				inner_dp(0, pattern[0]) = 1;
+			void build_fail_array() {
+				const size_t pattern_size = pattern_.size();
+				fail_array_.assign(pattern_size, 0);
 
-				size_t shadow_idx = 0;
-				for (size_t i = 1; i < pattern_size; ++i) {
-					for (size_t k = 0; k < value_amount; ++k) {
-						inner_dp_direct(i, k) = inner_dp_direct(shadow_idx, k);
+				uint32_t border = 0;
+				for (size_t idx = 1; idx < pattern_size; ++idx) {
+					while (border > 0 && !(pattern_[idx] == pattern_[border])) {
+						border = fail_array_[border - 1];
 					}
-					inner_dp(i, pattern[i]) = i + 1;
-					shadow_idx = inner_dp(shadow_idx, pattern[i]);
+					if (pattern_[idx] == pattern_[border]) { ++border; }
+					fail_array_[idx] = border;
 				}
 			}
 
-			template<class Iterator>
-			static constexpr Iterator find(Iterator start_iter, Iterator end_iter,
-			                               std::span<size_t> dp_array,
-			                               size_t pattern_size, size_t value_amount,
-			                               const ValueType &min_value) {
-				// Find sub string
-				size_t pattern_iter_pos = 0;
-				for (Iterator iter = start_iter; iter != end_iter; ++iter) {
-					size_t pos = iter - start_iter;
-					// State transition
-					pattern_iter_pos = dp_array[get_dp_idx(pattern_iter_pos, *iter, value_amount, min_value)];
-
-					if (pattern_iter_pos == pattern_size) {// If the pattern is entirely matched.
-						// Return the result
-						return iter - pattern_size + 1;
-					}
+			void build_class_map(size_t value_amount) {
+				class_map_.assign(value_amount, 0);
+				class_amount_ = 1;
+				for (const auto &value: pattern_) {
+					ClassType &value_class = class_map_[value_offset(value, min_value_)];
+					if (value_class == 0) { value_class = static_cast<ClassType>(class_amount_++); }
 				}
-				// No match
-				return end_iter;
 			}
 
-			template<class Iterator>
-			static constexpr std::vector<Iterator> find_all(Iterator start_iter, Iterator end_iter,
-			                                                std::span<size_t> dp_array,
-			                                                size_t pattern_size, size_t value_amount,
-			                                                const ValueType &min_value) {
-				std::vector<Iterator> res_iters;
-				// Find sub string
-				size_t pattern_iter_pos = 0;
-				for (Iterator iter = start_iter; iter != end_iter; ++iter) {
-					// State transition
-					pattern_iter_pos = dp_array[get_dp_idx(pattern_iter_pos, *iter, value_amount, min_value)];
-
-					if (pattern_iter_pos == pattern_size) {// If the pattern is entirely matched.
-						// Add a result
-						Iterator res_iter = iter - pattern_size + 1;
-						res_iters.emplace_back(res_iter);
-						// Reset scanner
-						iter = res_iters + 1;
-						pattern_iter_pos = 0;
+			/// State j has matched j values, where the row of the full match is that of its border.
+			void build_dfa_table() {
+				const size_t pattern_size = pattern_.size();
+				dfa_table_.assign((pattern_size + 1) * class_amount_, 0);
+
+				auto pattern_class = [this](size_t idx) { return get_class(pattern_[idx]); };
+
+				dfa_table_[pattern_class(0)] = 1;
+				size_t shadow_state = 0;
+				for (size_t state = 1; state <= pattern_size; ++state) {
+					std::copy_n(dfa_table_.begin() + shadow_state * class_amount_, class_amount_,
+					            dfa_table_.begin() + state * class_amount_);
+					if (state < pattern_size) {
+						const ClassType value_class = pattern_class(state);
+						dfa_table_[state * class_amount_ + value_class] = static_cast<DFAState>(state + 1);
+						shadow_state = dfa_table_[shadow_state * class_amount_ + value_class];
 					}
 				}
-				return res_iters;
 			}
 		};
 
@@ -167,58 +279,14 @@ namespace algorithm {
 		inline Iterator kmp_find(VIterator value_start_iter, VIterator value_end_iter,
 		                         Iterator start_iter, Iterator end_iter,
 		                         const Value &min_value, const Value &max_value) {
-
-			using PatternValueType = std::remove_reference_t<decltype(*value_start_iter)>;
-			using BaseValueType    = std::remove_reference_t<decltype(*start_iter)>;
-			using KMPStrategy      = KMP<Value>;
-
-			constexpr size_t STACK_ARRAY_LIMIT = 512;
-
-			std::span<PatternValueType> pattern{value_start_iter, value_end_iter};
-
-			size_t pattern_size = pattern.size();
-			size_t value_amount = max_value - min_value + 1;
-			size_t total_size   = pattern_size * value_amount;
-
-			if (total_size > STACK_ARRAY_LIMIT) {
-				size_t *dp_array = new size_t[total_size];
-
-				// Calculate DP array
-				KMPStrategy::build_dp_table(pattern, {dp_array, total_size},
-				                            pattern_size, value_amount,
-				                            min_value);
-				// Find sub string
-				auto res_iter = KMPStrategy::find(start_iter, end_iter,
-				                                  {dp_array, total_size},
-				                                  pattern_size, value_amount,
-				                                  min_value);
-
-				delete[] dp_array;
-				return res_iter;
-			}
-			else {
-				size_t dp_array[total_size];
-
-				// Calculate DP array
-				KMPStrategy::build_dp_table(pattern, {dp_array, total_size},
-				                            pattern_size, value_amount,
-				                            min_value);
-				// Find sub string
-				auto res_iter = KMPStrategy::find(start_iter, end_iter,
-				                                  {dp_array, total_size},
-				                                  pattern_size, value_amount,
-				                                  min_value);
-
-				return res_iter;
-			}
-
-			return end_iter;
+			const KMP<Value> finder{value_start_iter, value_end_iter, min_value, max_value};
+			return finder.find(start_iter, end_iter);
 		}
 
 		template<class VIterator, class Iterator>
 		Iterator kmp_find(VIterator value_start_iter, VIterator value_end_iter,
 		                  Iterator start_iter, Iterator end_iter) {
-			using ValueType    = std::remove_reference_t<decltype(*start_iter)>;
+			using ValueType = std::iter_value_t<Iterator>;
 			return kmp_find(
 			        value_start_iter, value_end_iter,
 			        start_iter, end_iter,
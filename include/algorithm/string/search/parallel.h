@@ -0,0 +1,138 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_ALGORITHM_STRING_PARALLEL_H
+#define ALGORITHM_ALGORITHM_STRING_PARALLEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <file/file_descriptor.h>
+#include <thread/cpu_bind_thread.h>
+#include <algorithm/string/search/base.h>
+#include <algorithm/string/search/stream.h>
+#include <algorithm/string/search/simd.h>
+
+namespace algorithm {
+
+	inline namespace string {
+
+		/// The default size of chunks searched by a worker at a time, which is rounded up to pages
+		inline constexpr size_t PARALLEL_FIND_CHUNK_SIZE = 4 * 1024 * 1024;
+
+		/*!
+		 * @brief Find all (overlapping) matches by workers taking page-aligned chunks in turn.
+		 * Each chunk is searched with pattern_size - 1 values of the next chunk,
+		 * and keeps matches starting inside itself, so that results of chunks are disjoint and in order.
+		 * @param prefetch_func Called with the index of a chunk which is going to be searched soon
+		 * @return Sorted offsets of match starts
+		 */
+		template<SearcherConcept Searcher, class PrefetchFunc>
+		std::vector<size_t> parallel_find_all_impl(std::span<const uint8_t> base, std::span<const uint8_t> pattern,
+		                                           size_t thread_amount, size_t chunk_size, PrefetchFunc &&prefetch_func) {
+			const size_t pattern_size = pattern.size();
+			if (pattern_size == 0 || base.size() < pattern_size) { return {}; }
+
+			const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+			chunk_size = (std::max(chunk_size, pattern_size) + page_size - 1) / page_size * page_size;
+
+			const size_t chunk_amount = (base.size() + chunk_size - 1) / chunk_size;
+			thread_amount = std::clamp<size_t>(thread_amount, 1, chunk_amount);
+
+			const Searcher searcher{pattern.begin(), pattern.end()};
+			std::vector<std::vector<size_t>> chunk_res_array(chunk_amount);
+			std::atomic<size_t> next_chunk_idx{0};
+
+			auto worker_func = [&] {
+				while (true) {
+					const size_t chunk_idx = next_chunk_idx.fetch_add(1, std::memory_order::relaxed);
+					if (chunk_idx >= chunk_amount) { break; }
+					if (chunk_idx + thread_amount < chunk_amount) { prefetch_func(chunk_idx + thread_amount); }
+
+					const size_t chunk_start = chunk_idx * chunk_size;
+					const size_t chunk_end   = std::min(chunk_start + chunk_size, base.size());
+					const size_t search_end  = std::min(chunk_end + pattern_size - 1, base.size());
+
+					const uint8_t *end_ptr = base.data() + search_end;
+					for (const uint8_t *ptr = base.data() + chunk_start; ptr < end_ptr; ++ptr) {
+						ptr = searcher.find(ptr, end_ptr);
+						const size_t offset = ptr - base.data();
+						if (ptr == end_ptr || offset >= chunk_end) { break; }
+						chunk_res_array[chunk_idx].push_back(offset);
+					}
+				}
+			};
+
+			if (thread_amount == 1) {
+				worker_func();
+			}
+			else {
+				std::vector<std::unique_ptr<thread::CPUBindThread>> thread_array;
+				for (size_t thread_idx = 0; thread_idx < thread_amount; ++thread_idx) {
+					thread_array.emplace_back(std::make_unique<thread::CPUBindThread>(worker_func));
+				}
+				for (auto &thread_ptr: thread_array) { thread_ptr->get_origin_thread().join(); }
+			}
+
+			// Chunks are disjoint and in order, so that merging is concatenation.
+			size_t res_amount = 0;
+			for (const auto &chunk_res: chunk_res_array) { res_amount += chunk_res.size(); }
+			std::vector<size_t> res_array;
+			res_array.reserve(res_amount);
+			for (const auto &chunk_res: chunk_res_array) {
+				res_array.insert(res_array.end(), chunk_res.begin(), chunk_res.end());
+			}
+			return res_array;
+		}
+
+		/*!
+		 * @brief Find all matches of pattern in a range by workers pinned to cpus
+		 * @return Sorted offsets of match starts
+		 */
+		template<SearcherConcept Searcher = SIMDSearcher<uint8_t>>
+		std::vector<size_t> parallel_find_all(std::span<const uint8_t> base, std::span<const uint8_t> pattern,
+		                                      size_t thread_amount = std::thread::hardware_concurrency(),
+		                                      size_t chunk_size = PARALLEL_FIND_CHUNK_SIZE) {
+			return parallel_find_all_impl<Searcher>(base, pattern, thread_amount, chunk_size, [](size_t) {});
+		}
+
+		/*!
+		 * @brief Find all matches of pattern in a mapped file by workers pinned to cpus,
+		 * with the whole area advised sequential and chunks ahead of workers advised to be read ahead.
+		 * @return Sorted offsets of match starts
+		 */
+		template<SearcherConcept Searcher = SIMDSearcher<uint8_t>>
+		std::vector<size_t> parallel_find_all(const file::FileMapper &mapper, std::span<const uint8_t> pattern,
+		                                      size_t thread_amount = std::thread::hardware_concurrency(),
+		                                      size_t chunk_size = PARALLEL_FIND_CHUNK_SIZE) {
+			const std::span<const uint8_t> base = mapper.get_map_area();
+			if (base.empty()) { return {}; }
+
+			const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+			const size_t aligned_chunk_size = (std::max(chunk_size, pattern.size()) + page_size - 1) / page_size * page_size;
+
+			mapper.advise(file::FileMmapAdvice::Sequential);
+			// The first chunk of each worker
+			mapper.advise(file::FileMmapAdvice::WillNeed, 0, aligned_chunk_size * std::max<size_t>(thread_amount, 1));
+
+			return parallel_find_all_impl<Searcher>(base, pattern, thread_amount, aligned_chunk_size, [&](size_t chunk_idx) {
+				mapper.advise(file::FileMmapAdvice::WillNeed, chunk_idx * aligned_chunk_size, aligned_chunk_size);
+			});
+		}
+
+	}
+
+}
+
+#endif//ALGORITHM_ALGORITHM_STRING_PARALLEL_H
@@ -0,0 +1,90 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_ALGORITHM_STRING_SIMD_H
+#define ALGORITHM_ALGORITHM_STRING_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <algorithm/simd/search.h>
+#include <algorithm/string/search/base.h>
+#include <algorithm/string/search/simple.h>
+#include <algorithm/string/search/horspool.h>
+
+namespace algorithm {
+
+	inline namespace string {
+
+		/// Both pattern and base are contiguous arrays of the same byte type, which are searched by vectors
+		template<class VIterator, class Iterator>
+		inline constexpr bool SIMD_FIND_ENABLE = std::contiguous_iterator<VIterator> && std::contiguous_iterator<Iterator>
+		                                       && std::same_as<std::iter_value_t<VIterator>, std::iter_value_t<Iterator>>
+		                                       && sizeof(std::iter_value_t<Iterator>) == 1
+		                                       && std::is_trivially_copyable_v<std::iter_value_t<Iterator>>;
+
+		/*!
+		 * @brief Find the first occurrence of pattern, where candidates are filtered by its first and last bytes
+		 * a vector at a time and verified by memcmp. Non-contiguous ranges of bytes fall back to Horspool,
+		 * and those of other types to the simple search.
+		 */
+		template<class VIterator, class Iterator>
+		Iterator simd_find(VIterator value_start_iter, VIterator value_end_iter,
+		                   Iterator start_iter, Iterator end_iter) {
+			using ValueType = std::iter_value_t<Iterator>;
+
+			if constexpr (SIMD_FIND_ENABLE<VIterator, Iterator>) {
+				const auto *pattern_ptr = reinterpret_cast<const uint8_t *>(std::to_address(value_start_iter));
+				const auto *base_ptr    = reinterpret_cast<const uint8_t *>(std::to_address(start_iter));
+				const size_t pattern_size = value_end_iter - value_start_iter;
+				const size_t base_size    = end_iter - start_iter;
+
+				const size_t pos = simd::find_substring(base_ptr, base_size, pattern_ptr, pattern_size);
+				return pos >= base_size && pattern_size != 0 ? end_iter : start_iter + pos;
+			}
+			else if constexpr (std::random_access_iterator<VIterator> && std::random_access_iterator<Iterator>
+			                   && std::integral<ValueType> && sizeof(ValueType) == 1) {
+				return horspool_find(value_start_iter, value_end_iter, start_iter, end_iter);
+			}
+			else {
+				if (value_start_iter == value_end_iter) { return start_iter; }
+				return simple_find(value_start_iter, value_end_iter, start_iter, end_iter);
+			}
+		}
+
+		/*!
+		 * @brief Searcher of simd_find with a fixed pattern
+		 */
+		template<class Value>
+		class SIMDSearcher {
+		public:
+			using ValueType = Value;
+
+		private:
+			std::vector<ValueType> pattern_;
+
+		public:
+			template<class Iterator>
+			SIMDSearcher(Iterator start_iter, Iterator end_iter): pattern_(start_iter, end_iter) {}
+
+		public:
+			size_t pattern_size() const { return pattern_.size(); }
+
+			template<class Iterator>
+			Iterator find(Iterator start_iter, Iterator end_iter) const {
+				return simd_find(pattern_.begin(), pattern_.end(), start_iter, end_iter);
+			}
+		};
+
+	}
+
+}
+
+#endif//ALGORITHM_ALGORITHM_STRING_SIMD_H
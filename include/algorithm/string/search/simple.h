@@ -9,6 +9,7 @@
 
 #include <cstddef>
 #include <limits>
+#include <vector>
 
 #include <algorithm/string/search/base.h>
 
@@ -37,7 +38,7 @@ namespace algorithm {
 					VIterator pattern_iter = value_start_iter;
 
 					while (pattern_iter != value_end_iter) {
-						if (*match_iter != *pattern_iter) { break; }
+						if (match_iter == end_iter || *match_iter != *pattern_iter) { break; }
 						++match_iter;
 						++pattern_iter;
 					}
@@ -67,7 +68,7 @@ namespace algorithm {
 					VIterator pattern_iter = value_start_iter;
 
 					while (pattern_iter != value_end_iter) {
-						if (*match_iter != *pattern_iter) { break; }
+						if (match_iter == end_iter || *match_iter != *pattern_iter) { break; }
 						++match_iter;
 						++pattern_iter;
 					}
@@ -78,6 +79,27 @@ namespace algorithm {
 			return end_iter;
 		}
 
+		template<class Value>
+		class SimpleSearcher {
+		public:
+			using ValueType = Value;
+
+		private:
+			std::vector<ValueType> pattern_;
+
+		public:
+			template<class Iterator>
+			SimpleSearcher(Iterator start_iter, Iterator end_iter): pattern_(start_iter, end_iter) {}
+
+		public:
+			size_t pattern_size() const { return pattern_.size(); }
+
+			template<class Iterator>
+			Iterator find(Iterator start_iter, Iterator end_iter) const {
+				if (pattern_.empty()) { return start_iter; }
+				return simple_find(pattern_.begin(), pattern_.end(), start_iter, end_iter);
+			}
+		};
 
 	}
 
@@ -0,0 +1,139 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_ALGORITHM_STRING_STREAM_H
+#define ALGORITHM_ALGORITHM_STRING_STREAM_H
+
+#include <cstddef>
+#include <algorithm>
+#include <concepts>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <algorithm/string/search/base.h>
+
+namespace algorithm {
+
+	inline namespace string {
+
+		/*!
+		 * @brief Searchers with a fixed pattern, which find the first match in a contiguous range
+		 */
+		template<class Searcher>
+		concept SearcherConcept = requires(const Searcher &searcher, const typename Searcher::ValueType *ptr) {
+			typename Searcher::ValueType;
+			{ searcher.pattern_size() } -> std::convertible_to<size_t>;
+			{ searcher.find(ptr, ptr) } -> std::same_as<const typename Searcher::ValueType *>;
+		};
+
+		/*!
+		 * @brief Search a stream fed by chunks, with matches reported by absolute offsets from the start of the stream.
+		 * The last pattern_size - 1 values are kept to catch matches across chunks,
+		 * which are searched in a scratch of at most 2 * (pattern_size - 1) values,
+		 * while each chunk is searched in place. Hence the memory is bounded regardless of the stream.
+		 */
+		template<SearcherConcept Searcher>
+		class StreamSearcher {
+		public:
+			using ValueType = typename Searcher::ValueType;
+
+		private:
+			Searcher searcher_;
+			/// The tail of values fed, of at most pattern_size - 1
+			std::vector<ValueType> overlap_array_;
+			/// Buffer for searching across the boundary of chunks
+			std::vector<ValueType> scratch_array_;
+			/// The amount of values fed
+			size_t stream_offset_;
+
+		public:
+			/*!
+			 * @brief Construct the searcher in place by arguments
+			 */
+			template<class ...Args>
+			explicit StreamSearcher(Args &&...args): searcher_(std::forward<Args>(args)...), stream_offset_(0) {
+				const size_t overlap_size = (searcher_.pattern_size() == 0) ? 0 : searcher_.pattern_size() - 1;
+				overlap_array_.reserve(overlap_size);
+				scratch_array_.reserve(2 * overlap_size);
+			}
+
+		public:
+			const Searcher &get_searcher() const { return searcher_; }
+
+			size_t get_offset() const { return stream_offset_; }
+
+			/*!
+			 * @brief Feed the next chunk, where all (overlapping) matches ending in it are reported
+			 * @param callback Called with the absolute offset of each match start, in ascending order
+			 */
+			template<class Callback>
+			void feed(std::span<const ValueType> chunk, Callback &&callback) {
+				const size_t pattern_size = searcher_.pattern_size();
+				if (pattern_size == 0) {
+					stream_offset_ += chunk.size();
+					return;
+				}
+				const size_t overlap_size = pattern_size - 1;
+
+				// Matches starting in the overlap, which end in the scratch if they end in this chunk
+				if (!overlap_array_.empty()) {
+					const size_t head_size = std::min(chunk.size(), overlap_size);
+					scratch_array_.assign(overlap_array_.begin(), overlap_array_.end());
+					scratch_array_.insert(scratch_array_.end(), chunk.begin(), chunk.begin() + head_size);
+
+					const size_t scratch_base = stream_offset_ - overlap_array_.size();
+					find_all(scratch_array_.data(), scratch_array_.data() + scratch_array_.size(), [&](size_t pos) {
+						if (pos >= overlap_array_.size()) { return false; }
+						callback(scratch_base + pos);
+						return true;
+					});
+				}
+
+				find_all(chunk.data(), chunk.data() + chunk.size(), [&](size_t pos) {
+					callback(stream_offset_ + pos);
+					return true;
+				});
+
+				// Keep the tail of all values fed
+				if (chunk.size() >= overlap_size) {
+					overlap_array_.assign(chunk.end() - overlap_size, chunk.end());
+				}
+				else {
+					overlap_array_.insert(overlap_array_.end(), chunk.begin(), chunk.end());
+					if (overlap_array_.size() > overlap_size) {
+						overlap_array_.erase(overlap_array_.begin(), overlap_array_.end() - overlap_size);
+					}
+				}
+				stream_offset_ += chunk.size();
+			}
+
+			/*!
+			 * @brief Restart the stream
+			 */
+			void reset() {
+				overlap_array_.clear();
+				stream_offset_ = 0;
+			}
+
+		private:
+			/*!
+			 * @brief Visit the position of each match in [start_ptr, end_ptr), which returns false to stop
+			 */
+			template<class Visit>
+			void find_all(const ValueType *start_ptr, const ValueType *end_ptr, Visit &&visit) const {
+				for (const ValueType *ptr = start_ptr; ptr < end_ptr; ++ptr) {
+					ptr = searcher_.find(ptr, end_ptr);
+					if (ptr == end_ptr || !visit(static_cast<size_t>(ptr - start_ptr))) { break; }
+				}
+			}
+		};
+
+	}
+
+}
+
+#endif//ALGORITHM_ALGORITHM_STRING_STREAM_H
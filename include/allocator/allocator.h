@@ -10,5 +10,8 @@
 
 #include <allocator/simple_allocator/simple_allocator.h>
 #include <allocator/reserve_allocator/reserve_allocator.h>
+#include <allocator/numa_allocator/numa_allocator.h>
+#include <allocator/arena_allocator/arena_allocator.h>
+#include <allocator/persistent_allocator/persistent_allocator.h>
 
 #endif
\ No newline at end of file
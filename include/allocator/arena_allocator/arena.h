@@ -0,0 +1,175 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_ALLOCATOR_ARENA_H
+#define ALGORITHM_ALLOCATOR_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <new>
+
+#include <util/calculate.h>
+#include <allocator/base_allocator.h>
+
+namespace algorithm::allocator {
+
+	/*!
+	 * @brief Monotonic arena bumping memory from chained blocks.
+	 * Memory is never released one by one, but all at once by reset() or back to a marker by rewind().
+	 * @note The arena is not thread-safe.
+	 */
+	class Arena {
+	public:
+		/// The size of the first block
+		static constexpr size_t INIT_BLOCK_SIZE = 4 * 1024;
+		/// Blocks grow twice each time until the limit
+		static constexpr size_t MAX_BLOCK_SIZE  = 1024 * 1024;
+
+		static constexpr size_t DEFAULT_ALIGN   = alignof(std::max_align_t);
+
+	private:
+		struct BlockHeader {
+			/// The block allocated before this one
+			BlockHeader *prev_block_ptr_;
+			/// The size of block including header
+			size_t block_size_;
+		};
+
+		static constexpr size_t BLOCK_HEADER_SIZE = util::ceil(sizeof(BlockHeader), DEFAULT_ALIGN);
+
+	public:
+		/*!
+		 * @brief A position in the arena, which can be rewound to later.
+		 */
+		struct Marker {
+			BlockHeader *block_ptr_;
+
+			uint8_t *cur_ptr_;
+		};
+
+	private:
+		BlockHeader *cur_block_ptr_;
+
+		uint8_t *cur_ptr_;
+
+		uint8_t *end_ptr_;
+		/// The size of the next block for growth
+		size_t next_block_size_;
+
+	public:
+		explicit Arena(size_t init_block_size = INIT_BLOCK_SIZE):
+		        cur_block_ptr_(nullptr), cur_ptr_(nullptr), end_ptr_(nullptr),
+		        next_block_size_(std::max(init_block_size, BLOCK_HEADER_SIZE * 2)) {}
+
+		Arena(const Arena &other) = delete;
+
+		Arena(Arena &&other) noexcept:
+		        cur_block_ptr_(other.cur_block_ptr_), cur_ptr_(other.cur_ptr_), end_ptr_(other.end_ptr_),
+		        next_block_size_(other.next_block_size_) {
+			other.cur_block_ptr_ = nullptr;
+			other.cur_ptr_ = other.end_ptr_ = nullptr;
+		}
+
+		~Arena() {
+			release_block_until(nullptr);
+		}
+
+	public:
+		void *allocate(size_t size, size_t align = DEFAULT_ALIGN) {
+			uint8_t *res_ptr = align_ptr(cur_ptr_, align);
+			if (res_ptr + size > end_ptr_ || cur_ptr_ == nullptr) [[unlikely]] {
+				allocate_block(size + align);
+				res_ptr = align_ptr(cur_ptr_, align);
+			}
+			cur_ptr_ = res_ptr + size;
+			return res_ptr;
+		}
+
+		/*!
+		 * @brief Release all memory at once, with the latest block kept for reuse.
+		 * @note All markers are invalidated.
+		 */
+		void reset() {
+			if (cur_block_ptr_ == nullptr) { return; }
+
+			BlockHeader *keep_block_ptr = cur_block_ptr_;
+			release_block_until(nullptr, keep_block_ptr);
+
+			keep_block_ptr->prev_block_ptr_ = nullptr;
+			cur_block_ptr_ = keep_block_ptr;
+			cur_ptr_       = reinterpret_cast<uint8_t *>(keep_block_ptr) + BLOCK_HEADER_SIZE;
+		}
+
+		/*!
+		 * @brief Acquire the current position, so that memory allocated later can be released by rewind()
+		 */
+		[[nodiscard]] Marker get_marker() const {
+			return { cur_block_ptr_, cur_ptr_ };
+		}
+
+		/*!
+		 * @brief Release memory allocated after the marker
+		 */
+		void rewind(const Marker &marker) {
+			release_block_until(marker.block_ptr_);
+
+			cur_block_ptr_ = marker.block_ptr_;
+			cur_ptr_       = marker.cur_ptr_;
+			end_ptr_       = (marker.block_ptr_ == nullptr) ?
+			                 nullptr : reinterpret_cast<uint8_t *>(marker.block_ptr_) + marker.block_ptr_->block_size_;
+		}
+
+		/*!
+		 * @brief Acquire the total size of blocks held by the arena
+		 */
+		[[nodiscard]] size_t get_reserved_size() const {
+			size_t res = 0;
+			for (BlockHeader *block_ptr = cur_block_ptr_; block_ptr != nullptr; block_ptr = block_ptr->prev_block_ptr_) {
+				res += block_ptr->block_size_;
+			}
+			return res;
+		}
+
+	private:
+		void allocate_block(size_t min_size) {
+			size_t block_size = std::max(next_block_size_, min_size + BLOCK_HEADER_SIZE);
+			next_block_size_  = std::min(next_block_size_ * 2, std::max(MAX_BLOCK_SIZE, next_block_size_));
+
+			void *block_ptr = BaseAllocator::allocate(block_size);
+			if (block_ptr == nullptr) { throw std::bad_alloc(); }
+
+			cur_block_ptr_ = new (block_ptr) BlockHeader{
+			        .prev_block_ptr_ = cur_block_ptr_,
+			        .block_size_     = block_size
+			};
+			cur_ptr_ = static_cast<uint8_t *>(block_ptr) + BLOCK_HEADER_SIZE;
+			end_ptr_ = static_cast<uint8_t *>(block_ptr) + block_size;
+		}
+
+		/*!
+		 * @brief Release blocks from the current one back to (excluding) the last block
+		 * @param keep_block_ptr The block excluded from releasing
+		 */
+		void release_block_until(BlockHeader *last_block_ptr, BlockHeader *keep_block_ptr = nullptr) {
+			BlockHeader *block_ptr = cur_block_ptr_;
+			while (block_ptr != last_block_ptr) {
+				BlockHeader *prev_block_ptr = block_ptr->prev_block_ptr_;
+				if (block_ptr != keep_block_ptr) {
+					BaseAllocator::deallocate(block_ptr, block_ptr->block_size_);
+				}
+				block_ptr = prev_block_ptr;
+			}
+		}
+
+		static uint8_t *align_ptr(uint8_t *ptr, size_t align) {
+			return reinterpret_cast<uint8_t *>(util::ceil_2pow(reinterpret_cast<uintptr_t>(ptr), align));
+		}
+	};
+
+}
+
+#endif//ALGORITHM_ALLOCATOR_ARENA_H
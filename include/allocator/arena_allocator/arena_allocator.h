@@ -0,0 +1,136 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_ALLOCATOR_ARENA_ALLOCATOR_H
+#define ALGORITHM_ALLOCATOR_ARENA_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <utility>
+#include <concepts>
+
+#include <util/type.h>
+#include <allocator/arena_allocator/arena.h>
+
+namespace algorithm::allocator {
+
+	namespace detail {
+
+		inline Arena *&current_arena_ptr() {
+			thread_local Arena thread_arena;
+			thread_local Arena *cur_arena_ptr = &thread_arena;
+			return cur_arena_ptr;
+		}
+
+	}
+
+	/*!
+	 * @brief Acquire the arena used by allocators constructed by default in the current thread
+	 */
+	inline Arena &get_current_arena() {
+		return *detail::current_arena_ptr();
+	}
+
+	/*!
+	 * @brief Make allocators constructed by default in the scope draw from the arena.
+	 * As containers construct their allocators by default, this is how a container graph is put into one arena.
+	 */
+	class ArenaScope {
+	private:
+		Arena *prev_arena_ptr_;
+
+	public:
+		explicit ArenaScope(Arena &arena): prev_arena_ptr_(detail::current_arena_ptr()) {
+			detail::current_arena_ptr() = &arena;
+		}
+
+		ArenaScope(const ArenaScope &other) = delete;
+
+		~ArenaScope() {
+			detail::current_arena_ptr() = prev_arena_ptr_;
+		}
+	};
+
+	/*!
+	 * @brief Allocator bumping memory from an arena, on which deallocation is a no-op.
+	 * Memory is released all at once by Arena::reset() or Arena::rewind().
+	 * Rebound allocators share the same arena.
+	 */
+	template<class T>
+	class ArenaAllocator {
+	public:
+		using AllocateType = T;
+
+		template<class U>
+		struct Rebind {
+			using type = ArenaAllocator<U>;
+		};
+
+		template<class U>
+		friend class ArenaAllocator;
+
+	private:
+		Arena *arena_ptr_;
+
+	public:
+		ArenaAllocator(): arena_ptr_(&get_current_arena()) {}
+
+		explicit ArenaAllocator(Arena &arena): arena_ptr_(&arena) {}
+
+		template<class U>
+		ArenaAllocator(const ArenaAllocator<U> &other): arena_ptr_(other.arena_ptr_) {}
+
+		ArenaAllocator(const ArenaAllocator &other) = default;
+
+		~ArenaAllocator() = default;
+
+	public:
+		template<class ...Args>
+		AllocateType *construct(Args &&... args) {
+			return util::construct<AllocateType>(allocate(), std::forward<Args>(args)...);
+		}
+
+		void deconstruct(T *ptr) {
+			deallocate(util::deconstruct(ptr));
+		}
+
+	public:
+		AllocateType *allocate() {
+			return static_cast<AllocateType *>(arena_ptr_->allocate(sizeof(AllocateType), alignof(AllocateType)));
+		}
+
+		AllocateType *allocate(size_t num) {
+			return static_cast<AllocateType *>(arena_ptr_->allocate(sizeof(AllocateType) * num, alignof(AllocateType)));
+		}
+
+		void deallocate([[maybe_unused]] AllocateType *ptr) {}
+
+		void deallocate([[maybe_unused]] AllocateType *ptr, [[maybe_unused]] size_t num) {}
+
+		AllocateType *reallocate(AllocateType *ptr, size_t old_num, size_t new_num)
+		    requires std::is_trivially_copyable_v<T> {
+			if (new_num <= old_num) { return ptr; }
+
+			AllocateType *new_ptr = allocate(new_num);
+			std::memcpy(new_ptr, ptr, old_num * sizeof(AllocateType));
+			return new_ptr;
+		}
+
+	public:
+		[[nodiscard]] Arena &get_arena() const {
+			return *arena_ptr_;
+		}
+
+		template<class U>
+		bool operator==(const ArenaAllocator<U> &other) const {
+			return arena_ptr_ == other.arena_ptr_;
+		}
+	};
+
+}
+
+#endif//ALGORITHM_ALLOCATOR_ARENA_ALLOCATOR_H
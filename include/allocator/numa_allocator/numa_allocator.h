@@ -0,0 +1,104 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_ALLOCATOR_NUMA_ALLOCATOR_H
+#define ALGORITHM_ALLOCATOR_NUMA_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+#include <concepts>
+
+#include <util/type.h>
+#include <allocator/numa_allocator/numa_pool.h>
+
+namespace algorithm::allocator {
+
+	/*!
+	 * @brief Allocator placing memory on the node of the calling thread, or interleaved over all nodes.
+	 * Memory can be released by any thread, and goes back to the node it was placed on.
+	 * @tparam POLICY Where to place memory allocated without a specific node
+	 */
+	template<class T, NUMAPolicy POLICY = NUMAPolicy::Local>
+	class NUMAAllocator {
+	public:
+		using AllocateType = T;
+
+		template<class U>
+		struct Rebind {
+			using type = NUMAAllocator<U, POLICY>;
+		};
+
+	public:
+		NUMAAllocator() = default;
+
+		NUMAAllocator(const NUMAAllocator &other) = default;
+
+		~NUMAAllocator() = default;
+
+	public:
+		template<class ...Args>
+		AllocateType *construct(Args &&... args) {
+			return util::construct<AllocateType>(allocate(), std::forward<Args>(args)...);
+		}
+
+		void deconstruct(T *ptr) {
+			deallocate(util::deconstruct(ptr));
+		}
+
+	public:
+		AllocateType *allocate() {
+			return allocate(1);
+		}
+
+		AllocateType *allocate(size_t num) {
+			if constexpr (POLICY == NUMAPolicy::Interleaved) {
+				return static_cast<AllocateType *>(get_base_allocator().allocate_interleaved(sizeof(AllocateType) * num));
+			}
+			else {
+				return static_cast<AllocateType *>(get_base_allocator().allocate(sizeof(AllocateType) * num));
+			}
+		}
+
+		/*!
+		 * @brief Allocate memory on specific node regardless of the policy
+		 * @param node_id The id of numa node
+		 * @param num The amount of objects
+		 */
+		AllocateType *allocate_on(int node_id, size_t num) {
+			return static_cast<AllocateType *>(get_base_allocator().allocate_on(node_id, sizeof(AllocateType) * num));
+		}
+
+		void deallocate(AllocateType *ptr) {
+			get_base_allocator().deallocate(ptr, sizeof(AllocateType));
+		}
+
+		void deallocate(AllocateType *ptr, size_t num) {
+			get_base_allocator().deallocate(ptr, sizeof(AllocateType) * num);
+		}
+
+		AllocateType *reallocate(AllocateType *ptr, size_t old_num, size_t new_num)
+		    requires std::is_trivially_copyable_v<T> {
+			if (NUMAAllocatorPool::fit_in_place(old_num * sizeof(AllocateType), new_num * sizeof(AllocateType))) {
+				return ptr;
+			}
+
+			AllocateType *new_ptr = allocate(new_num);
+			std::memcpy(new_ptr, ptr, std::min(old_num, new_num) * sizeof(AllocateType));
+			deallocate(ptr, old_num);
+			return new_ptr;
+		}
+
+	private:
+		static NUMAAllocatorPool &get_base_allocator() {
+			return get_numa_allocator_pool();
+		}
+	};
+
+}
+
+#endif//ALGORITHM_ALLOCATOR_NUMA_ALLOCATOR_H
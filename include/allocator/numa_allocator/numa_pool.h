@@ -0,0 +1,393 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_ALLOCATOR_NUMA_POOL_H
+#define ALGORITHM_ALLOCATOR_NUMA_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include <sys/mman.h>
+#include <numa.h>
+
+#include <util/calculate.h>
+#include <memory/thread.h>
+#include <allocator/reserve_allocator/size_class.h>
+
+namespace algorithm::allocator {
+
+	enum class NUMAPolicy {
+		/// Place memory on the node of the calling thread
+		Local,
+		/// Spread pages over all nodes, which suits tables shared and mostly read by all threads
+		Interleaved
+	};
+
+	/*!
+	 * @brief Slabs and spare chunks placed on one node (or interleaved over all nodes), shared by all threads.
+	 * Chunks are exchanged with thread caches in batch, so that the lock is rarely touched.
+	 * @note Slabs are kept until the heap is destroyed, as their chunks migrate freely among thread caches.
+	 */
+	class NUMANodeHeap {
+	public:
+		using ClassIndex = SizeClassIndex<GeometricSizeClass<32 * 1024>>;
+
+		static constexpr size_t CLASS_AMOUNT = ClassIndex::CLASS_AMOUNT;
+
+		static constexpr size_t SLAB_SIZE    = 256 * 1024;
+
+		/// The node id of the heap spreading pages over all nodes
+		static constexpr int INTERLEAVED_NODE = -1;
+
+		struct Chunk {
+			Chunk *next_chunk_;
+		};
+
+		struct SlabHeader {
+			NUMANodeHeap *heap_ptr_;
+		};
+
+		static constexpr size_t SLAB_HEADER_SIZE = util::ceil(sizeof(SlabHeader), memory::CACHE_LINE_SIZE);
+
+		static_assert(ClassIndex::max_size() + SLAB_HEADER_SIZE <= SLAB_SIZE, "The max size should be smaller than a slab");
+
+	private:
+		struct ClassInfo {
+			/// Spare chunks released by thread caches
+			Chunk *chunk_ptr_ = nullptr;
+			/// Uncarved space of the latest slab
+			uint8_t *carve_start_ptr_ = nullptr;
+
+			uint8_t *carve_end_ptr_ = nullptr;
+		};
+
+		std::mutex mutex_;
+
+		std::array<ClassInfo, CLASS_AMOUNT> class_info_;
+
+		std::vector<void *> slab_list_;
+
+		int node_id_;
+		/// The index of heap in the pool
+		size_t heap_idx_;
+		/// Whether to place memory by libnuma, or by plain mmap otherwise
+		bool numa_available_;
+
+	public:
+		NUMANodeHeap(int node_id, size_t heap_idx, bool numa_available):
+		        node_id_(node_id), heap_idx_(heap_idx), numa_available_(numa_available) {}
+
+		NUMANodeHeap(const NUMANodeHeap &other) = delete;
+
+		~NUMANodeHeap() {
+			for (void *slab_ptr: slab_list_) {
+				munmap(slab_ptr, SLAB_SIZE);
+			}
+		}
+
+	public:
+		/*!
+		 * @brief Fetch a batch of chunks linked from the returned head
+		 * @return The amount of fetched chunks, which is at least 1
+		 */
+		size_t allocate_batch(size_t class_idx, size_t amount, Chunk *&head_ptr) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			ClassInfo &info = class_info_[class_idx];
+
+			size_t res_amount = 0;
+			head_ptr = nullptr;
+			while (res_amount < amount && info.chunk_ptr_ != nullptr) {
+				Chunk *chunk_ptr  = info.chunk_ptr_;
+				info.chunk_ptr_   = chunk_ptr->next_chunk_;
+				chunk_ptr->next_chunk_ = head_ptr;
+				head_ptr = chunk_ptr;
+				++res_amount;
+			}
+
+			const size_t chunk_size = ClassIndex::get_size(class_idx);
+			while (res_amount < amount) {
+				if (info.carve_start_ptr_ + chunk_size > info.carve_end_ptr_) {
+					// Do not strand chunks in hand for a new slab
+					if (res_amount != 0) { break; }
+					uint8_t *slab_ptr = static_cast<uint8_t *>(allocate_slab());
+					info.carve_start_ptr_ = slab_ptr + SLAB_HEADER_SIZE;
+					info.carve_end_ptr_   = slab_ptr + SLAB_SIZE;
+				}
+				Chunk *chunk_ptr = reinterpret_cast<Chunk *>(info.carve_start_ptr_);
+				info.carve_start_ptr_ += chunk_size;
+				chunk_ptr->next_chunk_ = head_ptr;
+				head_ptr = chunk_ptr;
+				++res_amount;
+			}
+			return res_amount;
+		}
+
+		/*!
+		 * @brief Give back chunks linked from head to tail
+		 */
+		void deallocate_batch(size_t class_idx, Chunk *head_ptr, Chunk *tail_ptr) {
+			std::lock_guard<std::mutex> lock(mutex_);
+			ClassInfo &info = class_info_[class_idx];
+
+			tail_ptr->next_chunk_ = info.chunk_ptr_;
+			info.chunk_ptr_       = head_ptr;
+		}
+
+		/*!
+		 * @brief Map memory on the node of heap directly, which is used for blocks larger than any class
+		 */
+		[[nodiscard]] void *map_memory(size_t size) const {
+			void *map_ptr;
+			if (!numa_available_) {
+				map_ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (map_ptr == MAP_FAILED) { map_ptr = nullptr; }
+			}
+			else if (node_id_ == INTERLEAVED_NODE) {
+				map_ptr = numa_alloc_interleaved(size);
+			}
+			else {
+				map_ptr = numa_alloc_onnode(size, node_id_);
+			}
+
+			if (map_ptr == nullptr) { throw std::bad_alloc(); }
+			return map_ptr;
+		}
+
+		void unmap_memory(void *ptr, size_t size) const {
+			if (numa_available_) {
+				numa_free(ptr, size);
+			}
+			else {
+				munmap(ptr, size);
+			}
+		}
+
+		[[nodiscard]] int get_node_id() const {
+			return node_id_;
+		}
+
+		[[nodiscard]] size_t get_heap_idx() const {
+			return heap_idx_;
+		}
+
+		static NUMANodeHeap *get_heap(void *chunk_ptr) {
+			return reinterpret_cast<SlabHeader *>(
+			        util::floor_2pow(reinterpret_cast<uintptr_t>(chunk_ptr), SLAB_SIZE)
+			)->heap_ptr_;
+		}
+
+	private:
+		/*!
+		 * @brief Map a slab aligned to its size, so that its header can be found from any chunk inside.
+		 * Twice the size is mapped on the node and both sides are trimmed to the alignment.
+		 */
+		void *allocate_slab() {
+			uint8_t *map_start_ptr  = static_cast<uint8_t *>(map_memory(SLAB_SIZE * 2));
+			uint8_t *map_end_ptr    = map_start_ptr + SLAB_SIZE * 2;
+			uint8_t *slab_start_ptr = reinterpret_cast<uint8_t *>(util::ceil_2pow(reinterpret_cast<uintptr_t>(map_start_ptr), SLAB_SIZE));
+			uint8_t *slab_end_ptr   = slab_start_ptr + SLAB_SIZE;
+
+			if (slab_start_ptr != map_start_ptr) { munmap(map_start_ptr, slab_start_ptr - map_start_ptr); }
+			if (slab_end_ptr != map_end_ptr) { munmap(slab_end_ptr, map_end_ptr - slab_end_ptr); }
+
+			new (slab_start_ptr) SlabHeader{ .heap_ptr_ = this };
+			slab_list_.push_back(slab_start_ptr);
+			return slab_start_ptr;
+		}
+	};
+
+	/*!
+	 * @brief Chunks cached by one thread for each heap, exchanged with heaps in batch.
+	 */
+	class NUMAThreadCache {
+	public:
+		/// Chunks fetched from the heap at once
+		static constexpr size_t BATCH_AMOUNT = 32;
+		/// Half of cached chunks are given back beyond the limit
+		static constexpr size_t CACHE_LIMIT  = BATCH_AMOUNT * 2;
+
+	private:
+		using Chunk = NUMANodeHeap::Chunk;
+
+		struct CacheList {
+			Chunk *chunk_ptr_ = nullptr;
+
+			size_t chunk_amount_ = 0;
+		};
+
+		std::vector<std::array<CacheList, NUMANodeHeap::CLASS_AMOUNT>> cache_list_;
+
+		const std::vector<std::unique_ptr<NUMANodeHeap>> &heap_array_;
+
+	public:
+		explicit NUMAThreadCache(const std::vector<std::unique_ptr<NUMANodeHeap>> &heap_array):
+		        cache_list_(heap_array.size()), heap_array_(heap_array) {}
+
+		NUMAThreadCache(const NUMAThreadCache &other) = delete;
+
+		~NUMAThreadCache() {
+			for (size_t heap_idx = 0; heap_idx < cache_list_.size(); ++heap_idx) {
+				for (size_t class_idx = 0; class_idx < NUMANodeHeap::CLASS_AMOUNT; ++class_idx) {
+					flush(heap_idx, class_idx, cache_list_[heap_idx][class_idx].chunk_amount_);
+				}
+			}
+		}
+
+	public:
+		void *allocate(NUMANodeHeap &heap, size_t class_idx) {
+			CacheList &list = cache_list_[heap.get_heap_idx()][class_idx];
+			if (list.chunk_ptr_ == nullptr) {
+				list.chunk_amount_ = heap.allocate_batch(class_idx, BATCH_AMOUNT, list.chunk_ptr_);
+			}
+
+			Chunk *res_chunk_ptr = list.chunk_ptr_;
+			list.chunk_ptr_ = res_chunk_ptr->next_chunk_;
+			--list.chunk_amount_;
+			return res_chunk_ptr;
+		}
+
+		void deallocate(void *ptr, size_t class_idx) {
+			const size_t heap_idx = NUMANodeHeap::get_heap(ptr)->get_heap_idx();
+			CacheList &list = cache_list_[heap_idx][class_idx];
+
+			Chunk *chunk_ptr = static_cast<Chunk *>(ptr);
+			chunk_ptr->next_chunk_ = list.chunk_ptr_;
+			list.chunk_ptr_ = chunk_ptr;
+			if (++list.chunk_amount_ > CACHE_LIMIT) {
+				flush(heap_idx, class_idx, CACHE_LIMIT / 2);
+			}
+		}
+
+	private:
+		/*!
+		 * @brief Give back the first amount of cached chunks to the heap
+		 */
+		void flush(size_t heap_idx, size_t class_idx, size_t amount) {
+			if (amount == 0) { return; }
+
+			CacheList &list = cache_list_[heap_idx][class_idx];
+			Chunk *head_ptr = list.chunk_ptr_;
+			Chunk *tail_ptr = head_ptr;
+			for (size_t i = 1; i < amount; ++i) {
+				tail_ptr = tail_ptr->next_chunk_;
+			}
+
+			list.chunk_ptr_     = tail_ptr->next_chunk_;
+			list.chunk_amount_ -= amount;
+			heap_array_[heap_idx]->deallocate_batch(class_idx, head_ptr, tail_ptr);
+		}
+	};
+
+	/*!
+	 * @brief Process-wide pool holding one heap per node and one interleaved heap.
+	 * Blocks larger than any class are mapped on the node directly.
+	 */
+	class NUMAAllocatorPool {
+	private:
+		using ClassIndex = NUMANodeHeap::ClassIndex;
+
+		/// Heaps of node 0 to n-1, followed by the interleaved heap
+		std::vector<std::unique_ptr<NUMANodeHeap>> heap_array_;
+
+		int node_amount_;
+
+	public:
+		NUMAAllocatorPool() {
+			const bool is_numa_available = (numa_available() != -1);
+			node_amount_ = is_numa_available ? numa_max_node() + 1 : 1;
+
+			for (int node_id = 0; node_id < node_amount_; ++node_id) {
+				heap_array_.emplace_back(std::make_unique<NUMANodeHeap>(node_id, heap_array_.size(), is_numa_available));
+			}
+			heap_array_.emplace_back(std::make_unique<NUMANodeHeap>(NUMANodeHeap::INTERLEAVED_NODE, heap_array_.size(), is_numa_available));
+		}
+
+		NUMAAllocatorPool(const NUMAAllocatorPool &other) = delete;
+
+		~NUMAAllocatorPool() = default;
+
+	public:
+		/*!
+		 * @brief Allocate memory on the node of the calling thread
+		 */
+		void *allocate(size_t size) {
+			return allocate_on(static_cast<int>(memory::get_cpu_numa_id()), size);
+		}
+
+		/*!
+		 * @brief Allocate memory on specific node
+		 * @param node_id The id of numa node, which falls back to node 0 if it is out of range
+		 */
+		void *allocate_on(int node_id, size_t size) {
+			if (node_id < 0 || node_id >= node_amount_) { node_id = 0; }
+			return allocate_from(*heap_array_[node_id], size);
+		}
+
+		/*!
+		 * @brief Allocate memory spread over all nodes
+		 */
+		void *allocate_interleaved(size_t size) {
+			return allocate_from(*heap_array_.back(), size);
+		}
+
+		void deallocate(void *ptr, size_t size) {
+			if (size > max_size()) {
+				// Large blocks share the same way of unmapping on all heaps
+				heap_array_.front()->unmap_memory(ptr, size);
+				return;
+			}
+			get_thread_cache().deallocate(ptr, ClassIndex::get_idx(size));
+		}
+
+		/*!
+		 * @brief Resize a block, which stays on its node if it fits in the same class.
+		 * Otherwise the new block is placed by the policy of the caller.
+		 */
+		[[nodiscard]] static bool fit_in_place(size_t old_size, size_t new_size) {
+			if (old_size > max_size() || new_size > max_size()) { return false; }
+			return ClassIndex::get_idx(old_size) == ClassIndex::get_idx(new_size);
+		}
+
+	public:
+		[[nodiscard]] int get_node_amount() const {
+			return node_amount_;
+		}
+
+		static constexpr size_t max_size() {
+			return ClassIndex::max_size();
+		}
+
+	private:
+		void *allocate_from(NUMANodeHeap &heap, size_t size) {
+			if (size > max_size()) {
+				return heap.map_memory(size);
+			}
+			return get_thread_cache().allocate(heap, ClassIndex::get_idx(size));
+		}
+
+		NUMAThreadCache &get_thread_cache() {
+			thread_local NUMAThreadCache thread_cache(heap_array_);
+			return thread_cache;
+		}
+
+	};
+
+	/*!
+	 * @brief Acquire the process-wide NUMA pool
+	 */
+	inline NUMAAllocatorPool &get_numa_allocator_pool() {
+		static NUMAAllocatorPool numa_allocator_pool;
+		return numa_allocator_pool;
+	}
+}
+
+#endif//ALGORITHM_ALLOCATOR_NUMA_POOL_H
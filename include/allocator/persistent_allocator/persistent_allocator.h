@@ -0,0 +1,114 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_ALLOCATOR_PERSISTENT_ALLOCATOR_H
+#define ALGORITHM_ALLOCATOR_PERSISTENT_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <utility>
+#include <concepts>
+
+#include <util/type.h>
+#include <logger/logger.h>
+#include <allocator/persistent_allocator/persistent_heap.h>
+
+namespace algorithm::allocator {
+
+	namespace detail {
+
+		template<class Heap>
+		inline Heap *&bound_persistent_heap_ptr() {
+			static Heap *heap_ptr = nullptr;
+			return heap_ptr;
+		}
+
+	}
+
+	/*!
+	 * @brief Make all PersistentAllocator of the heap type draw from the heap.
+	 * Allocators keep no state, so that containers placed inside the heap stay valid after restart.
+	 */
+	template<class Heap = PersistentHeap>
+	inline void bind_persistent_heap(Heap &heap) {
+		detail::bound_persistent_heap_ptr<Heap>() = &heap;
+	}
+
+	template<class Heap = PersistentHeap>
+	inline void unbind_persistent_heap() {
+		detail::bound_persistent_heap_ptr<Heap>() = nullptr;
+	}
+
+	/*!
+	 * @brief Allocator drawing from the persistent heap bound by bind_persistent_heap()
+	 */
+	template<class T, class Heap = PersistentHeap>
+	class PersistentAllocator {
+	public:
+		using AllocateType = T;
+
+		template<class U>
+		struct Rebind {
+			using type = PersistentAllocator<U, Heap>;
+		};
+
+	public:
+		PersistentAllocator() = default;
+
+		PersistentAllocator(const PersistentAllocator &other) = default;
+
+		~PersistentAllocator() = default;
+
+	public:
+		template<class ...Args>
+		AllocateType *construct(Args &&... args) {
+			return util::construct<AllocateType>(allocate(), std::forward<Args>(args)...);
+		}
+
+		void deconstruct(T *ptr) {
+			deallocate(util::deconstruct(ptr));
+		}
+
+	public:
+		AllocateType *allocate() {
+			return static_cast<AllocateType *>(get_base_allocator().allocate(sizeof(AllocateType)));
+		}
+
+		AllocateType *allocate(size_t num) {
+			return static_cast<AllocateType *>(get_base_allocator().allocate(sizeof(AllocateType) * num));
+		}
+
+		void deallocate(AllocateType *ptr) {
+			get_base_allocator().deallocate(ptr, sizeof(AllocateType));
+		}
+
+		void deallocate(AllocateType *ptr, size_t num) {
+			get_base_allocator().deallocate(ptr, sizeof(AllocateType) * num);
+		}
+
+		AllocateType *reallocate(AllocateType *ptr, size_t old_num, size_t new_num)
+		    requires std::is_trivially_copyable_v<T> {
+			AllocateType *new_ptr = allocate(new_num);
+			std::memcpy(new_ptr, ptr, std::min(old_num, new_num) * sizeof(AllocateType));
+			deallocate(ptr, old_num);
+			return new_ptr;
+		}
+
+	private:
+		static Heap &get_base_allocator() {
+			Heap *heap_ptr = detail::bound_persistent_heap_ptr<Heap>();
+			if (heap_ptr == nullptr) [[unlikely]] {
+				util::logger::logger_error("No persistent heap is bound before allocation.");
+				throw std::bad_alloc();
+			}
+			return *heap_ptr;
+		}
+	};
+
+}
+
+#endif//ALGORITHM_ALLOCATOR_PERSISTENT_ALLOCATOR_H
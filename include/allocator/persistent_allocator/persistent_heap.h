@@ -0,0 +1,439 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_ALLOCATOR_PERSISTENT_HEAP_H
+#define ALGORITHM_ALLOCATOR_PERSISTENT_HEAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include <util/calculate.h>
+#include <memory/cache.h>
+#include <memory/nvm.h>
+#include <file/file_descriptor.h>
+#include <logger/logger.h>
+
+namespace algorithm::allocator {
+
+	/*!
+	 * @brief Crash-consistent heap inside a file mapped by FileDescriptor.
+	 * The file is composed of a header page, an allocation bitmap with one bit per unit, and the data area.
+	 * Changes to the bitmap are flushed by the PWB strategy and fenced before returning,
+	 * so that the state of allocation survives crashes. Free lists are volatile and rebuilt from the bitmap on restart.
+	 * The heap is mapped at the address it was created on if possible, so that absolute pointers inside stay valid.
+	 * @note A block allocated but not yet linked from the root leaks on crash.
+	 * @tparam NVMType The strategy to write back cache lines, i.e. memory::NVMConfig with specific flush type
+	 */
+	template<class NVMType = memory::NVM>
+	class BasicPersistentHeap {
+	public:
+		using NVM = NVMType;
+
+		static constexpr uint64_t MAGIC        = 0x5045525349535450; // "PERSISTP"
+
+		static constexpr uint32_t VERSION      = 1;
+
+		static constexpr size_t PAGE_SIZE      = 4096;
+		/// The granularity of allocation, which is a cache line so that blocks never share lines
+		static constexpr size_t UNIT_SIZE      = memory::CACHE_LINE_SIZE;
+		/// Blocks no larger than this amount of units are recycled by segregated lists,
+		/// which are merged back into free runs when no run fits a request
+		static constexpr size_t SMALL_UNIT_LIMIT = 64;
+
+		static constexpr uint64_t NULL_OFFSET  = 0;
+
+	private:
+		struct HeapHeader {
+			/// Written at last on creation, so that a torn creation is never taken as valid
+			uint64_t magic_;
+			uint32_t version_;
+			uint32_t unit_size_;
+			uint64_t heap_size_;
+			uint64_t unit_amount_;
+			uint64_t bitmap_offset_;
+			uint64_t data_offset_;
+			/// The address of mapping on creation
+			uint64_t base_address_;
+			/// The offset of root object, or NULL_OFFSET if unset
+			uint64_t root_offset_;
+		};
+
+		static_assert(sizeof(HeapHeader) <= PAGE_SIZE);
+
+		file::FileDescriptor file_;
+
+		file::FileMapper mapper_;
+
+		uint8_t *base_ptr_;
+
+		HeapHeader *header_ptr_;
+
+		uint64_t *bitmap_ptr_;
+
+		uint8_t *data_ptr_;
+
+		std::mutex mutex_;
+		/// Spare blocks of small sizes, recorded by unit index
+		std::array<std::vector<uint64_t>, SMALL_UNIT_LIMIT + 1> small_free_list_;
+		/// Spare runs of units, from unit index to amount, which are coalesced on insertion
+		std::map<uint64_t, uint64_t> free_run_map_;
+
+		uint64_t used_unit_amount_;
+
+	public:
+		/*!
+		 * @brief Open the heap in file, or create one with the given size if the file is new or empty.
+		 * @param file_path The path of file, which may lie on a DAX file system, tmpfs or any other
+		 * @param heap_size The size of heap on creation, ignored when opening an existing heap
+		 */
+		BasicPersistentHeap(std::string_view file_path, size_t heap_size):
+		        file_(file_path, file::FileOpenType::ReadWrite | file::FileOpenType::Create),
+		        base_ptr_(nullptr), header_ptr_(nullptr), bitmap_ptr_(nullptr), data_ptr_(nullptr),
+		        used_unit_amount_(0) {
+
+			if (!file_.is_open()) {
+				throw std::runtime_error("Fail to open persistent heap");
+			}
+
+			const bool create = (file_.get_size() == 0);
+			if (create) {
+				heap_size = util::ceil(heap_size, PAGE_SIZE);
+				if (heap_size < PAGE_SIZE * 2 || !file_.resize(heap_size)) {
+					throw std::runtime_error("Fail to create persistent heap");
+				}
+				map_file(heap_size, nullptr);
+				format();
+			}
+			else {
+				map_file(file_.get_size(), read_base_address());
+				if (!validate()) {
+					throw std::runtime_error("Invalid persistent heap");
+				}
+				recover();
+			}
+		}
+
+		BasicPersistentHeap(const BasicPersistentHeap &other) = delete;
+
+		~BasicPersistentHeap() = default;
+
+	public:
+		void *allocate(size_t size) {
+			const uint64_t unit_amount = get_unit_amount(size);
+
+			std::lock_guard<std::mutex> lock(mutex_);
+			uint64_t unit_idx = take_free_units(unit_amount);
+			if (unit_idx == UINT64_MAX) {
+				throw std::bad_alloc();
+			}
+
+			set_bits(unit_idx, unit_amount, true);
+			used_unit_amount_ += unit_amount;
+			return data_ptr_ + unit_idx * UNIT_SIZE;
+		}
+
+		void deallocate(void *ptr, size_t size) {
+			if (ptr == nullptr) { return; }
+
+			const uint64_t unit_amount = get_unit_amount(size);
+			const uint64_t unit_idx    = (static_cast<uint8_t *>(ptr) - data_ptr_) / UNIT_SIZE;
+
+			std::lock_guard<std::mutex> lock(mutex_);
+			set_bits(unit_idx, unit_amount, false);
+			used_unit_amount_ -= unit_amount;
+			give_free_units(unit_idx, unit_amount);
+		}
+
+	public:
+		/*!
+		 * @brief Make the object the entry of heap, which can be acquired after restart
+		 */
+		void set_root(void *ptr) {
+			header_ptr_->root_offset_ = to_offset(ptr);
+			persist(&header_ptr_->root_offset_, sizeof(uint64_t));
+		}
+
+		template<class T = void>
+		T *get_root() const {
+			return static_cast<T *>(from_offset(header_ptr_->root_offset_));
+		}
+
+		[[nodiscard]] uint64_t to_offset(const void *ptr) const {
+			if (ptr == nullptr) { return NULL_OFFSET; }
+			return static_cast<const uint8_t *>(ptr) - base_ptr_;
+		}
+
+		[[nodiscard]] void *from_offset(uint64_t offset) const {
+			if (offset == NULL_OFFSET) { return nullptr; }
+			return base_ptr_ + offset;
+		}
+
+		/*!
+		 * @brief Whether the heap is mapped at the address on creation, where absolute pointers inside are valid
+		 */
+		[[nodiscard]] bool is_address_stable() const {
+			return header_ptr_->base_address_ == reinterpret_cast<uint64_t>(base_ptr_);
+		}
+
+		[[nodiscard]] size_t get_used_size() const {
+			return used_unit_amount_ * UNIT_SIZE;
+		}
+
+		[[nodiscard]] size_t get_capacity() const {
+			return header_ptr_->unit_amount_ * UNIT_SIZE;
+		}
+
+		/*!
+		 * @brief Persist the whole heap, for containers unaware of persistence.
+		 * Dirty pages are also written back to the file, in case it is not on a DAX file system.
+		 */
+		void sync() {
+			persist(data_ptr_, header_ptr_->unit_amount_ * UNIT_SIZE);
+			mapper_.sync();
+		}
+
+		/*!
+		 * @brief Write back the range and wait for completion
+		 */
+		static void persist(void *ptr, size_t size) {
+			// Cover the lines touched at both ends, as pwb_range steps from the start address
+			uintptr_t start_addr = util::floor_2pow(reinterpret_cast<uintptr_t>(ptr), memory::CACHE_LINE_SIZE);
+			uintptr_t end_addr   = util::ceil_2pow(reinterpret_cast<uintptr_t>(ptr) + size, memory::CACHE_LINE_SIZE);
+			// The range of pwb is limited to 32-bit size
+			constexpr uintptr_t MAX_PWB_SIZE = uintptr_t(1) << 30;
+			for (uintptr_t addr = start_addr; addr < end_addr; addr += MAX_PWB_SIZE) {
+				NVM::pwb_range(reinterpret_cast<void *>(addr), static_cast<uint32_t>(std::min(end_addr - addr, MAX_PWB_SIZE)));
+			}
+			NVM::fence();
+		}
+
+	private:
+		void map_file(size_t size, void *addr_hint) {
+			using file::FileMmapProt;
+			using file::FileMmapFlag;
+
+			constexpr FileMmapProt PROT = FileMmapProt::Readable | FileMmapProt::Writable;
+			if (addr_hint != nullptr) {
+				mapper_ = file_.get_mapper(size, PROT, FileMmapFlag::Shared | FileMmapFlag::FixedNoReplace, addr_hint);
+				if (!mapper_.is_mapped()) {
+					util::logger::logger_warn("Persistent heap is relocated, absolute pointers inside are invalid.");
+				}
+			}
+			if (!mapper_.is_mapped()) {
+				mapper_ = file_.get_mapper(size, PROT, FileMmapFlag::Shared);
+			}
+			if (!mapper_.is_mapped()) {
+				throw std::runtime_error("Fail to map persistent heap");
+			}
+
+			base_ptr_   = mapper_.get_map_area().data();
+			header_ptr_ = reinterpret_cast<HeapHeader *>(base_ptr_);
+		}
+
+		void *read_base_address() const {
+			HeapHeader header{};
+			file_.relocate(0, file::FileRelocateType::StartLoc);
+			if (file_.read_forward(sizeof(HeapHeader), &header) != sizeof(HeapHeader) || header.magic_ != MAGIC) {
+				return nullptr;
+			}
+			return reinterpret_cast<void *>(header.base_address_);
+		}
+
+		void format() {
+			const size_t heap_size = mapper_.get_map_area().size();
+
+			// Each unit costs UNIT_SIZE bytes of data and a bit of bitmap
+			uint64_t unit_amount    = (heap_size - PAGE_SIZE) * 8 / (UNIT_SIZE * 8 + 1);
+			uint64_t bitmap_size    = util::ceil(util::ceil(unit_amount, 64) / 8, memory::CACHE_LINE_SIZE);
+			uint64_t data_offset    = util::ceil(PAGE_SIZE + bitmap_size, PAGE_SIZE);
+			unit_amount = (heap_size - data_offset) / UNIT_SIZE;
+
+			*header_ptr_ = HeapHeader{
+			        .magic_         = 0,
+			        .version_       = VERSION,
+			        .unit_size_     = UNIT_SIZE,
+			        .heap_size_     = heap_size,
+			        .unit_amount_   = unit_amount,
+			        .bitmap_offset_ = PAGE_SIZE,
+			        .data_offset_   = data_offset,
+			        .base_address_  = reinterpret_cast<uint64_t>(base_ptr_),
+			        .root_offset_   = NULL_OFFSET
+			};
+			persist(header_ptr_, sizeof(HeapHeader));
+
+			header_ptr_->magic_ = MAGIC;
+			persist(&header_ptr_->magic_, sizeof(uint64_t));
+
+			bind_area();
+			free_run_map_.emplace(0, unit_amount);
+		}
+
+		[[nodiscard]] bool validate() const {
+			const HeapHeader &header = *header_ptr_;
+			if (header.magic_ != MAGIC || header.version_ != VERSION || header.unit_size_ != UNIT_SIZE) {
+				util::logger::logger_error("Persistent heap has invalid header.");
+				return false;
+			}
+			if (header.heap_size_ != mapper_.get_map_area().size() ||
+			    header.data_offset_ + header.unit_amount_ * UNIT_SIZE > header.heap_size_) {
+				util::logger::logger_error("Persistent heap has inconsistent size: ", header.heap_size_);
+				return false;
+			}
+			return true;
+		}
+
+		/*!
+		 * @brief Rebuild free runs from the bitmap
+		 */
+		void recover() {
+			bind_area();
+
+			const uint64_t unit_amount = header_ptr_->unit_amount_;
+			uint64_t run_start = 0;
+			bool in_run = false;
+			for (uint64_t unit_idx = 0; unit_idx < unit_amount; ) {
+				const uint64_t word = bitmap_ptr_[unit_idx / 64];
+				// Skip whole words at once
+				if ((unit_idx % 64) == 0 && unit_idx + 64 <= unit_amount && (word == 0 || word == UINT64_MAX)) {
+					bool used = (word != 0);
+					if (used && in_run) { free_run_map_.emplace(run_start, unit_idx - run_start); in_run = false; }
+					if (!used && !in_run) { run_start = unit_idx; in_run = true; }
+					if (used) { used_unit_amount_ += 64; }
+					unit_idx += 64;
+					continue;
+				}
+
+				bool used = (word >> (unit_idx % 64)) & 1;
+				if (used && in_run) { free_run_map_.emplace(run_start, unit_idx - run_start); in_run = false; }
+				if (!used && !in_run) { run_start = unit_idx; in_run = true; }
+				if (used) { ++used_unit_amount_; }
+				++unit_idx;
+			}
+			if (in_run) {
+				free_run_map_.emplace(run_start, unit_amount - run_start);
+			}
+		}
+
+		void bind_area() {
+			bitmap_ptr_ = reinterpret_cast<uint64_t *>(base_ptr_ + header_ptr_->bitmap_offset_);
+			data_ptr_   = base_ptr_ + header_ptr_->data_offset_;
+		}
+
+		/*!
+		 * @brief Set or clear bits of units, and persist them
+		 */
+		void set_bits(uint64_t unit_idx, uint64_t unit_amount, bool value) {
+			const uint64_t end_idx = unit_idx + unit_amount;
+			for (uint64_t idx = unit_idx; idx < end_idx; ) {
+				const uint64_t bit_offset = idx % 64;
+				const uint64_t bit_amount = std::min<uint64_t>(64 - bit_offset, end_idx - idx);
+				const uint64_t mask       = (bit_amount == 64) ? UINT64_MAX : (((uint64_t(1) << bit_amount) - 1) << bit_offset);
+				if (value) {
+					bitmap_ptr_[idx / 64] |= mask;
+				}
+				else {
+					bitmap_ptr_[idx / 64] &= ~mask;
+				}
+				idx += bit_amount;
+			}
+
+			uint64_t *start_word_ptr = bitmap_ptr_ + unit_idx / 64;
+			uint64_t *end_word_ptr   = bitmap_ptr_ + (end_idx - 1) / 64 + 1;
+			persist(start_word_ptr, (end_word_ptr - start_word_ptr) * sizeof(uint64_t));
+		}
+
+		uint64_t take_free_units(uint64_t unit_amount) {
+			if (unit_amount <= SMALL_UNIT_LIMIT && !small_free_list_[unit_amount].empty()) {
+				uint64_t unit_idx = small_free_list_[unit_amount].back();
+				small_free_list_[unit_amount].pop_back();
+				return unit_idx;
+			}
+
+			uint64_t unit_idx = take_free_run(unit_amount);
+			if (unit_idx == UINT64_MAX && merge_small_free_lists()) {
+				unit_idx = take_free_run(unit_amount);
+			}
+			return unit_idx;
+		}
+
+		void give_free_units(uint64_t unit_idx, uint64_t unit_amount) {
+			if (unit_amount <= SMALL_UNIT_LIMIT) {
+				small_free_list_[unit_amount].push_back(unit_idx);
+				return;
+			}
+			give_free_run(unit_idx, unit_amount);
+		}
+
+		/*!
+		 * @brief First fit, with the remaining part kept in place
+		 */
+		uint64_t take_free_run(uint64_t unit_amount) {
+			for (auto iter = free_run_map_.begin(); iter != free_run_map_.end(); ++iter) {
+				auto [run_idx, run_amount] = *iter;
+				if (run_amount < unit_amount) { continue; }
+
+				free_run_map_.erase(iter);
+				if (run_amount > unit_amount) {
+					free_run_map_.emplace(run_idx + unit_amount, run_amount - unit_amount);
+				}
+				return run_idx;
+			}
+			return UINT64_MAX;
+		}
+
+		/*!
+		 * @brief Insert the run, coalesced with adjacent runs
+		 */
+		void give_free_run(uint64_t unit_idx, uint64_t unit_amount) {
+			auto next_iter = free_run_map_.lower_bound(unit_idx);
+			if (next_iter != free_run_map_.end() && unit_idx + unit_amount == next_iter->first) {
+				unit_amount += next_iter->second;
+				next_iter = free_run_map_.erase(next_iter);
+			}
+			if (next_iter != free_run_map_.begin()) {
+				auto prev_iter = std::prev(next_iter);
+				if (prev_iter->first + prev_iter->second == unit_idx) {
+					prev_iter->second += unit_amount;
+					return;
+				}
+			}
+			free_run_map_.emplace(unit_idx, unit_amount);
+		}
+
+		/*!
+		 * @brief Move all blocks of small lists into free runs, so that adjacent ones serve larger requests
+		 * @return Whether any block is moved
+		 */
+		bool merge_small_free_lists() {
+			bool merged = false;
+			for (std::vector<uint64_t> &free_list: small_free_list_) {
+				const uint64_t unit_amount = &free_list - small_free_list_.data();
+				for (uint64_t unit_idx: free_list) { give_free_run(unit_idx, unit_amount); }
+				merged |= !free_list.empty();
+				free_list.clear();
+			}
+			return merged;
+		}
+
+		static uint64_t get_unit_amount(size_t size) {
+			return std::max<uint64_t>(1, util::ceil(size, UNIT_SIZE) / UNIT_SIZE);
+		}
+	};
+
+	using PersistentHeap = BasicPersistentHeap<>;
+
+}
+
+#endif//ALGORITHM_ALLOCATOR_PERSISTENT_HEAP_H
@@ -17,14 +17,18 @@
 
 namespace algorithm::allocator {
 
-	template<class T>
+	/*!
+	 * @brief Allocator backed by the pool of the current thread
+	 * @tparam Pool The type of thread-local pool, e.g. BasicReserveAllocatorPool with custom size classes
+	 */
+	template<class T, class Pool = ReserveAllocatorPool>
 	class ReserveAllocator {
 	public:
 		using AllocateType = T;
 
 		template<class U>
 		struct Rebind {
-			using type = ReserveAllocator<U>;
+			using type = ReserveAllocator<U, Pool>;
 		};
 
 	public:
@@ -37,7 +41,7 @@ namespace algorithm::allocator {
 	public:
 		template<class ...Args>
 		AllocateType *construct(Args &&... args) {
-			return util::construct<AllocateType>(allocate(sizeof(T)), std::forward<Args>(args)...);
+			return util::construct<AllocateType>(allocate(), std::forward<Args>(args)...);
 		}
 
 		void deconstruct(T *ptr) {
@@ -62,20 +66,20 @@ namespace algorithm::allocator {
 		}
 
 	private:
-		static ReserveAllocatorPool &get_base_allocator() {
-			return thread_allocator_pool;
+		static Pool &get_base_allocator() {
+			return get_thread_allocator_pool<Pool>();
 		}
 	};
 
-	template<class T>
+	template<class T, class Pool>
 		requires std::is_trivially_copyable_v<T>
-	class ReserveAllocator<T> {
+	class ReserveAllocator<T, Pool> {
 	public:
 		using AllocateType = T;
 
 		template<class U>
 		struct Rebind {
-			using type = ReserveAllocator<U>;
+			using type = ReserveAllocator<U, Pool>;
 		};
 
 	public:
@@ -88,7 +92,7 @@ namespace algorithm::allocator {
 	public:
 		template<class ...Args>
 		AllocateType *construct(Args &&... args) {
-			return util::construct<AllocateType>(allocate(sizeof(T)), std::forward<Args>(args)...);
+			return util::construct<AllocateType>(allocate(), std::forward<Args>(args)...);
 		}
 
 		void deconstruct(T *ptr) {
@@ -122,8 +126,8 @@ namespace algorithm::allocator {
 		}
 
 	private:
-		static ReserveAllocatorPool &get_base_allocator() {
-			return thread_allocator_pool;
+		static Pool &get_base_allocator() {
+			return get_thread_allocator_pool<Pool>();
 		}
 	};
 
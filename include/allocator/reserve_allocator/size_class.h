@@ -0,0 +1,145 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_ALLOCATOR_SIZE_CLASS_H
+#define ALGORITHM_ALLOCATOR_SIZE_CLASS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <concepts>
+
+namespace algorithm::allocator {
+
+	/*!
+	 * @brief Size classes of a pool, which provide an ascending array CLASS_SIZE.
+	 */
+	template<class SizeClass>
+	concept SizeClassConcept = requires {
+		{ SizeClass::CLASS_SIZE.size() } -> std::convertible_to<size_t>;
+		{ SizeClass::CLASS_SIZE[0] } -> std::convertible_to<size_t>;
+	};
+
+	/*!
+	 * @brief Size classes listed explicitly, e.g. SizeClassList<16, 32, 72, 136>
+	 */
+	template<size_t ...SIZES>
+	struct SizeClassList {
+		static constexpr std::array<size_t, sizeof...(SIZES)> CLASS_SIZE{SIZES...};
+	};
+
+	namespace detail {
+
+		template<size_t QUANTUM, size_t GROUP_AMOUNT>
+		inline consteval size_t geometric_size_class_amount(size_t max_size) {
+			size_t amount = 0;
+			for (size_t i = 1; i <= GROUP_AMOUNT && QUANTUM * i <= max_size; ++i) { ++amount; }
+
+			for (size_t base = QUANTUM * GROUP_AMOUNT; ; base <<= 1) {
+				const size_t spacing = base / GROUP_AMOUNT;
+				for (size_t i = 1; i <= GROUP_AMOUNT; ++i) {
+					if (base + spacing * i > max_size) { return amount; }
+					++amount;
+				}
+			}
+		}
+
+		template<size_t QUANTUM, size_t GROUP_AMOUNT, size_t MAX_SIZE>
+		inline consteval auto make_geometric_size_class() {
+			std::array<size_t, geometric_size_class_amount<QUANTUM, GROUP_AMOUNT>(MAX_SIZE)> res{};
+
+			size_t idx = 0;
+			for (size_t i = 1; i <= GROUP_AMOUNT && idx < res.size(); ++i) { res[idx++] = QUANTUM * i; }
+
+			for (size_t base = QUANTUM * GROUP_AMOUNT; idx < res.size(); base <<= 1) {
+				const size_t spacing = base / GROUP_AMOUNT;
+				for (size_t i = 1; i <= GROUP_AMOUNT && idx < res.size(); ++i) {
+					res[idx++] = base + spacing * i;
+				}
+			}
+			return res;
+		}
+	}
+
+	/*!
+	 * @brief Size classes in the fashion of jemalloc.
+	 * Sizes are spaced by QUANTUM up to QUANTUM * GROUP_AMOUNT,
+	 * then each doubling is split into GROUP_AMOUNT classes (steps of 1.25x at most by default).
+	 * @tparam MAX_SIZE The largest size served by classes
+	 */
+	template<size_t MAX_SIZE = 64 * 1024, size_t QUANTUM = 16, size_t GROUP_AMOUNT = 4>
+	struct GeometricSizeClass {
+		static_assert((GROUP_AMOUNT & (GROUP_AMOUNT - 1)) == 0, "The amount of classes per group should be power of 2");
+
+		static constexpr auto CLASS_SIZE = detail::make_geometric_size_class<QUANTUM, GROUP_AMOUNT, MAX_SIZE>();
+	};
+
+	/*!
+	 * @brief Constant-time map from sizes into the index of size classes.
+	 * Sizes are rounded up to ALIGN_SIZE before looking up a table built in compile time.
+	 */
+	template<SizeClassConcept SizeClass>
+	struct SizeClassIndex {
+		static constexpr auto   CLASS_SIZE   = SizeClass::CLASS_SIZE;
+
+		static constexpr size_t CLASS_AMOUNT = CLASS_SIZE.size();
+
+		static constexpr size_t ALIGN_BYTE   = 4;
+
+		static constexpr size_t ALIGN_SIZE   = (1 << ALIGN_BYTE);
+
+	private:
+		static consteval bool valid_size_class() {
+			for (size_t i = 0; i < CLASS_AMOUNT; ++i) {
+				if (CLASS_SIZE[i] % ALIGN_SIZE != 0) { return false; }
+				if (i != 0 && CLASS_SIZE[i] <= CLASS_SIZE[i - 1]) { return false; }
+			}
+			return true;
+		}
+
+		static_assert(CLASS_AMOUNT != 0 && CLASS_AMOUNT <= UINT8_MAX, "The amount of size classes should be in [1, 255]");
+		static_assert(valid_size_class(), "Size classes should be ascending multiples of ALIGN_SIZE");
+
+		/// Map from the size rounded up to ALIGN_SIZE into the index of class
+		static constexpr auto CLASS_IDX_TABLE = [] {
+			std::array<uint8_t, CLASS_SIZE.back() / ALIGN_SIZE + 1> res{};
+			size_t class_idx = 0;
+			for (size_t i = 0; i < res.size(); ++i) {
+				while (CLASS_SIZE[class_idx] < i * ALIGN_SIZE) { ++class_idx; }
+				res[i] = static_cast<uint8_t>(class_idx);
+			}
+			return res;
+		}();
+
+	public:
+		/*!
+		 * @brief Get the index of the smallest class holding the size, which should be no larger than max_size()
+		 */
+		static constexpr int get_idx(size_t size) {
+			return CLASS_IDX_TABLE[(size + ALIGN_SIZE - 1) >> ALIGN_BYTE];
+		}
+
+		static constexpr size_t get_size(size_t idx) {
+			return CLASS_SIZE[idx];
+		}
+
+		static constexpr size_t min_size() {
+			return CLASS_SIZE.front();
+		}
+
+		static constexpr size_t max_size() {
+			return CLASS_SIZE.back();
+		}
+	};
+
+	/// The power-of-two classes from 16 B to 512 B
+	using PowerOfTwoSizeClass = SizeClassList<16, 32, 64, 128, 256, 512>;
+
+	using DefaultSizeClass = GeometricSizeClass<>;
+
+}
+
+#endif//ALGORITHM_ALLOCATOR_SIZE_CLASS_H
@@ -1,5 +1,5 @@
 /*
- * @author: BL-GS 
+ * @author: BL-GS
  * @date:   2023/5/13
  */
 
@@ -8,26 +8,99 @@
 #define ALGORITHM_ALLOCATOR_THREAD_ALLOCAOTR_H
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <bit>
+#include <new>
+
+#include <sys/mman.h>
 
 #include <util/calculate.h>
+#include <memory/cache.h>
 #include <allocator/base_allocator.h>
+#include <allocator/reserve_allocator/size_class.h>
 
 namespace algorithm::allocator {
 
-	class ReserveAllocatorPool {
+	/*!
+	 * @brief Occupancy of a pool, reported per size class.
+	 */
+	template<size_t CLASS_AMOUNT>
+	struct ReservePoolStats {
+		struct ClassStats {
+			/// The size of each chunk in this class
+			size_t chunk_size;
+			/// Bytes held by alive chunks
+			size_t live_bytes;
+			/// Bytes of spare chunks in slabs owned by the pool
+			size_t free_bytes;
+			/// The amount of slabs carved for this class
+			size_t page_count;
+		};
+
+		std::array<ClassStats, CLASS_AMOUNT> class_stats;
+		/// The amount of empty slabs cached for any class
+		size_t cached_page_count;
+
+		size_t total_live_bytes() const {
+			size_t res = 0;
+			for (const ClassStats &stats: class_stats) { res += stats.live_bytes; }
+			return res;
+		}
+
+		size_t total_free_bytes() const {
+			size_t res = 0;
+			for (const ClassStats &stats: class_stats) { res += stats.free_bytes; }
+			return res;
+		}
+
+		size_t total_page_count() const {
+			size_t res = 0;
+			for (const ClassStats &stats: class_stats) { res += stats.page_count; }
+			return res;
+		}
+	};
+
+	/*!
+	 * @brief Size-class pool owned by one thread.
+	 * Each slab records its owner pool in a header, so that a chunk released by another thread
+	 * is pushed onto the lock-free remote list of the owner rather than the free list of the releaser.
+	 * The owner drains the remote list in batch when it runs out of spare chunks.
+	 * Chunks are tracked per slab, and a slab without alive chunks is unmapped
+	 * once the class caches more empty slabs than the high-water mark.
+	 * @tparam SizeClass The size classes served by slabs, larger blocks are passed to malloc
+	 * @tparam SLAB_SIZE The size of each slab, which should be power of 2 between 4 KiB and 2 MiB
+	 * @tparam HUGE_PAGE Whether to back slabs by huge pages (MAP_HUGETLB, or transparent huge pages as fallback)
+	 */
+	template<SizeClassConcept SizeClass = DefaultSizeClass, size_t SLAB_SIZE = 256 * 1024, bool HUGE_PAGE = false>
+	class BasicReserveAllocatorPool {
+	private:
+		using ClassIndex = SizeClassIndex<SizeClass>;
+
 	public:
-		static constexpr size_t CHUNK_TYPE_AMOUNT = 6;
+		static constexpr auto   CLASS_SIZE        = ClassIndex::CLASS_SIZE;
+
+		static constexpr size_t CHUNK_TYPE_AMOUNT = ClassIndex::CLASS_AMOUNT;
+
+		static constexpr size_t ALLOC_PAGE_SIZE   = SLAB_SIZE;
+
+		static constexpr size_t OS_PAGE_SIZE      = 4096;
 
-		static constexpr size_t ALIGN_BYTE        = 4;
+		static constexpr size_t HUGE_PAGE_SIZE    = 2 * 1024 * 1024;
 
-		static constexpr size_t ALIGN_SIZE        = (1 << ALIGN_BYTE);
+		// Slabs are carved lazily, so that there is no need to touch every class in advance.
+		static constexpr bool   INIT_ALLOC        = false;
 
-		static constexpr size_t ALLOC_PAGE_SIZE   = 1024;
+		/// The default amount of empty slabs cached by each class
+		static constexpr size_t FREE_PAGE_LIMIT   = 1;
 
-		static constexpr bool   INIT_ALLOC        = true;
+		/// The amount of empty slabs shared by all classes before unmapping them (4 MiB)
+		static constexpr size_t SLAB_CACHE_LIMIT  = std::max<size_t>(1, 4 * 1024 * 1024 / SLAB_SIZE);
+
+		using StatsType = ReservePoolStats<CHUNK_TYPE_AMOUNT>;
 
 	private:
 		struct Chunk {
@@ -36,111 +109,239 @@ namespace algorithm::allocator {
 			Chunk(): next_chunk_(nullptr) {}
 		};
 
-		struct ChunkInfo {
+		struct PageHeader {
+			/// The pool which carves this slab
+			BasicReserveAllocatorPool *owner_ptr_;
+			/// Neighbours in the slab list of the same class
+			PageHeader *prev_page_ptr_;
+			PageHeader *next_page_ptr_;
+			/// Released chunks in this slab
 			Chunk *chunk_ptr_;
+			/// The amount of alive chunks in this slab
+			uint32_t used_count_;
+			/// The amount of chunks carved from this slab
+			uint32_t carved_count_;
+			/// The size class of this slab
+			uint32_t chunk_idx_;
+		};
+
+		struct ChunkInfo {
+			/// Slabs with spare chunks, partially used ones first
+			PageHeader avail_page_list_;
+			/// Slabs without spare chunks
+			PageHeader full_page_list_;
+
+			size_t page_count_;
+			/// The amount of slabs without any alive chunk
+			size_t free_page_count_;
 
-			ChunkInfo(): chunk_ptr_(nullptr) {}
+			size_t live_chunk_count_;
+
+			ChunkInfo(): page_count_(0), free_page_count_(0), live_chunk_count_(0) {
+				avail_page_list_.prev_page_ptr_ = avail_page_list_.next_page_ptr_ = &avail_page_list_;
+				full_page_list_.prev_page_ptr_  = full_page_list_.next_page_ptr_  = &full_page_list_;
+			}
 		};
 
+		struct alignas(memory::CACHE_LINE_SIZE) RemoteInfo {
+			/// Chunks released by other threads, waiting to be drained by the owner
+			std::atomic<Chunk *> chunk_list_[CHUNK_TYPE_AMOUNT];
+			/// Minus the amount of remote releases, settled with the local counter on retirement
+			std::atomic<int64_t> balance_;
+
+			RemoteInfo(): balance_(0) {
+				std::fill(chunk_list_, chunk_list_ + CHUNK_TYPE_AMOUNT, nullptr);
+			}
+		};
+
+		static constexpr size_t PAGE_HEADER_SIZE = util::ceil(sizeof(PageHeader), memory::CACHE_LINE_SIZE);
+
 		ChunkInfo chunk_list[CHUNK_TYPE_AMOUNT];
+		/// The amount of chunks allocated minus those released by the owner itself
+		int64_t local_live_;
+		/// The high-water mark of cached empty slabs per class
+		size_t free_page_limit_;
+		/// Empty slabs released by classes, linked by next_page_ptr_
+		PageHeader *cached_page_ptr_;
+
+		size_t cached_page_count_;
+
+		RemoteInfo remote_info_;
 
 	public:
-		ReserveAllocatorPool() {
+		BasicReserveAllocatorPool(): local_live_(0), free_page_limit_(FREE_PAGE_LIMIT), cached_page_ptr_(nullptr), cached_page_count_(0) {
 			if constexpr (INIT_ALLOC) {
-				for (size_t i = ALIGN_SIZE; i < max_size(); i <<= 1) {
-					deallocate(allocate(i), i);
+				for (size_t chunk_size: CLASS_SIZE) {
+					deallocate(allocate(chunk_size), chunk_size);
 				}
 			}
 		}
 
-		ReserveAllocatorPool(const ReserveAllocatorPool &other) = delete;
+		BasicReserveAllocatorPool(const BasicReserveAllocatorPool &other) = delete;
 
-		ReserveAllocatorPool(ReserveAllocatorPool &&other)  noexcept {
-			std::memcpy(chunk_list, other.chunk_list, sizeof(void *) * CHUNK_TYPE_AMOUNT);
-			std::fill(other.chunk_list, other.chunk_list + CHUNK_TYPE_AMOUNT, ChunkInfo{});
-		}
+		// Slabs record the address of their owner, so that the pool cannot be moved.
+		BasicReserveAllocatorPool(BasicReserveAllocatorPool &&other) = delete;
 
-		~ReserveAllocatorPool() {
-			for (const ChunkInfo &info: chunk_list) {
-				for (Chunk *cur_chunk_ptr = info.chunk_ptr_; cur_chunk_ptr != nullptr; cur_chunk_ptr = cur_chunk_ptr->next_chunk_) {
-					if (util::align_to_2pow(reinterpret_cast<size_t>(cur_chunk_ptr), ALLOC_PAGE_SIZE)) {
-						operator delete (cur_chunk_ptr, std::align_val_t(ALLOC_PAGE_SIZE));
-					}
-				}
+		~BasicReserveAllocatorPool() {
+			for (ChunkInfo &info: chunk_list) {
+				release_page_list(&info.avail_page_list_);
+				release_page_list(&info.full_page_list_);
 			}
+			release_page_cache();
 		}
 
 	public:
 		void *allocate(size_t size) {
 			if (size > max_size()) {
-				return operator new(size, std::align_val_t(ALIGN_SIZE));
+				return BaseAllocator::allocate(size);
 			}
 
-			int chunk_idx = get_chunk_idx(size);
-			if (chunk_list[chunk_idx].chunk_ptr_ == nullptr) { // No spare chunk left
-				size_t chunk_size = get_chunk_size(chunk_idx);
-				uint8_t *res_chunk_ptr = static_cast<uint8_t *>(operator new(ALLOC_PAGE_SIZE, std::align_val_t(ALLOC_PAGE_SIZE)));
+			int chunk_idx   = get_chunk_idx(size);
+			ChunkInfo &info = chunk_list[chunk_idx];
 
-				uint8_t *start_chunk_ptr = res_chunk_ptr + chunk_size;
-				uint8_t *end_chunk_ptr   = res_chunk_ptr + ALLOC_PAGE_SIZE;
-				uint8_t *last_chunk_ptr  = end_chunk_ptr - chunk_size;
+			PageHeader *page_ptr = info.avail_page_list_.next_page_ptr_;
+			if (page_ptr == &info.avail_page_list_) { // No spare chunk left
+				// Take back chunks released by other threads at once
+				drain_remote(chunk_idx);
 
-		        chunk_list[chunk_idx].chunk_ptr_ = reinterpret_cast<Chunk *>(start_chunk_ptr);
-
-				for (uint8_t *cur_ptr = start_chunk_ptr; cur_ptr != last_chunk_ptr; cur_ptr += chunk_size) {
-					Chunk *cur_chunk_ptr = reinterpret_cast<Chunk *>(cur_ptr);
-					cur_chunk_ptr->next_chunk_ = reinterpret_cast<Chunk *>(cur_ptr + chunk_size);
+				page_ptr = info.avail_page_list_.next_page_ptr_;
+				if (page_ptr == &info.avail_page_list_) {
+					page_ptr = allocate_page(chunk_idx);
 				}
-				reinterpret_cast<Chunk *>(last_chunk_ptr)->next_chunk_ = nullptr;
+			}
 
-				return res_chunk_ptr;
+			void *res_chunk_ptr;
+			if (page_ptr->chunk_ptr_ != nullptr) {
+				res_chunk_ptr        = page_ptr->chunk_ptr_;
+				page_ptr->chunk_ptr_ = page_ptr->chunk_ptr_->next_chunk_;
+			}
+			else {
+				res_chunk_ptr = reinterpret_cast<uint8_t *>(page_ptr) + PAGE_HEADER_SIZE + page_ptr->carved_count_ * get_chunk_size(chunk_idx);
+				++page_ptr->carved_count_;
+			}
+
+			if (page_ptr->used_count_++ == 0) { --info.free_page_count_; }
+			if (page_ptr->used_count_ == get_chunk_amount(chunk_idx)) {
+				unlink_page(page_ptr);
+				link_page_front(&info.full_page_list_, page_ptr);
 			}
 
-			Chunk *res_chunk_ptr = chunk_list[chunk_idx].chunk_ptr_;
-			chunk_list[chunk_idx].chunk_ptr_ = res_chunk_ptr->next_chunk_;
+			++info.live_chunk_count_;
+			++local_live_;
 			return res_chunk_ptr;
 		}
 
 		void deallocate(void *ptr, size_t size) {
 			if (size > max_size()) {
-				operator delete (ptr, std::align_val_t(ALIGN_SIZE));
+				BaseAllocator::deallocate(ptr, size);
+				return;
 			}
 
-			int chunk_idx = get_chunk_idx(size);
+			PageHeader *page_ptr = get_page_header(ptr);
+
+			BasicReserveAllocatorPool *owner_ptr = page_ptr->owner_ptr_;
+			if (owner_ptr != this) {
+				owner_ptr->remote_deallocate(ptr, get_chunk_idx(size));
+				return;
+			}
 
-			Chunk *res_chunk_ptr = reinterpret_cast<Chunk *>(ptr);
-			res_chunk_ptr->next_chunk_ = chunk_list[chunk_idx].chunk_ptr_;
+			--local_live_;
+			release_chunk(page_ptr, static_cast<Chunk *>(ptr));
 		}
 
 		void *reallocate(void *ptr, size_t old_size, size_t new_size) {
 			if (old_size > max_size() && new_size > max_size()) {
-				return std::realloc(ptr, new_size);
+				return BaseAllocator::reallocate(ptr, old_size, new_size);
 			}
 
-			if (new_size > max_size()) {
-				void *new_chunk_ptr = std::malloc(new_size);
-				std::memcpy(new_chunk_ptr, ptr, old_size);
-				deallocate(ptr, old_size);
-				return new_chunk_ptr;
-			}
-			else if (old_size > max_size()) {
-				void *new_chunk_ptr = allocate(new_size);
-				std::memcpy(new_chunk_ptr, ptr, old_size);
-				std::free(ptr);
-				return new_chunk_ptr;
+			if (old_size <= max_size() && new_size <= max_size() &&
+			    get_chunk_idx(old_size) == get_chunk_idx(new_size)) {
+				return ptr;
 			}
 
-			if (old_size == new_size) { return ptr; }
-
 			void *new_chunk_ptr = allocate(new_size);
-			std::memcpy(new_chunk_ptr, ptr, old_size);
+			std::memcpy(new_chunk_ptr, ptr, std::min(old_size, new_size));
 			deallocate(ptr, old_size);
 			return new_chunk_ptr;
 		}
 
-	private:
+	public:
+		/*!
+		 * @brief Report the occupancy of each size class.
+		 * Chunks released by other threads are drained first, so that they are counted as free.
+		 * Blocks larger than the max chunk size are not counted.
+		 * @note Only the owner thread is allowed to call it.
+		 */
+		StatsType stats() {
+			StatsType res;
+			for (size_t chunk_idx = 0; chunk_idx < CHUNK_TYPE_AMOUNT; ++chunk_idx) {
+				drain_remote(chunk_idx);
+
+				const ChunkInfo &info = chunk_list[chunk_idx];
+				size_t chunk_size     = get_chunk_size(chunk_idx);
+				size_t total_chunk    = info.page_count_ * get_chunk_amount(chunk_idx);
+
+				res.class_stats[chunk_idx] = {
+				        .chunk_size = chunk_size,
+				        .live_bytes = info.live_chunk_count_ * chunk_size,
+				        .free_bytes = (total_chunk - info.live_chunk_count_) * chunk_size,
+				        .page_count = info.page_count_
+				};
+			}
+			res.cached_page_count = cached_page_count_;
+			return res;
+		}
+
+		/*!
+		 * @brief Set the amount of empty slabs each class may cache before unmapping them.
+		 */
+		void set_free_page_limit(size_t limit) {
+			free_page_limit_ = limit;
+			trim(limit);
+		}
+
+		[[nodiscard]] size_t get_free_page_limit() const {
+			return free_page_limit_;
+		}
+
+		/*!
+		 * @brief Unmap empty slabs until each class caches no more than the limit,
+		 * as well as all slabs in the shared cache.
+		 * @note Only the owner thread is allowed to call it.
+		 */
+		void trim(size_t limit = 0) {
+			for (size_t chunk_idx = 0; chunk_idx < CHUNK_TYPE_AMOUNT; ++chunk_idx) {
+				drain_remote(chunk_idx);
+
+				ChunkInfo &info = chunk_list[chunk_idx];
+				// Empty slabs are kept at the tail of the available list.
+				PageHeader *page_ptr = info.avail_page_list_.prev_page_ptr_;
+				while (info.free_page_count_ > limit && page_ptr != &info.avail_page_list_ && page_ptr->used_count_ == 0) {
+					PageHeader *prev_page_ptr = page_ptr->prev_page_ptr_;
+					release_page(page_ptr);
+					page_ptr = prev_page_ptr;
+				}
+			}
+			release_page_cache();
+		}
+
+		/*!
+		 * @brief Give up the ownership of a heap-allocated pool, usually on the exit of its thread.
+		 * The pool is destroyed at once if no chunk is alive,
+		 * otherwise by the thread releasing the last alive chunk.
+		 * @param pool_ptr The pool allocated by operator new
+		 */
+		static void retire(BasicReserveAllocatorPool *pool_ptr) {
+			int64_t local_live = pool_ptr->local_live_;
+			int64_t balance    = pool_ptr->remote_info_.balance_.fetch_add(local_live, std::memory_order::acq_rel);
+			if (balance + local_live == 0) {
+				delete pool_ptr;
+			}
+		}
+
+	public:
 		static constexpr size_t min_size() {
-			constexpr size_t MIN_SIZE = ALIGN_SIZE;
+			constexpr size_t MIN_SIZE = CLASS_SIZE.front();
 			// The min space should be larger than a pointer
 			static_assert(MIN_SIZE >= sizeof(void *));
 
@@ -148,36 +349,245 @@ namespace algorithm::allocator {
 		}
 
 		static constexpr size_t max_size() {
-			constexpr size_t MAX_SIZE = ALIGN_SIZE << (CHUNK_TYPE_AMOUNT - 1);
+			constexpr size_t MAX_SIZE = CLASS_SIZE.back();
 
 			static_assert(MAX_SIZE >= min_size(), "The max size should be larger than min size");
-			static_assert(MAX_SIZE <= ALLOC_PAGE_SIZE, "The max size should be smaller than allocated chunk");
+			static_assert(MAX_SIZE + PAGE_HEADER_SIZE <= ALLOC_PAGE_SIZE, "The max size should be smaller than allocated chunk");
 
 			return MAX_SIZE;
 		}
 
 		static constexpr int get_chunk_idx(size_t size) {
-			size_t offset = std::bit_width(size) - 1;
+			return ClassIndex::get_idx(size);
+		}
 
-			if (offset < ALIGN_BYTE) { return 0; }
+		static constexpr size_t get_chunk_size(size_t idx) {
+			return CLASS_SIZE[idx];
+		}
 
-			size_t floor_size = 1 << offset;
-			if (floor_size == size) {
-				return static_cast<int>((offset - ALIGN_BYTE));
+		static constexpr size_t get_chunk_amount(size_t chunk_idx) {
+			return (ALLOC_PAGE_SIZE - PAGE_HEADER_SIZE) / get_chunk_size(chunk_idx);
+		}
+
+	private:
+		void remote_deallocate(void *ptr, int chunk_idx) {
+			std::atomic<Chunk *> &remote_list = remote_info_.chunk_list_[chunk_idx];
+
+			Chunk *res_chunk_ptr = static_cast<Chunk *>(ptr);
+			Chunk *head_ptr      = remote_list.load(std::memory_order::relaxed);
+			do {
+				res_chunk_ptr->next_chunk_ = head_ptr;
+			} while (!remote_list.compare_exchange_weak(head_ptr, res_chunk_ptr,
+			                                            std::memory_order::release,
+			                                            std::memory_order::relaxed));
+
+			// The balance can only fall to zero after the owner retires.
+			if (remote_info_.balance_.fetch_sub(1, std::memory_order::acq_rel) == 1) {
+				delete this;
 			}
-			return static_cast<int>((offset - (ALIGN_BYTE - 1)));
 		}
 
-		static constexpr size_t get_chunk_size(size_t idx) {
-			return min_size() << idx;
+		void drain_remote(size_t chunk_idx) {
+			Chunk *chunk_ptr = remote_info_.chunk_list_[chunk_idx].exchange(nullptr, std::memory_order::acquire);
+			while (chunk_ptr != nullptr) {
+				Chunk *next_chunk_ptr = chunk_ptr->next_chunk_;
+				release_chunk(get_page_header(chunk_ptr), chunk_ptr);
+				chunk_ptr = next_chunk_ptr;
+			}
 		}
 
-		static constexpr size_t get_chunk_amount(size_t chunk_idx) {
-			return ALLOC_PAGE_SIZE / get_chunk_size(chunk_idx);
+		void release_chunk(PageHeader *page_ptr, Chunk *chunk_ptr) {
+			ChunkInfo &info = chunk_list[page_ptr->chunk_idx_];
+
+			bool was_full = (page_ptr->used_count_ == get_chunk_amount(page_ptr->chunk_idx_));
+
+			chunk_ptr->next_chunk_ = page_ptr->chunk_ptr_;
+			page_ptr->chunk_ptr_   = chunk_ptr;
+			--page_ptr->used_count_;
+			--info.live_chunk_count_;
+
+			if (page_ptr->used_count_ == 0) {
+				if (++info.free_page_count_ > free_page_limit_) {
+					release_page(page_ptr);
+				}
+				else {
+					// Keep empty slabs behind partially used ones
+					unlink_page(page_ptr);
+					link_page_back(&info.avail_page_list_, page_ptr);
+				}
+			}
+			else if (was_full) {
+				unlink_page(page_ptr);
+				link_page_front(&info.avail_page_list_, page_ptr);
+			}
+		}
+
+		PageHeader *allocate_page(size_t chunk_idx) {
+			void *slab_ptr = cached_page_ptr_;
+			if (slab_ptr != nullptr) {
+				cached_page_ptr_ = cached_page_ptr_->next_page_ptr_;
+				--cached_page_count_;
+			}
+			else {
+				slab_ptr = map_slab();
+			}
+
+			PageHeader *page_ptr = new (slab_ptr) PageHeader{
+			        .owner_ptr_     = this,
+			        .prev_page_ptr_ = nullptr,
+			        .next_page_ptr_ = nullptr,
+			        .chunk_ptr_     = nullptr,
+			        .used_count_    = 0,
+			        .carved_count_  = 0,
+			        .chunk_idx_     = static_cast<uint32_t>(chunk_idx)
+			};
+
+			ChunkInfo &info = chunk_list[chunk_idx];
+			++info.page_count_;
+			++info.free_page_count_;
+			link_page_front(&info.avail_page_list_, page_ptr);
+
+			return page_ptr;
+		}
+
+		void release_page(PageHeader *page_ptr) {
+			ChunkInfo &info = chunk_list[page_ptr->chunk_idx_];
+			--info.page_count_;
+			--info.free_page_count_;
+
+			unlink_page(page_ptr);
+			// Keep the slab for any class, so that a shift of sizes does not remap memory.
+			if (cached_page_count_ < SLAB_CACHE_LIMIT) {
+				page_ptr->next_page_ptr_ = cached_page_ptr_;
+				cached_page_ptr_         = page_ptr;
+				++cached_page_count_;
+			}
+			else {
+				munmap(page_ptr, ALLOC_PAGE_SIZE);
+			}
+		}
+
+		void release_page_cache() {
+			while (cached_page_ptr_ != nullptr) {
+				PageHeader *next_page_ptr = cached_page_ptr_->next_page_ptr_;
+				munmap(cached_page_ptr_, ALLOC_PAGE_SIZE);
+				cached_page_ptr_ = next_page_ptr;
+			}
+			cached_page_count_ = 0;
+		}
+
+		static void release_page_list(PageHeader *list_head_ptr) {
+			PageHeader *page_ptr = list_head_ptr->next_page_ptr_;
+			while (page_ptr != list_head_ptr) {
+				PageHeader *next_page_ptr = page_ptr->next_page_ptr_;
+				munmap(page_ptr, ALLOC_PAGE_SIZE);
+				page_ptr = next_page_ptr;
+			}
+			list_head_ptr->prev_page_ptr_ = list_head_ptr->next_page_ptr_ = list_head_ptr;
+		}
+
+		/*!
+		 * @brief Map a slab aligned to its size, so that its header can be found from any chunk inside.
+		 */
+		static void *map_slab() {
+			constexpr int MAP_PROT = PROT_READ | PROT_WRITE;
+			constexpr int MAP_FLAG = MAP_PRIVATE | MAP_ANONYMOUS;
+
+			if constexpr (HUGE_PAGE) {
+				void *map_ptr = mmap(nullptr, ALLOC_PAGE_SIZE, MAP_PROT, MAP_FLAG | MAP_HUGETLB, -1, 0);
+				// Fall back to transparent huge pages if no huge page is reserved.
+				if (map_ptr != MAP_FAILED) { return map_ptr; }
+			}
+
+			if constexpr (ALLOC_PAGE_SIZE == OS_PAGE_SIZE) {
+				void *map_ptr = mmap(nullptr, ALLOC_PAGE_SIZE, MAP_PROT, MAP_FLAG, -1, 0);
+				if (map_ptr == MAP_FAILED) { throw std::bad_alloc(); }
+				return map_ptr;
+			}
+			else {
+				// Map twice the size and trim both sides to the alignment
+				void *map_ptr = mmap(nullptr, ALLOC_PAGE_SIZE * 2, MAP_PROT, MAP_FLAG, -1, 0);
+				if (map_ptr == MAP_FAILED) { throw std::bad_alloc(); }
+
+				uint8_t *map_start_ptr  = static_cast<uint8_t *>(map_ptr);
+				uint8_t *map_end_ptr    = map_start_ptr + ALLOC_PAGE_SIZE * 2;
+				uint8_t *slab_start_ptr = reinterpret_cast<uint8_t *>(util::ceil_2pow(reinterpret_cast<uintptr_t>(map_ptr), ALLOC_PAGE_SIZE));
+				uint8_t *slab_end_ptr   = slab_start_ptr + ALLOC_PAGE_SIZE;
+
+				if (slab_start_ptr != map_start_ptr) { munmap(map_start_ptr, slab_start_ptr - map_start_ptr); }
+				if (slab_end_ptr != map_end_ptr) { munmap(slab_end_ptr, map_end_ptr - slab_end_ptr); }
+
+				if constexpr (HUGE_PAGE) {
+					madvise(slab_start_ptr, ALLOC_PAGE_SIZE, MADV_HUGEPAGE);
+				}
+				return slab_start_ptr;
+			}
+		}
+
+		static void unlink_page(PageHeader *page_ptr) {
+			page_ptr->prev_page_ptr_->next_page_ptr_ = page_ptr->next_page_ptr_;
+			page_ptr->next_page_ptr_->prev_page_ptr_ = page_ptr->prev_page_ptr_;
+		}
+
+		static void link_page_front(PageHeader *list_head_ptr, PageHeader *page_ptr) {
+			page_ptr->prev_page_ptr_ = list_head_ptr;
+			page_ptr->next_page_ptr_ = list_head_ptr->next_page_ptr_;
+			list_head_ptr->next_page_ptr_->prev_page_ptr_ = page_ptr;
+			list_head_ptr->next_page_ptr_ = page_ptr;
+		}
+
+		static void link_page_back(PageHeader *list_head_ptr, PageHeader *page_ptr) {
+			page_ptr->next_page_ptr_ = list_head_ptr;
+			page_ptr->prev_page_ptr_ = list_head_ptr->prev_page_ptr_;
+			list_head_ptr->prev_page_ptr_->next_page_ptr_ = page_ptr;
+			list_head_ptr->prev_page_ptr_ = page_ptr;
+		}
+
+		static PageHeader *get_page_header(void *ptr) {
+			return reinterpret_cast<PageHeader *>(util::floor_2pow(reinterpret_cast<uintptr_t>(ptr), ALLOC_PAGE_SIZE));
+		}
+
+	private:
+		static_assert(std::has_single_bit(SLAB_SIZE), "The slab size should be power of 2");
+		static_assert(SLAB_SIZE >= OS_PAGE_SIZE && SLAB_SIZE <= HUGE_PAGE_SIZE, "The slab size should be between 4 KiB and 2 MiB");
+		static_assert(!HUGE_PAGE || SLAB_SIZE == HUGE_PAGE_SIZE, "Slabs backed by huge page should be 2 MiB");
+	};
+
+	using ReserveAllocatorPool = BasicReserveAllocatorPool<>;
+
+	/*!
+	 * @brief Holder of the pool of the current thread.
+	 * The pool is retired rather than destroyed on thread exit, as other threads may still hold its chunks.
+	 */
+	template<class Pool>
+	class ThreadAllocatorPool {
+	private:
+		Pool *pool_ptr_;
+
+	public:
+		ThreadAllocatorPool(): pool_ptr_(new Pool) {}
+
+		ThreadAllocatorPool(const ThreadAllocatorPool &other) = delete;
+
+		~ThreadAllocatorPool() {
+			Pool::retire(pool_ptr_);
+		}
+
+	public:
+		Pool &get() {
+			return *pool_ptr_;
 		}
 	};
 
-	inline static thread_local ReserveAllocatorPool thread_allocator_pool;
+	/*!
+	 * @brief Acquire the pool owned by the current thread
+	 */
+	template<class Pool = ReserveAllocatorPool>
+	inline Pool &get_thread_allocator_pool() {
+		// A function-local holder, as GCC skips the dynamic initialization of thread_local variable templates.
+		thread_local ThreadAllocatorPool<Pool> thread_allocator_pool;
+		return thread_allocator_pool.get();
+	}
 }
 
 #endif//ALGORITHM_ALLOCATOR_THREAD_ALLOCAOTR_H
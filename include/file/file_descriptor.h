@@ -12,6 +12,8 @@
 #include <cerrno>
 #include <cstring>
 #include <span>
+#include <limits>
+#include <algorithm>
 
 #include <sys/types.h>
 #include <sys/mman.h>
@@ -45,7 +47,17 @@ namespace algorithm::file {
 		Shared = MAP_SHARED,
 		Anonymous = MAP_ANONYMOUS,
 		DenyWrite = MAP_DENYWRITE,
-		Locked = MAP_LOCKED
+		Locked = MAP_LOCKED,
+		/// Map at the hint address only, failing if it is occupied
+		FixedNoReplace = MAP_FIXED_NOREPLACE
+	};
+
+	enum class FileMmapAdvice : int {
+		Normal = MADV_NORMAL,
+		Random = MADV_RANDOM,
+		Sequential = MADV_SEQUENTIAL,
+		WillNeed = MADV_WILLNEED,
+		DontNeed = MADV_DONTNEED
 	};
 
 	enum class FileRelocateType: int {
@@ -82,9 +94,9 @@ namespace algorithm::file {
 	public:
 		FileMapper(): fd_(-1) {}
 
-		FileMapper(int fd, size_t size, FileMmapProt prot, FileMmapFlag flag) {
-			void *start_ptr = mmap(nullptr, size, static_cast<int>(prot), static_cast<int>(flag), fd, 0);
-			if (start_ptr == nullptr) {
+		FileMapper(int fd, size_t size, FileMmapProt prot, FileMmapFlag flag, void *addr_hint = nullptr): fd_(-1) {
+			void *start_ptr = mmap(addr_hint, size, static_cast<int>(prot), static_cast<int>(flag), fd, 0);
+			if (start_ptr == MAP_FAILED) {
 				util::logger::logger_error("Fail to mmap file: ", fd);
 				util::logger::logger_error(std::strerror(errno));
 			}
@@ -99,6 +111,20 @@ namespace algorithm::file {
 
 		FileMapper(FileMapper &&other) noexcept : fd_(other.fd_), map_area_(other.map_area_) {
 			other.fd_ = -1;
+			other.map_area_ = {};
+		}
+
+		FileMapper &operator=(FileMapper &&other) noexcept {
+			if (this != &other) {
+				if (fd_ != -1) {
+					munmap(map_area_.data(), map_area_.size());
+				}
+				fd_       = other.fd_;
+				map_area_ = other.map_area_;
+				other.fd_ = -1;
+				other.map_area_ = {};
+			}
+			return *this;
 		}
 
 		~FileMapper() {
@@ -111,6 +137,33 @@ namespace algorithm::file {
 		std::span<uint8_t> get_map_area() const {
 			return map_area_;
 		}
+
+		/*!
+		 * @brief Whether the file has been mapped successfully
+		 */
+		[[nodiscard]] bool is_mapped() const {
+			return fd_ != -1;
+		}
+
+		/*!
+		 * @brief Advise the kernel of the access pattern of [offset, offset + size) in the map area,
+		 * where offset is aligned down to the page and size is cut at the end of the area.
+		 */
+		bool advise(FileMmapAdvice advice, size_t offset = 0, size_t size = std::numeric_limits<size_t>::max()) const {
+			if (offset >= map_area_.size()) { return false; }
+
+			const size_t page_size      = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+			const size_t aligned_offset = offset / page_size * page_size;
+			const size_t aligned_size   = std::min(size, map_area_.size() - offset) + (offset - aligned_offset);
+			return madvise(map_area_.data() + aligned_offset, aligned_size, static_cast<int>(advice)) == 0;
+		}
+
+		/*!
+		 * @brief Write dirty pages back to the file synchronously
+		 */
+		bool sync() const {
+			return msync(map_area_.data(), map_area_.size(), MS_SYNC) == 0;
+		}
 	};
 
 	class FileDescriptor {
@@ -122,8 +175,8 @@ namespace algorithm::file {
 	public:
 		FileDescriptor(): fd_(-1) {}
 
-		FileDescriptor(std::string_view file_path, FileOpenType type):
-                fd_(open(file_path.data(), static_cast<int>(type))) {
+		FileDescriptor(std::string_view file_path, FileOpenType type, mode_t mode = 0644):
+                fd_(open(file_path.data(), static_cast<int>(type), mode)) {
 			if (fd_ == -1) {
 				util::logger::logger_error("Fail to open file: ", file_path);
 				util::logger::logger_error(std::strerror(errno));
@@ -132,6 +185,10 @@ namespace algorithm::file {
 			stat(file_path.data(), &file_stat_);
 		}
 
+		FileDescriptor(FileDescriptor &&other) noexcept : fd_(other.fd_), file_stat_(other.file_stat_) {
+			other.fd_ = -1;
+		}
+
 		~FileDescriptor() {
 			if (fd_ != -1) {
 				close(fd_);
@@ -143,8 +200,33 @@ namespace algorithm::file {
 			return FileMapper(fd_, file_stat_.st_size, prot, flag);
 		}
 
-		FileMapper get_mapper(size_t size, FileMmapProt prot, FileMmapFlag flag) const {
-			return FileMapper(fd_, size, prot, flag);
+		FileMapper get_mapper(size_t size, FileMmapProt prot, FileMmapFlag flag, void *addr_hint = nullptr) const {
+			return FileMapper(fd_, size, prot, flag, addr_hint);
+		}
+
+	public:
+		/*!
+		 * @brief Whether the file has been opened successfully
+		 */
+		[[nodiscard]] bool is_open() const {
+			return fd_ != -1;
+		}
+
+		[[nodiscard]] size_t get_size() const {
+			return file_stat_.st_size;
+		}
+
+		/*!
+		 * @brief Extend or shrink the file, with extended part filled by zero
+		 */
+		bool resize(size_t size) {
+			if (ftruncate(fd_, static_cast<off_t>(size)) != 0) {
+				util::logger::logger_error("Fail to resize file: ", fd_);
+				util::logger::logger_error(std::strerror(errno));
+				return false;
+			}
+			fstat(fd_, &file_stat_);
+			return true;
 		}
 
 	public:
@@ -134,7 +134,7 @@ namespace algorithm::memory {
 	};
 
 	/// Global configer about NUMA
-	inline static NUMAConfig NUMA_CONFIG;
+	inline NUMAConfig NUMA_CONFIG;
 
 	/*!
 	 * @brief Acquire whether numa is available in the current system
@@ -10,8 +10,10 @@
 #include <vector>
 #include <atomic>
 #include <mutex>
+#include <algorithm>
 
 #include <sys/sysinfo.h>
+#include <sched.h>
 
 #include <memory/numa.h>
 #include <memory/thread_config.h>
@@ -151,7 +153,12 @@ namespace algorithm::memory {
 		}
 
 		[[nodiscard]] int get_cpu_numa_id(int tid) const {
-			return cpu_id_to_numa_[tid_to_cpu_id_[tid]];
+			int cpu_id = (tid == -1) ? -1 : tid_to_cpu_id_[tid];
+			// Threads without bound cpu are located by the cpu they are running on
+			if (cpu_id == -1) { cpu_id = sched_getcpu(); }
+			if (cpu_id < 0 || cpu_id >= num_cpu_) { return 0; }
+
+			return std::max(cpu_id_to_numa_[cpu_id], 0);
 		}
 
 	public:
@@ -168,7 +175,7 @@ namespace algorithm::memory {
 		}
 	};
 
-	inline static ThreadConfig THREAD_CONFIG;
+	inline ThreadConfig THREAD_CONFIG;
 
 	class ThreadInfo {
 	private:
@@ -229,12 +236,20 @@ namespace algorithm::memory {
 
 		[[nodiscard]] int bind_cpu_on_node(int numa_id) const {
 			int cpu_id = THREAD_CONFIG.allocate_cpu_on_node(tid_, numa_id);
+			if (cpu_id == -1) {
+				util::logger::logger_warn("No spare cpu on node ", numa_id, ", thread is left unbound.");
+				return cpu_id;
+			}
 			ThreadConfig::bind_cpu(cpu_id);
 			return cpu_id;
 		}
 
 		[[nodiscard]] std::pair<int, int> bind_cpu() const {
 			auto [numa_id, cpu_id] = THREAD_CONFIG.allocate_cpu(tid_);
+			if (cpu_id == -1) {
+				util::logger::logger_warn("No spare cpu, thread is left unbound.");
+				return { numa_id, cpu_id };
+			}
 			ThreadConfig::bind_cpu(cpu_id);
 			return { numa_id, cpu_id };
 		}
@@ -7,6 +7,8 @@
 #ifndef UTIL_ALGORITHM_THREAD_CONFIG_H
 #define UTIL_ALGORITHM_THREAD_CONFIG_H
 
+#include <thread>
+
 namespace algorithm::memory {
 
 	#ifndef MAX_THREAD_NUM_DEFINED
@@ -19,7 +21,7 @@ namespace algorithm::memory {
 	/*!
 	 * @brief Pause to prevent excess processor bus usage
 	 */
-	void pause() {
+	inline void pause() {
 	#if defined( __sparc )
 		__asm__ __volatile__ ( "rd %ccr,%g0" );
 	#elif defined( __i386 ) || defined( __x86_64 )
@@ -0,0 +1,334 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_STRUCTURE_BINARY_FUSE_FILTER_H
+#define ALGORITHM_STRUCTURE_BINARY_FUSE_FILTER_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <util/hash.h>
+#include <structure/map/bloom_filter.h>
+
+namespace algorithm::structure {
+
+	inline namespace fuse_filter {
+
+		/*!
+		 * @brief Static filter built in bulk from a set of keys, where a key is contained iff
+		 * the xor of the fingerprints in its 3 slots equals its own fingerprint. Hence a lookup takes 3 memory accesses.
+		 * The 3 slots lie in 3 consecutive segments, which lets the table take about 1.125 slots per key
+		 * (Graf and Lemire, Binary Fuse Filters: Fast and Smaller Than Xor Filters, 2022).
+		 * The false positive probability is 2^-FINGERPRINT_BITS.
+		 * @tparam Fingerprint uint8_t or uint16_t
+		 */
+		template<typename Fingerprint = uint8_t>
+		class BinaryFuseFilter {
+		public:
+			static_assert(std::is_same_v<Fingerprint, uint8_t> || std::is_same_v<Fingerprint, uint16_t>,
+			              "Fingerprints are expected to take 8 or 16 bits");
+
+			using fingerprint_type = Fingerprint;
+
+			static constexpr uint32_t FINGERPRINT_BITS = sizeof(Fingerprint) * bits_per_char;
+
+			static constexpr uint32_t ARITY = 3;
+
+			static constexpr uint64_t MAX_SEGMENT_LENGTH = 1ULL << 18;
+
+			/// The amount of seeds tried before building gives up, which is hardly reached
+			static constexpr uint32_t MAX_BUILD_ATTEMPT = 100;
+
+		private:
+			std::vector<Fingerprint> fingerprint_array_;
+			uint64_t segment_length_;
+			uint64_t segment_length_mask_;
+			uint64_t segment_count_length_;
+			uint64_t element_count_;
+			uint64_t random_seed_;
+
+		public:
+			BinaryFuseFilter(): segment_length_(0), segment_length_mask_(0), segment_count_length_(0),
+			                    element_count_(0), random_seed_(0) {}
+
+			/*!
+			 * @brief Build the filter from keys, where duplicates are allowed. Check valid() for failure.
+			 */
+			template<typename T>
+			explicit BinaryFuseFilter(std::span<const T> keys, uint64_t random_seed = BloomParameter::random_seed):
+			        BinaryFuseFilter() {
+				build(keys, random_seed);
+			}
+
+		public:
+			/*!
+			 * @brief Rebuild the filter from keys, dropping all keys before.
+			 * @return false if no seed among MAX_BUILD_ATTEMPT ones succeeds, where the filter is left invalid
+			 */
+			template<typename T>
+			bool build(std::span<const T> keys, uint64_t random_seed = BloomParameter::random_seed) {
+				uint64_t seed_state = random_seed;
+				std::vector<uint64_t> hash_array(keys.size());
+				// Duplicates share all slots and are never peeled, hence dropped once an attempt fails
+				bool deduplicate = false;
+
+				for (uint32_t attempt = 0; attempt < MAX_BUILD_ATTEMPT; ++attempt) {
+					random_seed_ = next_seed(seed_state);
+
+					hash_array.resize(keys.size());
+					for (size_t i = 0; i < keys.size(); ++i) {
+						const std::span<const uint8_t> bytes = key_bytes(keys[i]);
+						hash_array[i] = util::hash64(bytes.data(), bytes.size(), random_seed_);
+					}
+					if (deduplicate) {
+						std::sort(hash_array.begin(), hash_array.end());
+						hash_array.erase(std::unique(hash_array.begin(), hash_array.end()), hash_array.end());
+					}
+
+					allocate(hash_array.size());
+					// Sorted hashes are grouped by segment already
+					if (!deduplicate) { group_by_segment(hash_array); }
+					if (populate(hash_array)) {
+						element_count_ = hash_array.size();
+						return true;
+					}
+					deduplicate = true;
+				}
+
+				fingerprint_array_.clear();
+				element_count_ = 0;
+				return false;
+			}
+
+		public:
+			bool contains(const uint8_t *key_begin, size_t length) const {
+				return contains_hash(util::hash64(key_begin, length, random_seed_));
+			}
+
+			template<typename T>
+			bool contains(const T &t) const {
+				const std::span<const uint8_t> bytes = key_bytes(t);
+				return contains(bytes.data(), bytes.size());
+			}
+
+			bool contains_hash(uint64_t key_hash) const {
+				uint64_t index_array[ARITY];
+				slot_indices(key_hash, index_array);
+				const Fingerprint fingerprint = fingerprint_of(key_hash)
+				                                ^ fingerprint_array_[index_array[0]]
+				                                ^ fingerprint_array_[index_array[1]]
+				                                ^ fingerprint_array_[index_array[2]];
+				return fingerprint == 0;
+			}
+
+			/*!
+			 * @brief Look up keys a window at a time, where slots of the whole window are prefetched before any test
+			 * @param bitmap_ptr Bitmap of at least (keys.size() + 63) / 64 words, with bit i set if key i may be contained
+			 * @return The amount of keys which may be contained
+			 */
+			template<typename T>
+			size_t contains_batch(std::span<const T> keys, uint64_t *bitmap_ptr) const {
+				uint64_t hash_array[BATCH_WINDOW];
+				std::fill(bitmap_ptr, bitmap_ptr + (keys.size() + 63) / 64, 0);
+
+				size_t positive_amount = 0;
+				for (size_t window_start = 0; window_start < keys.size(); window_start += BATCH_WINDOW) {
+					const size_t window_size = std::min(BATCH_WINDOW, keys.size() - window_start);
+					for (size_t i = 0; i < window_size; ++i) {
+						const std::span<const uint8_t> bytes = key_bytes(keys[window_start + i]);
+						hash_array[i] = util::hash64(bytes.data(), bytes.size(), random_seed_);
+
+						uint64_t index_array[ARITY];
+						slot_indices(hash_array[i], index_array);
+						for (uint64_t index: index_array) { __builtin_prefetch(fingerprint_array_.data() + index, 0, 1); }
+					}
+
+					for (size_t i = 0; i < window_size; ++i) {
+						const size_t key_idx = window_start + i;
+						if (contains_hash(hash_array[i])) {
+							bitmap_ptr[key_idx / 64] |= 1ULL << (key_idx % 64);
+							++positive_amount;
+						}
+					}
+				}
+				return positive_amount;
+			}
+
+		public:
+			bool valid() const {
+				return !fingerprint_array_.empty();
+			}
+
+			/*!
+			 * @brief The amount of bits in the table
+			 */
+			uint64_t size() const {
+				return fingerprint_array_.size() * FINGERPRINT_BITS;
+			}
+
+			uint64_t element_count() const {
+				return element_count_;
+			}
+
+			uint64_t segment_length() const {
+				return segment_length_;
+			}
+
+			double effective_fpp() const {
+				return 1.0 / (1ULL << FINGERPRINT_BITS);
+			}
+
+		private:
+			static uint64_t next_seed(uint64_t &state) {
+				uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+				z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+				z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+				return z ^ (z >> 31);
+			}
+
+			static Fingerprint fingerprint_of(uint64_t key_hash) {
+				return static_cast<Fingerprint>(key_hash ^ (key_hash >> 32));
+			}
+
+			/*!
+			 * @brief The slot of a key in each of 3 consecutive segments, where the first segment is picked by the high bits
+			 * and the offsets in the other two by disjoint low bits
+			 */
+			void slot_indices(uint64_t key_hash, uint64_t *index_array) const {
+				const uint64_t index_0 = util::fast_range(key_hash, segment_count_length_);
+				index_array[0] = index_0;
+				index_array[1] = (index_0 + segment_length_) ^ ((key_hash >> 18) & segment_length_mask_);
+				index_array[2] = (index_0 + 2 * segment_length_) ^ (key_hash & segment_length_mask_);
+			}
+
+			/*!
+			 * @brief Size segments for element_count keys, where larger sets take longer and relatively fewer segments
+			 */
+			void allocate(uint64_t element_count) {
+				if (element_count == 0) { segment_length_ = 4; }
+				else {
+					const auto length_log = static_cast<int>(std::floor(std::log(static_cast<double>(element_count)) / std::log(3.33) + 2.25));
+					segment_length_ = std::min<uint64_t>(1ULL << std::max(length_log, 0), MAX_SEGMENT_LENGTH);
+				}
+				segment_length_mask_ = segment_length_ - 1;
+
+				const double size_factor = element_count <= 1 ? 0.0 : std::max(1.125, 0.875 + 0.25 * std::log(1000000.0) / std::log(static_cast<double>(element_count)));
+				const auto   capacity    = static_cast<uint64_t>(std::round(element_count * size_factor));
+
+				// Slots of the last key reach ARITY - 1 segments beyond those picked for the first slot
+				const uint64_t total_segment_count = (capacity + segment_length_ - 1) / segment_length_;
+				const uint64_t segment_count = total_segment_count <= ARITY - 1 ? 1 : total_segment_count - (ARITY - 1);
+
+				segment_count_length_ = segment_count * segment_length_;
+				fingerprint_array_.assign((segment_count + ARITY - 1) * segment_length_, 0);
+			}
+
+			/*!
+			 * @brief Order hashes by the segment of their first slot in linear time,
+			 * so that peeling walks the table mostly forward instead of at random
+			 */
+			void group_by_segment(std::vector<uint64_t> &hash_array) const {
+				const uint64_t segment_count = segment_count_length_ / segment_length_;
+				std::vector<uint64_t> offset_array(segment_count + 1, 0);
+				for (const uint64_t key_hash: hash_array) {
+					++offset_array[util::fast_range(key_hash, segment_count_length_) / segment_length_ + 1];
+				}
+				for (uint64_t i = 1; i <= segment_count; ++i) { offset_array[i] += offset_array[i - 1]; }
+
+				std::vector<uint64_t> grouped_array(hash_array.size());
+				for (const uint64_t key_hash: hash_array) {
+					grouped_array[offset_array[util::fast_range(key_hash, segment_count_length_) / segment_length_]++] = key_hash;
+				}
+				hash_array.swap(grouped_array);
+			}
+
+			/*!
+			 * @brief Peel the 3-partite hypergraph of distinct hashes, then assign fingerprints in the reverse order of peeling
+			 * @return false if the graph has a core which cannot be peeled
+			 */
+			bool populate(const std::vector<uint64_t> &hash_array) {
+				const uint64_t slot_amount = fingerprint_array_.size();
+				// Amount of keys in each slot times 4, plus the xor of positions (0, 1 or 2) in their triples
+				std::vector<uint8_t>  slot_count(slot_amount, 0);
+				// Xor of hashes of keys in each slot, which is the hash itself once a single key is left
+				std::vector<uint64_t> slot_hash(slot_amount, 0);
+
+				for (const uint64_t key_hash: hash_array) {
+					uint64_t index_array[ARITY];
+					slot_indices(key_hash, index_array);
+					for (uint32_t j = 0; j < ARITY; ++j) {
+						// Counters overflow with more than 63 keys, where the graph is hardly peelable
+						if (slot_count[index_array[j]] >= 0xFC) { return false; }
+						slot_count[index_array[j]] = static_cast<uint8_t>((slot_count[index_array[j]] + 4) ^ j);
+						slot_hash[index_array[j]] ^= key_hash;
+					}
+				}
+
+				std::vector<uint64_t> alone_queue;
+				alone_queue.reserve(slot_amount);
+				for (uint64_t i = 0; i < slot_amount; ++i) {
+					if ((slot_count[i] >> 2) == 1) { alone_queue.push_back(i); }
+				}
+
+				// Peeled hashes and the position of the slot they are left alone in
+				std::vector<uint64_t> stack_hash;
+				std::vector<uint8_t>  stack_position;
+				stack_hash.reserve(hash_array.size());
+				stack_position.reserve(hash_array.size());
+
+				while (!alone_queue.empty()) {
+					const uint64_t index = alone_queue.back();
+					alone_queue.pop_back();
+					if ((slot_count[index] >> 2) != 1) { continue; }
+
+					const uint64_t key_hash = slot_hash[index];
+					const uint8_t  position = slot_count[index] & 3;
+					stack_hash.push_back(key_hash);
+					stack_position.push_back(position);
+
+					uint64_t index_array[ARITY];
+					slot_indices(key_hash, index_array);
+					for (uint32_t j = 0; j < ARITY; ++j) {
+						const uint64_t other_index = index_array[j];
+						if (j == position) {
+							slot_count[other_index] = 0;
+							slot_hash[other_index]  = 0;
+							continue;
+						}
+						slot_count[other_index] = static_cast<uint8_t>((slot_count[other_index] - 4) ^ j);
+						slot_hash[other_index] ^= key_hash;
+						if ((slot_count[other_index] >> 2) == 1) { alone_queue.push_back(other_index); }
+					}
+				}
+
+				if (stack_hash.size() != hash_array.size()) { return false; }
+
+				// Each key sets its own slot last, after the other two slots are settled
+				for (size_t i = stack_hash.size(); i-- > 0;) {
+					const uint64_t key_hash = stack_hash[i];
+					const uint8_t  position = stack_position[i];
+
+					uint64_t index_array[ARITY];
+					slot_indices(key_hash, index_array);
+					fingerprint_array_[index_array[position]] = static_cast<Fingerprint>(
+					        fingerprint_of(key_hash)
+					        ^ fingerprint_array_[index_array[(position + 1) % ARITY]]
+					        ^ fingerprint_array_[index_array[(position + 2) % ARITY]]);
+				}
+				return true;
+			}
+		};
+
+	}
+
+}
+
+#endif//ALGORITHM_STRUCTURE_BINARY_FUSE_FILTER_H
@@ -0,0 +1,451 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_STRUCTURE_BLOCKED_BLOOM_FILTER_H
+#define ALGORITHM_STRUCTURE_BLOCKED_BLOOM_FILTER_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <immintrin.h>
+
+#include <memory/cache.h>
+#include <util/hash.h>
+#include <algorithm/simd/cpu_feature.h>
+#include <structure/map/bloom_filter.h>
+
+namespace algorithm::structure {
+
+	inline namespace bloom_filter {
+
+		namespace detail {
+
+			/// The amount of 32-bit words in a block, each of which takes at most one bit of a key
+			inline constexpr size_t BLOCK_WORD_AMOUNT = 16;
+
+			/// Odd multipliers picking the bit in each word from the same 32-bit hash
+			alignas(64) inline constexpr uint32_t BLOCK_SALT[BLOCK_WORD_AMOUNT] = {
+			        0x47B6137BU, 0x44974D91U, 0x8824AD5BU, 0xA2B7289DU,
+			        0x705495C7U, 0x2DF1424BU, 0x9EFC4947U, 0x5C6BFB31U,
+			        0xB823D5EBU, 0xC1191CDFU, 0xF623AEB3U, 0xDB58499FU,
+			        0xA91A5967U, 0xDA427D63U, 0x4909FEA3U, 0xA68CC6A7U
+			};
+
+			struct alignas(memory::CACHE_LINE_SIZE) Block {
+				uint32_t word_array[BLOCK_WORD_AMOUNT];
+			};
+
+			static_assert(sizeof(Block) == memory::CACHE_LINE_SIZE, "A block is expected to take a cache line");
+
+			namespace scalar {
+
+				inline void block_insert(Block &block, uint32_t hash, uint32_t hash_count) {
+					for (uint32_t idx = 0; idx < hash_count; ++idx) {
+						block.word_array[idx] |= 1U << ((hash * BLOCK_SALT[idx]) >> 27);
+					}
+				}
+
+				inline bool block_contains(const Block &block, uint32_t hash, uint32_t hash_count) {
+					uint32_t miss = 0;
+					for (uint32_t idx = 0; idx < hash_count; ++idx) {
+						const uint32_t bit = 1U << ((hash * BLOCK_SALT[idx]) >> 27);
+						miss |= ~block.word_array[idx] & bit;
+					}
+					return miss == 0;
+				}
+
+			}
+
+#pragma GCC push_options
+#pragma GCC target("avx2,bmi,bmi2,popcnt")
+
+			namespace avx2 {
+
+				/// Bits of a key in the two halves of a block, where words beyond hash_count are left empty
+				inline void block_mask(uint32_t hash, uint32_t hash_count, __m256i &low_mask, __m256i &high_mask) {
+					const __m256i hash_vec  = _mm256_set1_epi32(static_cast<int32_t>(hash));
+					const __m256i one_vec   = _mm256_set1_epi32(1);
+					const __m256i count_vec = _mm256_set1_epi32(static_cast<int32_t>(hash_count));
+					const __m256i low_idx   = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+					const __m256i high_idx  = _mm256_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15);
+
+					const __m256i low_shift  = _mm256_srli_epi32(
+					        _mm256_mullo_epi32(hash_vec, _mm256_load_si256(reinterpret_cast<const __m256i *>(BLOCK_SALT))), 27);
+					const __m256i high_shift = _mm256_srli_epi32(
+					        _mm256_mullo_epi32(hash_vec, _mm256_load_si256(reinterpret_cast<const __m256i *>(BLOCK_SALT + 8))), 27);
+
+					low_mask  = _mm256_and_si256(_mm256_sllv_epi32(one_vec, low_shift), _mm256_cmpgt_epi32(count_vec, low_idx));
+					high_mask = _mm256_and_si256(_mm256_sllv_epi32(one_vec, high_shift), _mm256_cmpgt_epi32(count_vec, high_idx));
+				}
+
+				inline void block_insert(Block &block, uint32_t hash, uint32_t hash_count) {
+					__m256i low_mask, high_mask;
+					block_mask(hash, hash_count, low_mask, high_mask);
+
+					auto *block_ptr = reinterpret_cast<__m256i *>(block.word_array);
+					_mm256_store_si256(block_ptr, _mm256_or_si256(_mm256_load_si256(block_ptr), low_mask));
+					_mm256_store_si256(block_ptr + 1, _mm256_or_si256(_mm256_load_si256(block_ptr + 1), high_mask));
+				}
+
+				inline bool block_contains(const Block &block, uint32_t hash, uint32_t hash_count) {
+					__m256i low_mask, high_mask;
+					block_mask(hash, hash_count, low_mask, high_mask);
+
+					const auto *block_ptr = reinterpret_cast<const __m256i *>(block.word_array);
+					// testc: all bits of mask are set in block
+					return _mm256_testc_si256(_mm256_load_si256(block_ptr), low_mask)
+					       & _mm256_testc_si256(_mm256_load_si256(block_ptr + 1), high_mask);
+				}
+
+			}
+
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512bw,avx512vl,avx512dq,avx2,bmi,bmi2,popcnt")
+
+			namespace avx512 {
+
+				inline __m512i block_mask(uint32_t hash, uint32_t hash_count) {
+					const __m512i hash_vec  = _mm512_set1_epi32(static_cast<int32_t>(hash));
+					const __m512i salt_vec  = _mm512_load_si512(BLOCK_SALT);
+					const __m512i shift_vec = _mm512_srli_epi32(_mm512_mullo_epi32(hash_vec, salt_vec), 27);
+					const __mmask16 word_mask = static_cast<__mmask16>(_bzhi_u32(0xFFFFU, hash_count));
+					return _mm512_maskz_sllv_epi32(word_mask, _mm512_set1_epi32(1), shift_vec);
+				}
+
+				inline void block_insert(Block &block, uint32_t hash, uint32_t hash_count) {
+					const __m512i mask = block_mask(hash, hash_count);
+					_mm512_store_si512(block.word_array, _mm512_or_si512(_mm512_load_si512(block.word_array), mask));
+				}
+
+				inline bool block_contains(const Block &block, uint32_t hash, uint32_t hash_count) {
+					const __m512i mask = block_mask(hash, hash_count);
+					const __m512i miss = _mm512_andnot_si512(_mm512_load_si512(block.word_array), mask);
+					return _mm512_test_epi32_mask(miss, miss) == 0;
+				}
+
+			}
+
+#pragma GCC pop_options
+
+			inline void block_insert(Block &block, uint32_t hash, uint32_t hash_count) {
+				switch (simd::get_isa()) {
+					case simd::ISA::AVX512: avx512::block_insert(block, hash, hash_count); break;
+					case simd::ISA::AVX2:   avx2::block_insert(block, hash, hash_count); break;
+					default:                scalar::block_insert(block, hash, hash_count); break;
+				}
+			}
+
+			inline bool block_contains(const Block &block, uint32_t hash, uint32_t hash_count) {
+				switch (simd::get_isa()) {
+					case simd::ISA::AVX512: return avx512::block_contains(block, hash, hash_count);
+					case simd::ISA::AVX2:   return avx2::block_contains(block, hash, hash_count);
+					default:                return scalar::block_contains(block, hash, hash_count);
+				}
+			}
+
+		}
+
+		/*!
+		 * @brief Bloom filter confining all bits of a key to a 512-bit block, i.e. a cache line.
+		 * A key is hashed once into 64 bits, of which the high part picks the block by multiplication
+		 * and the low part picks one bit in each of the first hash_count words of the block,
+		 * which are set or tested by a single vector operation. Hence insert and lookup cost one cache miss,
+		 * at the price of more bits than BloomFilter for the same false positive probability.
+		 */
+		class BlockedBloomFilter {
+		public:
+			using Block = detail::Block;
+
+			static constexpr uint32_t MAX_HASH_COUNT = detail::BLOCK_WORD_AMOUNT;
+
+			static constexpr uint64_t BLOCK_BITS = sizeof(Block) * bits_per_char;
+
+		private:
+			std::vector<Block> block_array_;
+			uint32_t hash_count_;
+			uint64_t inserted_element_count_;
+			uint64_t random_seed_;
+
+		public:
+			BlockedBloomFilter(): hash_count_(0), inserted_element_count_(0), random_seed_(0) {}
+
+			/*!
+			 * @brief Size the filter for the projected element count and false positive probability of parameter
+			 */
+			explicit BlockedBloomFilter(const BloomParameter &p): inserted_element_count_(0),
+			                                                      random_seed_((p.random_seed * 0xA5A5A5A5) + 1) {
+				uint64_t block_amount = 1;
+				hash_count_ = 1;
+				compute_optimal_parameters(p, block_amount, hash_count_);
+				block_array_.resize(block_amount);
+			}
+
+			BlockedBloomFilter(uint64_t block_amount, uint32_t hash_count, uint64_t random_seed = BloomParameter::random_seed):
+			        block_array_(std::max<uint64_t>(block_amount, 1)),
+			        hash_count_(std::clamp<uint32_t>(hash_count, 1, MAX_HASH_COUNT)),
+			        inserted_element_count_(0),
+			        random_seed_((random_seed * 0xA5A5A5A5) + 1) {}
+
+		public:
+			bool operator==(const BlockedBloomFilter &f) const {
+				return (hash_count_ == f.hash_count_) &&
+				       (inserted_element_count_ == f.inserted_element_count_) &&
+				       (random_seed_ == f.random_seed_) &&
+				       (block_array_.size() == f.block_array_.size()) &&
+				       std::equal(block_array_.begin(), block_array_.end(), f.block_array_.begin(), [](const Block &a, const Block &b) {
+					       return std::memcmp(a.word_array, b.word_array, sizeof(Block)) == 0;
+				       });
+			}
+
+		public:
+			void insert(const uint8_t *key_begin, size_t length) {
+				insert_hash(util::hash64(key_begin, length, random_seed_));
+			}
+
+			template<typename T>
+				requires std::is_trivially_copyable_v<T>
+			void insert(const T &t) {
+				insert(reinterpret_cast<const uint8_t *>(&t), sizeof(T));
+			}
+
+			void insert(std::string_view key) {
+				insert(reinterpret_cast<const uint8_t *>(key.data()), key.size());
+			}
+
+			void insert(const char *data, size_t length) {
+				insert(reinterpret_cast<const uint8_t *>(data), length);
+			}
+
+			template<typename InputIterator>
+			void insert(const InputIterator begin, const InputIterator end) {
+				for (InputIterator itr = begin; itr != end; ++itr) {
+					insert(*itr);
+				}
+			}
+
+			/*!
+			 * @brief Insert keys a window at a time, where blocks of the whole window are prefetched before any update
+			 */
+			template<typename T>
+			void insert_batch(std::span<const T> keys) {
+				uint64_t hash_array[BATCH_WINDOW];
+				for (size_t window_start = 0; window_start < keys.size(); window_start += BATCH_WINDOW) {
+					const size_t window_size = std::min(BATCH_WINDOW, keys.size() - window_start);
+					locate_batch<1>(keys.subspan(window_start, window_size), hash_array);
+
+					for (size_t i = 0; i < window_size; ++i) {
+						detail::block_insert(block_array_[block_index(hash_array[i])], static_cast<uint32_t>(hash_array[i]), hash_count_);
+					}
+				}
+				inserted_element_count_ += keys.size();
+			}
+
+			/*!
+			 * @brief Insert a key hashed by the caller, which should be mixed well in all 64 bits
+			 */
+			void insert_hash(uint64_t key_hash) {
+				detail::block_insert(block_array_[block_index(key_hash)], static_cast<uint32_t>(key_hash), hash_count_);
+				++inserted_element_count_;
+			}
+
+		public:
+			bool contains(const uint8_t *key_begin, size_t length) const {
+				return contains_hash(util::hash64(key_begin, length, random_seed_));
+			}
+
+			template<typename T>
+				requires std::is_trivially_copyable_v<T>
+			bool contains(const T &t) const {
+				return contains(reinterpret_cast<const uint8_t *>(&t), sizeof(T));
+			}
+
+			bool contains(std::string_view key) const {
+				return contains(reinterpret_cast<const uint8_t *>(key.data()), key.size());
+			}
+
+			bool contains(const char *data, size_t length) const {
+				return contains(reinterpret_cast<const uint8_t *>(data), length);
+			}
+
+			bool contains_hash(uint64_t key_hash) const {
+				return detail::block_contains(block_array_[block_index(key_hash)], static_cast<uint32_t>(key_hash), hash_count_);
+			}
+
+			/*!
+			 * @brief Look up keys a window at a time, where blocks of the whole window are prefetched before any test
+			 * @param bitmap_ptr Bitmap of at least (keys.size() + 63) / 64 words, with bit i set if key i may be contained
+			 * @return The amount of keys which may be contained
+			 */
+			template<typename T>
+			size_t contains_batch(std::span<const T> keys, uint64_t *bitmap_ptr) const {
+				uint64_t hash_array[BATCH_WINDOW];
+				std::fill(bitmap_ptr, bitmap_ptr + (keys.size() + 63) / 64, 0);
+
+				size_t positive_amount = 0;
+				for (size_t window_start = 0; window_start < keys.size(); window_start += BATCH_WINDOW) {
+					const size_t window_size = std::min(BATCH_WINDOW, keys.size() - window_start);
+					locate_batch<0>(keys.subspan(window_start, window_size), hash_array);
+
+					for (size_t i = 0; i < window_size; ++i) {
+						const size_t key_idx = window_start + i;
+						if (contains_hash(hash_array[i])) {
+							bitmap_ptr[key_idx / 64] |= 1ULL << (key_idx % 64);
+							++positive_amount;
+						}
+					}
+				}
+				return positive_amount;
+			}
+
+			template<typename InputIterator>
+			InputIterator contains_all(const InputIterator begin, const InputIterator end) const {
+				for (InputIterator itr = begin; itr != end; ++itr) {
+					if (!contains(*itr)) { return itr; }
+				}
+				return end;
+			}
+
+			template<typename InputIterator>
+			InputIterator contains_none(const InputIterator begin, const InputIterator end) const {
+				for (InputIterator itr = begin; itr != end; ++itr) {
+					if (contains(*itr)) { return itr; }
+				}
+				return end;
+			}
+
+		public:
+			bool valid() const {
+				return !block_array_.empty();
+			}
+
+			void clear() {
+				std::fill(block_array_.begin(), block_array_.end(), Block{});
+				inserted_element_count_ = 0;
+			}
+
+			/*!
+			 * @brief The amount of bits in the table
+			 */
+			uint64_t size() const {
+				return block_array_.size() * BLOCK_BITS;
+			}
+
+			uint64_t block_count() const {
+				return block_array_.size();
+			}
+
+			uint64_t element_count() const {
+				return inserted_element_count_;
+			}
+
+			uint32_t hash_count() const {
+				return hash_count_;
+			}
+
+			/*!
+			 * @brief The false positive probability with the current number of inserted elements,
+			 * taking the uneven load of blocks into account.
+			 */
+			double effective_fpp() const {
+				if (block_array_.empty()) { return 1.0; }
+				return block_fpp(static_cast<double>(inserted_element_count_) / block_array_.size(), hash_count_);
+			}
+
+			const Block *table() const {
+				return block_array_.data();
+			}
+
+		public:
+			/*!
+			 * @brief The false positive probability of blocks loaded with load elements on average.
+			 * Loads of blocks follow the Poisson distribution, and a block with i elements has a bit
+			 * of each word set with probability 1 - (31/32)^i.
+			 */
+			static double block_fpp(double load, uint32_t hash_count) {
+				if (load <= 0.0) { return 0.0; }
+
+				const double deviation = std::sqrt(load);
+				const auto   lower     = static_cast<uint64_t>(std::max(0.0, load - 12.0 * deviation - 16.0));
+				const auto   upper     = static_cast<uint64_t>(load + 12.0 * deviation + 16.0);
+
+				const double word_bits = 32.0;
+				double fpp = 0.0;
+				for (uint64_t i = lower; i <= upper; ++i) {
+					const double probability = std::exp(i * std::log(load) - load - std::lgamma(i + 1.0));
+					const double bit_ratio   = 1.0 - std::pow(1.0 - 1.0 / word_bits, static_cast<double>(i));
+					fpp += probability * std::pow(bit_ratio, static_cast<double>(hash_count));
+				}
+				return std::min(fpp, 1.0);
+			}
+
+			/*!
+			 * @brief Find the least amount of blocks, and the amount of hashes for it,
+			 * to keep the false positive probability of the projected element count within that of parameter.
+			 * @return false if parameter is invalid, where the output is left untouched
+			 */
+			static bool compute_optimal_parameters(const BloomParameter &p, uint64_t &block_amount, uint32_t &hash_count) {
+				if (!p.valid()) { return false; }
+
+				const auto   element_count = static_cast<double>(p.projected_element_count);
+				const double target_fpp    = p.false_positive_probability;
+
+				uint64_t best_block_amount = std::numeric_limits<uint64_t>::max();
+				uint32_t best_hash_count   = 1;
+				for (uint32_t k = 1; k <= MAX_HASH_COUNT; ++k) {
+					// Exponential search for an upper bound, then binary search for the least block amount
+					uint64_t upper = 1;
+					while (upper < (1ULL << 58) && block_fpp(element_count / upper, k) > target_fpp) { upper <<= 1; }
+					uint64_t lower = upper / 2 + 1;
+					while (lower < upper) {
+						const uint64_t mid = lower + (upper - lower) / 2;
+						if (block_fpp(element_count / mid, k) > target_fpp) { lower = mid + 1; }
+						else { upper = mid; }
+					}
+					if (upper < best_block_amount) {
+						best_block_amount = upper;
+						best_hash_count   = k;
+					}
+				}
+
+				block_amount = best_block_amount;
+				hash_count   = best_hash_count;
+				return true;
+			}
+
+		private:
+			/*!
+			 * @brief Hash keys into hash_array and prefetch their blocks for reading (RW = 0) or writing (RW = 1)
+			 */
+			template<int RW, typename T>
+			void locate_batch(std::span<const T> keys, uint64_t *hash_array) const {
+				for (size_t i = 0; i < keys.size(); ++i) {
+					const std::span<const uint8_t> bytes = key_bytes(keys[i]);
+					hash_array[i] = util::hash64(bytes.data(), bytes.size(), random_seed_);
+					__builtin_prefetch(block_array_.data() + block_index(hash_array[i]), RW, 1);
+				}
+			}
+
+			/// Map hash to a block by multiplication instead of modulo, which is led by the high 32 bits not used in blocks
+			uint64_t block_index(uint64_t key_hash) const {
+				return util::fast_range(key_hash, block_array_.size());
+			}
+		};
+
+	}
+
+}
+
+#endif//ALGORITHM_STRUCTURE_BLOCKED_BLOOM_FILTER_H
@@ -11,12 +11,22 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <span>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
+#include <util/hash.h>
+#include <file/file_descriptor.h>
+#include <logger/logger.h>
+
 
 namespace algorithm::structure {
 	
@@ -35,6 +45,62 @@ namespace algorithm::structure {
 		        0x80   //10000000
 		};
 
+		/// The amount of keys hashed and prefetched ahead of probing in batch operations
+		inline constexpr size_t BATCH_WINDOW = 32;
+
+		/*!
+		 * @brief Bytes of a key, which are the characters of strings, or the object representation otherwise
+		 */
+		template<typename T>
+		inline std::span<const uint8_t> key_bytes(const T &key) {
+			if constexpr (std::is_convertible_v<const T &, std::string_view>) {
+				const std::string_view key_view = key;
+				return {reinterpret_cast<const uint8_t *>(key_view.data()), key_view.size()};
+			}
+			else {
+				static_assert(std::is_trivially_copyable_v<T>, "Keys are expected to be strings or trivially copyable");
+				return {reinterpret_cast<const uint8_t *>(&key), sizeof(T)};
+			}
+		}
+
+		/*!
+		 * @brief The i-th index of a key in a table of table_size, which is the hashing core shared by filters:
+		 * a key is hashed once, and indices are derived by double hashing and mapped by multiplication.
+		 */
+		inline uint64_t bloom_index(const util::Hash128 &hash, uint32_t i, uint64_t table_size) {
+			return util::fast_range(util::double_hash(hash, i), table_size);
+		}
+
+		/// Magic number leading files of Bloom filters, i.e. "BLOOMFLT" in little endian
+		inline constexpr uint64_t BLOOM_FILE_MAGIC = 0x544C464D4F4F4C42ULL;
+
+		/// Version of the file format, bumped on any change of the layout or of the index derivation
+		inline constexpr uint32_t BLOOM_FILE_VERSION = 1;
+
+		/*!
+		 * @brief Header of a Bloom filter file, followed by the bit table at table_offset, which is aligned to the page
+		 * so that the table can be mapped and used in place.
+		 */
+		struct BloomFileHeader {
+			uint64_t magic;
+			uint32_t version;
+			uint32_t hash_count;
+			uint64_t table_size;
+			uint64_t table_offset;
+			uint64_t projected_element_count;
+			uint64_t inserted_element_count;
+			uint64_t random_seed;
+			double   desired_false_positive_probability;
+			/// Hash of a fixed probe, which rejects files written with another hasher
+			uint64_t hasher_check;
+			uint64_t table_checksum;
+			/// Checksum of all fields above
+			uint64_t header_checksum;
+		};
+
+		static_assert(std::is_trivially_copyable_v<BloomFileHeader> && sizeof(BloomFileHeader) == 88,
+		              "The header is expected to be written as is, without padding");
+
 		class BloomParameter {
 		public:
 			// Allowable min/max size of the bloom filter in bits
@@ -77,10 +143,10 @@ namespace algorithm::structure {
 			~BloomParameter() =default;
 
 		public:
-			inline bool valid() {
-				return (0 == projected_element_count) ||
-				       (false_positive_probability < 0.0) ||
-				       (std::numeric_limits<double>::infinity() == std::abs(false_positive_probability));
+			inline bool valid() const {
+				return (0 != projected_element_count) &&
+				       (false_positive_probability > 0.0) &&
+				       (false_positive_probability < 1.0);
 			}
 
 		public:
@@ -138,14 +204,18 @@ namespace algorithm::structure {
 			}
 		};
 
+		/*!
+		 * @brief Bloom filter hashing each key once into 128 bits, from which all indices are derived
+		 * by Kirsch–Mitzenmacher double hashing. Indices take 64 bits, so that tables may exceed 2^32 bits.
+		 */
+		template<util::HasherConcept Hasher = util::FastHasher>
 		class BloomFilter {
 		public:
-			using bloom_type = uint32_t;
+			using hasher_type = Hasher;
 			using cell_type = uint8_t;
 			using table_type = std::vector<uint8_t>;
 
 		public:
-			std::vector<bloom_type> salt_;
 			std::vector<uint8_t> bit_table_;
 			uint32_t salt_count_;
 			uint64_t table_size_;
@@ -153,6 +223,9 @@ namespace algorithm::structure {
 			uint64_t inserted_element_count_;
 			uint64_t random_seed_;
 			double desired_false_positive_probability_;
+			/// Mapping of the file which the table is read from in place of bit_table_, shared by copies
+			std::shared_ptr<const file::FileMapper> table_mapper_;
+			const cell_type *mapped_table_ = nullptr;
 
 		public:
 			BloomFilter() : salt_count_(0),
@@ -168,8 +241,6 @@ namespace algorithm::structure {
 			                                       inserted_element_count_(0),
 			                                       random_seed_((p.random_seed * 0xA5A5A5A5) + 1),
 			                                       desired_false_positive_probability_(p.false_positive_probability) {
-				generate_unique_salt();
-
 				bit_table_.resize(table_size_ / bits_per_char, static_cast<uint8_t>(0x00));
 			}
 
@@ -181,13 +252,12 @@ namespace algorithm::structure {
 			bool operator ==(const BloomFilter &f) const {
 				return  (salt_count_ == f.salt_count_) &&
 				       (table_size_ == f.table_size_) &&
-				       (bit_table_.size() == f.bit_table_.size()) &&
+				       (table_bytes() == f.table_bytes()) &&
 				       (projected_element_count_ == f.projected_element_count_) &&
 				       (inserted_element_count_ == f.inserted_element_count_) &&
 				       (random_seed_ == f.random_seed_) &&
 				       (desired_false_positive_probability_ == f.desired_false_positive_probability_) &&
-				       (salt_ == f.salt_) &&
-				       (bit_table_ == f.bit_table_);
+				       std::equal(table(), table() + table_bytes(), f.table());
 			}
 
 			bool operator !=(const BloomFilter &f) const {
@@ -198,11 +268,12 @@ namespace algorithm::structure {
 				salt_count_                         = f.salt_count_;
 				table_size_                         = f.table_size_;
 				bit_table_                          = f.bit_table_;
-				salt_                               = f.salt_;
 				projected_element_count_            = f.projected_element_count_;
 				inserted_element_count_             = f.inserted_element_count_;
 				random_seed_                        = f.random_seed_;
 				desired_false_positive_probability_ = f.desired_false_positive_probability_;
+				table_mapper_                       = f.table_mapper_;
+				mapped_table_                       = f.mapped_table_;
 
 				return *this;
 			}
@@ -215,8 +286,9 @@ namespace algorithm::structure {
 				        (table_size_ == f.table_size_) &&
 				        (random_seed_ == f.random_seed_)
 				) {
+					own_table();
 					for (size_t i = 0; i < bit_table_.size(); ++i) {
-						bit_table_[i] &= f.bit_table_[i];
+						bit_table_[i] &= f.table()[i];
 					}
 				}
 
@@ -230,8 +302,9 @@ namespace algorithm::structure {
 				        (table_size_ == f.table_size_) &&
 				        (random_seed_ == f.random_seed_)
 				) {
+					own_table();
 					for (size_t i = 0; i < bit_table_.size(); ++i) {
-						bit_table_[i] |= f.bit_table_[i];
+						bit_table_[i] |= f.table()[i];
 					}
 				}
 
@@ -245,8 +318,9 @@ namespace algorithm::structure {
 				        (table_size_ == f.table_size_) &&
 				        (random_seed_ == f.random_seed_)
 				) {
+					own_table();
 					for (size_t i = 0; i < bit_table_.size(); ++i) {
-						bit_table_[i] ^= f.bit_table_[i];
+						bit_table_[i] ^= f.table()[i];
 					}
 				}
 
@@ -273,11 +347,19 @@ namespace algorithm::structure {
 
 		public:
 			inline void insert(const uint8_t *key_begin, const size_t &length) {
+				insert_hash(Hasher::hash(key_begin, length, random_seed_));
+			}
+
+			/*!
+			 * @brief Insert a key hashed by Hasher with the seed of this filter
+			 */
+			inline void insert_hash(const util::Hash128 &hash) {
 				size_t bit_index = 0;
 				size_t bit = 0;
 
-				for (size_t i = 0; i < salt_.size(); ++i) {
-					compute_indices(hash_ap(key_begin, length, salt_[i]), bit_index, bit);
+				own_table();
+				for (uint32_t i = 0; i < salt_count_; ++i) {
+					compute_indices(hash, i, bit_index, bit);
 					bit_table_[bit_index / bits_per_char] |= bit_mask[bit];
 				}
 				++inserted_element_count_;
@@ -285,8 +367,8 @@ namespace algorithm::structure {
 
 			template<typename T>
 			inline void insert(const T &t) {
-				// Note: T must be a C++ POD type.
-				insert(reinterpret_cast<const uint8_t *>(&t), sizeof(T));
+				const std::span<const uint8_t> bytes = key_bytes(t);
+				insert(bytes.data(), bytes.size());
 			}
 
 			inline void insert(std::string_view key) {
@@ -304,15 +386,41 @@ namespace algorithm::structure {
 				}
 			}
 
+			/*!
+			 * @brief Insert keys a window at a time, where bits of the whole window are located and prefetched
+			 * before any of them is set, so that cache misses of a window overlap.
+			 */
+			template<typename T>
+			void insert_batch(std::span<const T> keys) {
+				std::vector<size_t> bit_index_array(BATCH_WINDOW * salt_count_);
+
+				own_table();
+				for (size_t window_start = 0; window_start < keys.size(); window_start += BATCH_WINDOW) {
+					const size_t window_size = std::min(BATCH_WINDOW, keys.size() - window_start);
+					locate_batch<1>(keys.subspan(window_start, window_size), bit_index_array);
+
+					for (size_t i = 0; i < window_size * salt_count_; ++i) {
+						const size_t bit_index = bit_index_array[i];
+						bit_table_[bit_index / bits_per_char] |= bit_mask[bit_index % bits_per_char];
+					}
+				}
+				inserted_element_count_ += keys.size();
+			}
+
 		public:
 			bool contains(const uint8_t *key_begin, const size_t length) const {
+				return contains_hash(Hasher::hash(key_begin, length, random_seed_));
+			}
+
+			bool contains_hash(const util::Hash128 &hash) const {
 				size_t bit_index = 0;
 				size_t bit = 0;
 
-				for (size_t i = 0; i < salt_.size(); ++i) {
-					compute_indices(hash_ap(key_begin, length, salt_[i]), bit_index, bit);
+				const cell_type *table_ptr = table();
+				for (uint32_t i = 0; i < salt_count_; ++i) {
+					compute_indices(hash, i, bit_index, bit);
 
-					if ((bit_table_[bit_index / bits_per_char] & bit_mask[bit]) != bit_mask[bit]) {
+					if ((table_ptr[bit_index / bits_per_char] & bit_mask[bit]) != bit_mask[bit]) {
 						return false;
 					}
 				}
@@ -322,7 +430,8 @@ namespace algorithm::structure {
 
 			template<typename T>
 			bool contains(const T &t) const {
-				return contains(reinterpret_cast<const uint8_t *>(&t), static_cast<size_t>(sizeof(T)));
+				const std::span<const uint8_t> bytes = key_bytes(t);
+				return contains(bytes.data(), bytes.size());
 			}
 
 			bool contains(std::string_view key) const {
@@ -349,12 +458,46 @@ namespace algorithm::structure {
 				return end;
 			}
 
+			/*!
+			 * @brief Look up keys a window at a time, where bits of the whole window are located and prefetched
+			 * before any of them is tested, so that cache misses of a window overlap.
+			 * @param bitmap_ptr Bitmap of at least (keys.size() + 63) / 64 words, with bit i set if key i may be contained
+			 * @return The amount of keys which may be contained
+			 */
+			template<typename T>
+			size_t contains_batch(std::span<const T> keys, uint64_t *bitmap_ptr) const {
+				std::vector<size_t> bit_index_array(BATCH_WINDOW * salt_count_);
+				std::fill(bitmap_ptr, bitmap_ptr + (keys.size() + 63) / 64, 0);
+
+				const cell_type *table_ptr = table();
+				size_t positive_amount = 0;
+				for (size_t window_start = 0; window_start < keys.size(); window_start += BATCH_WINDOW) {
+					const size_t window_size = std::min(BATCH_WINDOW, keys.size() - window_start);
+					locate_batch<0>(keys.subspan(window_start, window_size), bit_index_array);
+
+					const size_t *index_ptr = bit_index_array.data();
+					for (size_t key_idx = window_start; key_idx < window_start + window_size; ++key_idx) {
+						uint8_t miss = 0;
+						for (uint32_t i = 0; i < salt_count_; ++i, ++index_ptr) {
+							const size_t bit_index = *index_ptr;
+							miss |= ~table_ptr[bit_index / bits_per_char] & bit_mask[bit_index % bits_per_char];
+						}
+						if (miss == 0) {
+							bitmap_ptr[key_idx / 64] |= 1ULL << (key_idx % 64);
+							++positive_amount;
+						}
+					}
+				}
+				return positive_amount;
+			}
+
 		public:
 			bool valid() const {
-				return table_size_ == 0;
+				return table_size_ != 0;
 			}
 
 			void clear() {
+				own_table();
 				std::fill(bit_table_.begin(), bit_table_.end(), static_cast<uint8_t>(0x00));
 				inserted_element_count_ = 0;
 			}
@@ -375,164 +518,204 @@ namespace algorithm::structure {
 				  the current number of inserted elements - not the user defined
 				  predicated/expected number of inserted elements.
 				*/
-				return std::pow(1.0 - std::exp(-1.0 * salt_.size() * inserted_element_count_ / size()), 1.0 * salt_.size());
+				return std::pow(1.0 - std::exp(-1.0 * salt_count_ * inserted_element_count_ / size()), 1.0 * salt_count_);
 			}
 
 			const cell_type *table() const {
-				return bit_table_.data();
+				return mapped_table_ != nullptr ? mapped_table_ : bit_table_.data();
 			}
 
-			size_t hash_count() {
-				return salt_.size();
+			size_t table_bytes() const {
+				return mapped_table_ != nullptr ? table_size_ / bits_per_char : bit_table_.size();
 			}
 
-		protected:
+			/*!
+			 * @brief Whether the table is read from a mapped file, until the filter is modified
+			 */
+			bool is_mapped() const {
+				return mapped_table_ != nullptr;
+			}
 
-			inline virtual void compute_indices(const bloom_type &hash, size_t &bit_index, size_t &bit) const {
-				bit_index = hash % table_size_;
-				bit = bit_index % bits_per_char;
+			size_t hash_count() const {
+				return salt_count_;
 			}
 
-			void generate_unique_salt() {
-				/*
-				  Note:
-				  A distinct hash function need not be implementation-wise
-				  distinct. In the current implementation "seeding" a common
-				  hash function with different values seems to be adequate.
-				*/
-				constexpr uint32_t predef_salt_count = 128;
-
-				static constexpr bloom_type predef_salt[predef_salt_count] = {
-	                0xAAAAAAAA, 0x55555555, 0x33333333, 0xCCCCCCCC,
-	                0x66666666, 0x99999999, 0xB5B5B5B5, 0x4B4B4B4B,
-	                0xAA55AA55, 0x55335533, 0x33CC33CC, 0xCC66CC66,
-	                0x66996699, 0x99B599B5, 0xB54BB54B, 0x4BAA4BAA,
-	                0xAA33AA33, 0x55CC55CC, 0x33663366, 0xCC99CC99,
-	                0x66B566B5, 0x994B994B, 0xB5AAB5AA, 0xAAAAAA33,
-	                0x555555CC, 0x33333366, 0xCCCCCC99, 0x666666B5,
-	                0x9999994B, 0xB5B5B5AA, 0xFFFFFFFF, 0xFFFF0000,
-	                0xB823D5EB, 0xC1191CDF, 0xF623AEB3, 0xDB58499F,
-	                0xC8D42E70, 0xB173F616, 0xA91A5967, 0xDA427D63,
-	                0xB1E8A2EA, 0xF6C0D155, 0x4909FEA3, 0xA68CC6A7,
-	                0xC395E782, 0xA26057EB, 0x0CD5DA28, 0x467C5492,
-	                0xF15E6982, 0x61C6FAD3, 0x9615E352, 0x6E9E355A,
-	                0x689B563E, 0x0C9831A8, 0x6753C18B, 0xA622689B,
-	                0x8CA63C47, 0x42CC2884, 0x8E89919B, 0x6EDBD7D3,
-	                0x15B6796C, 0x1D6FDFE4, 0x63FF9092, 0xE7401432,
-	                0xEFFE9412, 0xAEAEDF79, 0x9F245A31, 0x83C136FC,
-	                0xC3DA4A8C, 0xA5112C8C, 0x5271F491, 0x9A948DAB,
-	                0xCEE59A8D, 0xB5F525AB, 0x59D13217, 0x24E7C331,
-	                0x697C2103, 0x84B0A460, 0x86156DA9, 0xAEF2AC68,
-	                0x23243DA5, 0x3F649643, 0x5FA495A8, 0x67710DF8,
-	                0x9A6C499E, 0xDCFB0227, 0x46A43433, 0x1832B07A,
-	                0xC46AFF3C, 0xB9C8FFF0, 0xC9500467, 0x34431BDF,
-	                0xB652432B, 0xE367F12B, 0x427F4C1B, 0x224C006E,
-	                0x2E7E5A89, 0x96F99AA5, 0x0BEB452A, 0x2FD87C39,
-	                0x74B2E1FB, 0x222EFD24, 0xF357F60C, 0x440FCB1E,
-	                0x8BBE030F, 0x6704DC29, 0x1144D12F, 0x948B1355,
-	                0x6D8FD7E9, 0x1C11A014, 0xADD1592F, 0xFB3C712E,
-	                0xFC77642F, 0xF9C4CE8C, 0x31312FB9, 0x08B0DD79,
-	                0x318FA6E7, 0xC040D23D, 0xC0589AA7, 0x0CA5C075,
-	                0xF874B172, 0x0CF914D5, 0x784D3280, 0x4E8CFEBC,
-	                0xC569F575, 0xCDB2A091, 0x2CC016B4, 0x5C5F4421
-		        };
-
-				if (salt_count_ <= predef_salt_count) {
-					std::copy( predef_salt, predef_salt + salt_count_, std::back_inserter(salt_));
-
-					for (size_t i = 0; i < salt_.size(); ++i) {
-						/*
-						   Note:
-						   This is done to integrate the user defined random seed,
-						   so as to allow for the generation of unique bloom filter
-						   instances.
-						*/
-						salt_[i] = salt_[i] * salt_[(i + 3) % salt_.size()] + static_cast<bloom_type>(random_seed_);
-					}
+		public:
+			/*!
+			 * @brief Write the filter to file_path as a BloomFileHeader followed by the page-aligned table.
+			 * The file is written aside and renamed into place, so that processes mapping the old one are not affected.
+			 * Only filters indexed by bloom_index are supported, as open_mapped() loads the table as a BloomFilter.
+			 */
+			bool save(std::string_view file_path) const {
+				if (!valid() || !bloom_indexed() || table_bytes() * bits_per_char != table_size_) {
+					util::logger::logger_error("Fail to save bloom filter, which is invalid or indexed otherwise: ", file_path);
+					return false;
 				}
-				else {
-					std::copy(predef_salt, predef_salt + predef_salt_count, std::back_inserter(salt_));
-
-					srand(static_cast<uint32_t>(random_seed_));
 
-					while (salt_.size() < salt_count_) {
-						bloom_type current_salt = static_cast<bloom_type>(rand()) * static_cast<bloom_type>(rand());
-
-						if (current_salt == 0) { continue; }
+				const auto page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+
+				BloomFileHeader header{};
+				header.magic                              = BLOOM_FILE_MAGIC;
+				header.version                            = BLOOM_FILE_VERSION;
+				header.hash_count                         = salt_count_;
+				header.table_size                         = table_size_;
+				header.table_offset                       = (sizeof(BloomFileHeader) + page_size - 1) / page_size * page_size;
+				header.projected_element_count            = projected_element_count_;
+				header.inserted_element_count             = inserted_element_count_;
+				header.random_seed                        = random_seed_;
+				header.desired_false_positive_probability = desired_false_positive_probability_;
+				header.hasher_check                       = hasher_check(random_seed_);
+				header.table_checksum                     = util::hash64(table(), table_bytes());
+				header.header_checksum                    = util::hash64(&header, offsetof(BloomFileHeader, header_checksum));
+
+				const std::string temp_path = std::string(file_path) + ".tmp";
+				{
+					file::FileDescriptor descriptor(temp_path, file::FileOpenType::ReadWrite | file::FileOpenType::Create | file::FileOpenType::Truncate);
+					if (!descriptor.is_open() || !descriptor.resize(header.table_offset + table_bytes())) { return false; }
+
+					const file::FileMapper mapper = descriptor.get_mapper(file::FileMmapProt::Readable | file::FileMmapProt::Writable, file::FileMmapFlag::Shared);
+					if (!mapper.is_mapped()) { return false; }
+
+					std::memcpy(mapper.get_map_area().data(), &header, sizeof(BloomFileHeader));
+					std::memcpy(mapper.get_map_area().data() + header.table_offset, table(), table_bytes());
+					if (!mapper.sync()) { return false; }
+				}
 
-						if (salt_.end() == std::find(salt_.begin(), salt_.end(), current_salt)) {
-							salt_.push_back(current_salt);
-						}
-					}
+				if (std::rename(temp_path.c_str(), std::string(file_path).c_str()) != 0) {
+					util::logger::logger_error("Fail to rename file: ", temp_path);
+					util::logger::logger_error(std::strerror(errno));
+					return false;
 				}
+				return true;
 			}
 
-			inline bloom_type hash_ap(const uint8_t *begin, size_t remaining_length, bloom_type hash) const {
-				const uint8_t *itr = begin;
-				uint32_t loop = 0;
-
-				while (remaining_length >= 8) {
-					const uint32_t &i1 = *(reinterpret_cast<const uint32_t *>(itr));
-					itr += sizeof(uint32_t);
-					const uint32_t &i2 = *(reinterpret_cast<const uint32_t *>(itr));
-					itr += sizeof(uint32_t);
-
-					hash ^= (hash << 7) ^ i1 * (hash >> 3) ^
-					        (~((hash << 11) + (i2 ^ (hash >> 5))));
-
-					remaining_length -= 8;
+			/*!
+			 * @brief Map a file written by save() read-only and use its table in place, without copying it.
+			 * Pages are shared with other processes mapping the same file, and the table is copied on the first modification.
+			 * @param verify_table Whether to check the table against its checksum, which reads the whole table
+			 * @return An invalid filter if the file is malformed or written with another hasher
+			 */
+			static BloomFilter open_mapped(std::string_view file_path, bool verify_table = true) {
+				BloomFilter filter;
+
+				const file::FileDescriptor descriptor(file_path, file::FileOpenType::ReadOnly);
+				if (!descriptor.is_open()) { return filter; }
+				if (descriptor.get_size() < sizeof(BloomFileHeader)) {
+					util::logger::logger_error("Fail to open bloom filter, which is truncated: ", file_path);
+					return filter;
 				}
 
-				if (remaining_length) {
-					if (remaining_length >= 4) {
-						const uint32_t &i = *(reinterpret_cast<const uint32_t *>(itr));
-
-						if (loop & 0x01) {
-							hash ^= (hash << 7) ^ i * (hash >> 3);
-						}
-						else {
-							hash ^= (~((hash << 11) + (i ^ (hash >> 5))));
-						}
-
-						++loop;
-
-						remaining_length -= 4;
-
-						itr += sizeof(uint32_t);
-					}
-
-					if (remaining_length >= 2) {
-						const unsigned short &i = *(reinterpret_cast<const unsigned short *>(itr));
-
-						if (loop & 0x01) {
-							hash ^= (hash << 7) ^ i * (hash >> 3);
-						}
-						else {
-							hash ^= (~((hash << 11) + (i ^ (hash >> 5))));
-						}
-
-						++loop;
+				auto mapper = std::make_shared<const file::FileMapper>(descriptor.get_mapper(file::FileMmapProt::Readable, file::FileMmapFlag::Shared));
+				if (!mapper->is_mapped()) { return filter; }
+
+				const std::span<uint8_t> map_area = mapper->get_map_area();
+				BloomFileHeader header;
+				std::memcpy(&header, map_area.data(), sizeof(BloomFileHeader));
+
+				const uint64_t table_bytes = header.table_size / bits_per_char;
+				const bool header_valid = header.magic == BLOOM_FILE_MAGIC
+				                          && header.version == BLOOM_FILE_VERSION
+				                          && header.header_checksum == util::hash64(&header, offsetof(BloomFileHeader, header_checksum))
+				                          && header.hash_count != 0
+				                          && header.table_size != 0 && header.table_size % bits_per_char == 0
+				                          && header.table_offset >= sizeof(BloomFileHeader)
+				                          && header.table_offset <= map_area.size()
+				                          && table_bytes <= map_area.size() - header.table_offset;
+				if (!header_valid) {
+					util::logger::logger_error("Fail to open bloom filter, whose header is malformed: ", file_path);
+					return filter;
+				}
+				if (header.hasher_check != hasher_check(header.random_seed)) {
+					util::logger::logger_error("Fail to open bloom filter, which is written with another hasher: ", file_path);
+					return filter;
+				}
 
-						remaining_length -= 2;
+				const cell_type *table_ptr = map_area.data() + header.table_offset;
+				if (verify_table && header.table_checksum != util::hash64(table_ptr, table_bytes)) {
+					util::logger::logger_error("Fail to open bloom filter, whose table is corrupted: ", file_path);
+					return filter;
+				}
+				// Lookups touch pages at random, where readahead only wastes the page cache
+				mapper->advise(file::FileMmapAdvice::Random, header.table_offset);
 
-						itr += sizeof(unsigned short);
-					}
+				filter.salt_count_                         = header.hash_count;
+				filter.table_size_                         = header.table_size;
+				filter.projected_element_count_            = header.projected_element_count;
+				filter.inserted_element_count_             = header.inserted_element_count;
+				filter.random_seed_                        = header.random_seed;
+				filter.desired_false_positive_probability_ = header.desired_false_positive_probability;
+				filter.table_mapper_                       = std::move(mapper);
+				filter.mapped_table_                       = table_ptr;
+				return filter;
+			}
 
-					if (remaining_length) {
-						hash += ((*itr) ^ (hash * 0xA5A5A5A5)) + loop;
+		protected:
+			/*!
+			 * @brief Copy the mapped table into bit_table_ before modification, and drop the mapping
+			 */
+			void own_table() {
+				if (mapped_table_ == nullptr) { return; }
+
+				bit_table_.assign(mapped_table_, mapped_table_ + table_size_ / bits_per_char);
+				mapped_table_ = nullptr;
+				table_mapper_.reset();
+			}
+
+			static uint64_t hasher_check(uint64_t random_seed) {
+				static constexpr char probe[] = "BloomFilter";
+				return Hasher::hash(reinterpret_cast<const uint8_t *>(probe), sizeof(probe) - 1, random_seed).low;
+			}
+
+			/*!
+			 * @brief Compute bit indices of keys into bit_index_array, salt by salt for each key,
+			 * and prefetch the byte of each index for reading (RW = 0) or writing (RW = 1).
+			 */
+			template<int RW, typename T>
+			void locate_batch(std::span<const T> keys, std::span<size_t> bit_index_array) const {
+				size_t *index_ptr = bit_index_array.data();
+				for (const T &key: keys) {
+					const std::span<const uint8_t> bytes = key_bytes(key);
+					const util::Hash128 hash = Hasher::hash(bytes.data(), bytes.size(), random_seed_);
+					for (uint32_t i = 0; i < salt_count_; ++i, ++index_ptr) {
+						size_t bit = 0;
+						compute_indices(hash, i, *index_ptr, bit);
+						__builtin_prefetch(table() + *index_ptr / bits_per_char, RW, 1);
 					}
 				}
+			}
+
+			/*!
+			 * @brief Whether compute_indices() maps keys by bloom_index, as a filter loaded by open_mapped() does
+			 */
+			inline virtual bool bloom_indexed() const {
+				return true;
+			}
 
-				return hash;
+			/*!
+			 * @brief The i-th bit of a key, mapped into the table by multiplication
+			 */
+			inline virtual void compute_indices(const util::Hash128 &hash, uint32_t i, size_t &bit_index, size_t &bit) const {
+				bit_index = bloom_index(hash, i, table_size_);
+				bit = bit_index % bits_per_char;
 			}
 		};
 
-		class CompressibleBloomFilter : public BloomFilter {
+		template<util::HasherConcept Hasher = util::FastHasher>
+		class CompressibleBloomFilter : public BloomFilter<Hasher> {
+		private:
+			using Base = BloomFilter<Hasher>;
+
+		public:
+			using typename Base::table_type;
+			using Base::bit_table_;
+			using Base::table_size_;
+			using Base::desired_false_positive_probability_;
+
 		public:
 			std::vector<uint64_t> size_list;
 
 		public:
-			CompressibleBloomFilter(const BloomParameter &p): BloomFilter(p) {
+			CompressibleBloomFilter(const BloomParameter &p): Base(p) {
 				size_list.push_back(table_size_);
 			}
 
@@ -562,7 +745,8 @@ namespace algorithm::structure {
 					return false;
 				}
 
-				desired_false_positive_probability_ = effective_fpp();
+				desired_false_positive_probability_ = this->effective_fpp();
+				this->own_table();
 
 				const uint64_t new_tbl_raw_size = new_table_size / bits_per_char;
 
@@ -570,14 +754,16 @@ namespace algorithm::structure {
 
 				std::copy(bit_table_.begin(), bit_table_.begin() + new_tbl_raw_size, tmp.begin());
 
-				typedef table_type::iterator itr_t;
+				typedef typename table_type::iterator itr_t;
 
 				itr_t itr = bit_table_.begin() + (new_table_size / bits_per_char);
 				itr_t end = bit_table_.begin() + (original_table_size / bits_per_char);
 				itr_t itr_tmp = tmp.begin();
 
+				// Fold bits beyond the new size, wrapping around when it is less than half of the original
 				while (end != itr) {
 					*(itr_tmp++) |= (*itr++);
+					if (itr_tmp == tmp.end()) { itr_tmp = tmp.begin(); }
 				}
 
 				std::swap(bit_table_, tmp);
@@ -588,11 +774,15 @@ namespace algorithm::structure {
 			}
 
 		private:
-			inline void compute_indices(const bloom_type &hash, size_t &bit_index, size_t &bit) const {
-				bit_index = hash;
+			inline bool bloom_indexed() const override {
+				return false;
+			}
+
+			inline void compute_indices(const util::Hash128 &hash, uint32_t i, size_t &bit_index, size_t &bit) const override {
+				bit_index = util::double_hash(hash, i);
 
-				for (size_t i = 0; i < size_list.size(); ++i) {
-					bit_index %= size_list[i];
+				for (size_t j = 0; j < size_list.size(); ++j) {
+					bit_index %= size_list[j];
 				}
 
 				bit = bit_index % bits_per_char;
@@ -1,5 +1,5 @@
 /*
- * @author: BL-GS 
+ * @author: BL-GS
  * @date:   2023/5/11
  */
 
@@ -7,4 +7,757 @@
 #ifndef ALGORITHM_STRUCTURE_BPTREE_H
 #define ALGORITHM_STRUCTURE_BPTREE_H
 
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <util/calculate.h>
+#include <memory/cache.h>
+#include <logger/logger.h>
+#include <allocator/allocator.h>
+#include <algorithm/search/binary_search.h>
+
+namespace algorithm::structure {
+
+	inline namespace bptree {
+
+		namespace detail {
+
+			struct BPlusNode {};
+
+			/*!
+			 * @brief Leaf holding keys and values in separate arrays, so that a search only touches lines of keys
+			 */
+			template<class Key, class Value, size_t CAPACITY>
+			struct BPlusLeafNode: BPlusNode {
+			public:
+				BPlusLeafNode *prev_ptr_;
+				BPlusLeafNode *next_ptr_;
+				uint32_t size_;
+				Key keys_[CAPACITY];
+				Value values_[CAPACITY];
+
+			public:
+				BPlusLeafNode(): prev_ptr_(nullptr), next_ptr_(nullptr), size_(0) {}
+			};
+
+			/*!
+			 * @brief Inner node, where keys_[i] is not greater than any key under child_ptr_[i + 1]
+			 */
+			template<class Key, size_t CAPACITY>
+			struct BPlusInnerNode: BPlusNode {
+			public:
+				uint32_t size_;
+				Key keys_[CAPACITY];
+				BPlusNode *child_ptr_[CAPACITY + 1];
+
+			public:
+				BPlusInnerNode(): size_(0) {}
+			};
+
+			/// The size of a leaf of capacity, following the layout of members
+			template<class Key, class Value>
+			consteval size_t leaf_node_bytes(size_t capacity) {
+				size_t offset = 2 * sizeof(void *) + sizeof(uint32_t);
+				offset = util::ceil(offset, alignof(Key)) + capacity * sizeof(Key);
+				offset = util::ceil(offset, alignof(Value)) + capacity * sizeof(Value);
+				return util::ceil(offset, std::max({alignof(void *), alignof(Key), alignof(Value)}));
+			}
+
+			/// The size of an inner node of capacity, following the layout of members
+			template<class Key>
+			consteval size_t inner_node_bytes(size_t capacity) {
+				size_t offset = sizeof(uint32_t);
+				offset = util::ceil(offset, alignof(Key)) + capacity * sizeof(Key);
+				offset = util::ceil(offset, alignof(void *)) + (capacity + 1) * sizeof(void *);
+				return util::ceil(offset, std::max(alignof(void *), alignof(Key)));
+			}
+
+			template<class Key, class Value, size_t NodeBytes>
+			consteval size_t leaf_capacity() {
+				size_t capacity = NodeBytes / (sizeof(Key) + sizeof(Value));
+				while (capacity > 0 && leaf_node_bytes<Key, Value>(capacity) > NodeBytes) { --capacity; }
+				return capacity;
+			}
+
+			template<class Key, size_t NodeBytes>
+			consteval size_t inner_capacity() {
+				size_t capacity = NodeBytes / (sizeof(Key) + sizeof(void *));
+				while (capacity > 0 && inner_node_bytes<Key>(capacity) > NodeBytes) { --capacity; }
+				return capacity;
+			}
+
+			/*!
+			 * @brief Iterator along the sibling links of leaves
+			 */
+			template<class Leaf, class Key, class Value>
+			class BPlusIterator {
+			public:
+				using KeyType   = Key;
+				using ValueType = Value;
+
+			private:
+				Leaf *leaf_ptr_;
+				uint32_t idx_;
+
+			public:
+				BPlusIterator(): leaf_ptr_(nullptr), idx_(0) {}
+
+				BPlusIterator(Leaf *leaf_ptr, uint32_t idx): leaf_ptr_(leaf_ptr), idx_(idx) {}
+
+				/// Iterators are convertible into those of const values
+				template<class OtherLeaf, class OtherValue>
+				    requires std::is_convertible_v<OtherLeaf *, Leaf *>
+				BPlusIterator(const BPlusIterator<OtherLeaf, Key, OtherValue> &other): leaf_ptr_(other.leaf_ptr()), idx_(other.index()) {}
+
+			public:
+				const KeyType &key() const { return leaf_ptr_->keys_[idx_]; }
+
+				ValueType &value() const { return leaf_ptr_->values_[idx_]; }
+
+				Leaf *leaf_ptr() const { return leaf_ptr_; }
+
+				uint32_t index() const { return idx_; }
+
+			public:
+				BPlusIterator &operator++() {
+					if (++idx_ == leaf_ptr_->size_) {
+						leaf_ptr_ = leaf_ptr_->next_ptr_;
+						idx_      = 0;
+					}
+					return *this;
+				}
+
+				BPlusIterator operator++(int) {
+					BPlusIterator res = *this;
+					++(*this);
+					return res;
+				}
+
+				/// Step back from a valid position, where the first element steps to the end
+				BPlusIterator &operator--() {
+					if (idx_ == 0) {
+						leaf_ptr_ = leaf_ptr_->prev_ptr_;
+						idx_      = (leaf_ptr_ == nullptr) ? 0 : leaf_ptr_->size_ - 1;
+					}
+					else {
+						--idx_;
+					}
+					return *this;
+				}
+
+				BPlusIterator operator--(int) {
+					BPlusIterator res = *this;
+					--(*this);
+					return res;
+				}
+
+			public:
+				friend bool operator==(const BPlusIterator &lhs, const BPlusIterator &rhs) {
+					return lhs.leaf_ptr_ == rhs.leaf_ptr_ && lhs.idx_ == rhs.idx_;
+				}
+			};
+		}
+
+		/*!
+		 * @brief B+tree map with nodes of NodeBytes, a multiple of cache lines.
+		 * Keys of a node are kept contiguous and apart from values or children, and searched by the branchless
+		 * search::lower_bound, so that a lookup visits a few lines per level. Leaves are linked both ways for scans.
+		 * Nodes are allocated by size classes of the allocator, which are multiples of cache lines by default.
+		 * @tparam NodeBytes The bytes of a node, where a leaf of 64-bit keys and values holds 30 pairs by default
+		 */
+		template<class Key, class Value, size_t NodeBytes = 8 * memory::CACHE_LINE_SIZE, class Cmp = std::less<Key>,
+		         class Allocator = allocator::ReserveAllocator<Value>>
+		    requires allocator::AllocatorConcept<Allocator>
+		class BPlusTree {
+		public:
+			using Self = BPlusTree<Key, Value, NodeBytes, Cmp, Allocator>;
+
+			using KeyType   = Key;
+			using ValueType = Value;
+
+			static_assert(NodeBytes % memory::CACHE_LINE_SIZE == 0, "The size of node should be a multiple of cache lines");
+
+			static constexpr size_t LEAF_CAPACITY  = detail::leaf_capacity<Key, Value, NodeBytes>();
+			static constexpr size_t INNER_CAPACITY = detail::inner_capacity<Key, NodeBytes>();
+
+			static_assert(LEAF_CAPACITY >= 4 && INNER_CAPACITY >= 3, "The size of node is too small for keys and values");
+
+			/// The least amount of pairs in a leaf and children of an inner node, except for the root
+			static constexpr size_t MIN_LEAF_SIZE      = LEAF_CAPACITY / 2;
+			static constexpr size_t MIN_INNER_CHILDREN = (INNER_CAPACITY + 1) / 2;
+
+			/// Beyond any height reachable with at least 2 children per inner node
+			static constexpr uint32_t MAX_HEIGHT = 64;
+
+		public:
+			using NodeType      = detail::BPlusNode;
+			using LeafNodeType  = detail::BPlusLeafNode<Key, Value, LEAF_CAPACITY>;
+			using InnerNodeType = detail::BPlusInnerNode<Key, INNER_CAPACITY>;
+
+			static_assert(sizeof(LeafNodeType) <= NodeBytes && sizeof(InnerNodeType) <= NodeBytes);
+
+			using LeafAllocatorType  = Allocator::template Rebind<LeafNodeType>::type;
+			using InnerAllocatorType = Allocator::template Rebind<InnerNodeType>::type;
+
+			using IteratorType      = detail::BPlusIterator<LeafNodeType, Key, Value>;
+			using ConstIteratorType = detail::BPlusIterator<const LeafNodeType, Key, const Value>;
+
+		private:
+			/// Inner nodes along the path from the root, and the index of child taken at each
+			struct Path {
+				InnerNodeType *node_ptr[MAX_HEIGHT];
+				uint32_t child_idx[MAX_HEIGHT];
+			};
+
+		private:
+			NodeType *root_ptr_;
+
+			/// The amount of inner levels, where the root is a leaf if 0
+			uint32_t height_;
+
+			size_t size_;
+
+			LeafNodeType *head_leaf_ptr_;
+
+			LeafNodeType *tail_leaf_ptr_;
+
+			[[no_unique_address]] Cmp cmp_;
+
+			LeafAllocatorType leaf_allocator_;
+
+			InnerAllocatorType inner_allocator_;
+
+		public:
+			BPlusTree(): root_ptr_(nullptr), height_(0), size_(0), head_leaf_ptr_(nullptr), tail_leaf_ptr_(nullptr) {}
+
+			BPlusTree(const BPlusTree &other) = delete;
+
+			BPlusTree(BPlusTree &&other) noexcept:
+			        root_ptr_(std::exchange(other.root_ptr_, nullptr)),
+			        height_(std::exchange(other.height_, 0)),
+			        size_(std::exchange(other.size_, 0)),
+			        head_leaf_ptr_(std::exchange(other.head_leaf_ptr_, nullptr)),
+			        tail_leaf_ptr_(std::exchange(other.tail_leaf_ptr_, nullptr)),
+			        cmp_(std::move(other.cmp_)),
+			        leaf_allocator_(std::move(other.leaf_allocator_)),
+			        inner_allocator_(std::move(other.inner_allocator_)) {}
+
+			BPlusTree &operator=(BPlusTree &&other) noexcept {
+				if (this != &other) {
+					clear();
+					root_ptr_        = std::exchange(other.root_ptr_, nullptr);
+					height_          = std::exchange(other.height_, 0);
+					size_            = std::exchange(other.size_, 0);
+					head_leaf_ptr_   = std::exchange(other.head_leaf_ptr_, nullptr);
+					tail_leaf_ptr_   = std::exchange(other.tail_leaf_ptr_, nullptr);
+					cmp_             = std::move(other.cmp_);
+					leaf_allocator_  = std::move(other.leaf_allocator_);
+					inner_allocator_ = std::move(other.inner_allocator_);
+				}
+				return *this;
+			}
+
+			~BPlusTree() {
+				clear();
+			}
+
+		public:
+			/*!
+			 * @brief Replace the content with sorted pairs, built level by level from leaves in linear time.
+			 * Nodes are filled up to fill_factor of capacity, where the rest leaves room for later insertion.
+			 * @param keys Strictly ascending keys
+			 * @param values Values of keys one by one
+			 * @return Whether the input is valid, otherwise the tree is left unchanged
+			 */
+			bool bulk_load(std::span<const Key> keys, std::span<const Value> values, double fill_factor = 1.0) {
+				if (keys.size() != values.size()) {
+					util::logger::logger_error("Fail to bulk load, where the amount of keys and values differs");
+					return false;
+				}
+				for (size_t idx = 1; idx < keys.size(); ++idx) {
+					if (!cmp_(keys[idx - 1], keys[idx])) {
+						util::logger::logger_error("Fail to bulk load, where keys are not strictly ascending at: ", idx);
+						return false;
+					}
+				}
+
+				clear();
+				if (keys.empty()) { return true; }
+
+				fill_factor = std::clamp(fill_factor, 0.0, 1.0);
+
+				// Leaves, with the least key of each subtree kept for separators above
+				std::vector<NodeType *> level_node_array;
+				std::vector<Key> level_key_array;
+				const size_t leaf_amount = group_amount(keys.size(), fill_factor * LEAF_CAPACITY, MIN_LEAF_SIZE);
+				size_t offset = 0;
+				for (size_t group_idx = 0; group_idx < leaf_amount; ++group_idx) {
+					const size_t group_size = keys.size() / leaf_amount + (group_idx < keys.size() % leaf_amount);
+
+					LeafNodeType *leaf_ptr = leaf_allocator_.construct();
+					std::copy_n(keys.begin() + offset, group_size, leaf_ptr->keys_);
+					std::copy_n(values.begin() + offset, group_size, leaf_ptr->values_);
+					leaf_ptr->size_ = group_size;
+					link_after(tail_leaf_ptr_, leaf_ptr);
+
+					level_node_array.push_back(leaf_ptr);
+					level_key_array.push_back(keys[offset]);
+					offset += group_size;
+				}
+
+				// Inner levels, until a single root remains
+				while (level_node_array.size() > 1) {
+					const size_t child_amount = level_node_array.size();
+					const size_t node_amount  = group_amount(child_amount, fill_factor * (INNER_CAPACITY + 1), MIN_INNER_CHILDREN);
+
+					std::vector<NodeType *> upper_node_array;
+					std::vector<Key> upper_key_array;
+					offset = 0;
+					for (size_t group_idx = 0; group_idx < node_amount; ++group_idx) {
+						const size_t group_size = child_amount / node_amount + (group_idx < child_amount % node_amount);
+
+						InnerNodeType *inner_ptr = inner_allocator_.construct();
+						std::copy_n(level_node_array.begin() + offset, group_size, inner_ptr->child_ptr_);
+						std::copy_n(level_key_array.begin() + offset + 1, group_size - 1, inner_ptr->keys_);
+						inner_ptr->size_ = group_size - 1;
+
+						upper_node_array.push_back(inner_ptr);
+						upper_key_array.push_back(std::move(level_key_array[offset]));
+						offset += group_size;
+					}
+					level_node_array = std::move(upper_node_array);
+					level_key_array  = std::move(upper_key_array);
+					++height_;
+				}
+
+				root_ptr_ = level_node_array.front();
+				size_     = keys.size();
+				return true;
+			}
+
+			/*!
+			 * @brief Insert a pair if the key is absent
+			 * @return Whether the pair is inserted
+			 */
+			bool insert(const Key &key, const Value &value) {
+				if (root_ptr_ == nullptr) {
+					LeafNodeType *leaf_ptr = leaf_allocator_.construct();
+					leaf_ptr->keys_[0]   = key;
+					leaf_ptr->values_[0] = value;
+					leaf_ptr->size_      = 1;
+					link_after(nullptr, leaf_ptr);
+					root_ptr_ = leaf_ptr;
+					size_     = 1;
+					return true;
+				}
+
+				Path path;
+				LeafNodeType *leaf_ptr = descend(key, &path);
+				const uint32_t pos     = leaf_lower_bound(leaf_ptr, key);
+				if (pos < leaf_ptr->size_ && !cmp_(key, leaf_ptr->keys_[pos])) { return false; }
+
+				++size_;
+				if (leaf_ptr->size_ < LEAF_CAPACITY) {
+					leaf_insert_at(leaf_ptr, pos, key, value);
+					return true;
+				}
+
+				// Split the full leaf in halves, and pass the least key of the right one up
+				LeafNodeType *right_ptr = leaf_allocator_.construct();
+				constexpr uint32_t LEFT_SIZE = (LEAF_CAPACITY + 1) / 2;
+				if (pos < LEFT_SIZE) {
+					leaf_move_tail(leaf_ptr, LEFT_SIZE - 1, right_ptr);
+					leaf_insert_at(leaf_ptr, pos, key, value);
+				}
+				else {
+					leaf_move_tail(leaf_ptr, LEFT_SIZE, right_ptr);
+					leaf_insert_at(right_ptr, pos - LEFT_SIZE, key, value);
+				}
+				link_after(leaf_ptr, right_ptr);
+				insert_into_parent(&path, height_, right_ptr->keys_[0], right_ptr);
+				return true;
+			}
+
+			/*!
+			 * @brief Erase the pair of key, where underflowing nodes borrow from or merge with a sibling
+			 * @return Whether the key is found
+			 */
+			bool erase(const Key &key) {
+				if (root_ptr_ == nullptr) { return false; }
+
+				Path path;
+				LeafNodeType *leaf_ptr = descend(key, &path);
+				const uint32_t pos     = leaf_lower_bound(leaf_ptr, key);
+				if (pos == leaf_ptr->size_ || cmp_(key, leaf_ptr->keys_[pos])) { return false; }
+
+				--size_;
+				std::move(leaf_ptr->keys_ + pos + 1, leaf_ptr->keys_ + leaf_ptr->size_, leaf_ptr->keys_ + pos);
+				std::move(leaf_ptr->values_ + pos + 1, leaf_ptr->values_ + leaf_ptr->size_, leaf_ptr->values_ + pos);
+				--leaf_ptr->size_;
+
+				if (height_ == 0) {
+					if (leaf_ptr->size_ == 0) { clear(); }
+					return true;
+				}
+				if (leaf_ptr->size_ < MIN_LEAF_SIZE) { rebalance_leaf(&path, leaf_ptr); }
+				return true;
+			}
+
+		public:
+			IteratorType find(const Key &key) {
+				const ConstIteratorType iter = std::as_const(*this).find(key);
+				return {const_cast<LeafNodeType *>(iter.leaf_ptr()), iter.index()};
+			}
+
+			ConstIteratorType find(const Key &key) const {
+				const ConstIteratorType iter = lower_bound(key);
+				if (iter == end() || cmp_(key, iter.key())) { return end(); }
+				return iter;
+			}
+
+			bool contains(const Key &key) const {
+				return find(key) != end();
+			}
+
+			/*!
+			 * @brief The first pair with key not less than key
+			 */
+			IteratorType lower_bound(const Key &key) {
+				const ConstIteratorType iter = std::as_const(*this).lower_bound(key);
+				return {const_cast<LeafNodeType *>(iter.leaf_ptr()), iter.index()};
+			}
+
+			ConstIteratorType lower_bound(const Key &key) const {
+				if (root_ptr_ == nullptr) { return end(); }
+
+				const LeafNodeType *leaf_ptr = descend(key, nullptr);
+				const uint32_t pos           = leaf_lower_bound(leaf_ptr, key);
+				if (pos == leaf_ptr->size_) { return {leaf_ptr->next_ptr_, 0}; }
+				return {leaf_ptr, pos};
+			}
+
+			/*!
+			 * @brief Visit pairs with keys in [low_key, high_key) in order by func(key, value) along leaves
+			 * @return The amount of pairs visited
+			 */
+			template<class Func>
+			size_t scan(const Key &low_key, const Key &high_key, Func &&func) const {
+				const ConstIteratorType start_iter = lower_bound(low_key);
+
+				size_t res = 0;
+				uint32_t idx = start_iter.index();
+				for (const LeafNodeType *leaf_ptr = start_iter.leaf_ptr(); leaf_ptr != nullptr; leaf_ptr = leaf_ptr->next_ptr_) {
+					for (; idx < leaf_ptr->size_; ++idx) {
+						if (!cmp_(leaf_ptr->keys_[idx], high_key)) { return res; }
+						func(leaf_ptr->keys_[idx], leaf_ptr->values_[idx]);
+						++res;
+					}
+					idx = 0;
+				}
+				return res;
+			}
+
+		public:
+			IteratorType begin() { return {head_leaf_ptr_, 0}; }
+
+			IteratorType end() { return {}; }
+
+			ConstIteratorType begin() const { return {head_leaf_ptr_, 0}; }
+
+			ConstIteratorType end() const { return {}; }
+
+			/// The last pair, for iterating backward
+			IteratorType last() {
+				return (tail_leaf_ptr_ == nullptr) ? end() : IteratorType{tail_leaf_ptr_, tail_leaf_ptr_->size_ - 1};
+			}
+
+		public:
+			size_t size() const {
+				return size_;
+			}
+
+			bool empty() const {
+				return size_ == 0;
+			}
+
+			/*!
+			 * @brief The amount of inner levels above leaves
+			 */
+			uint32_t height() const {
+				return height_;
+			}
+
+			void clear() {
+				if (root_ptr_ != nullptr) { destroy(root_ptr_, height_); }
+				root_ptr_      = nullptr;
+				height_        = 0;
+				size_          = 0;
+				head_leaf_ptr_ = nullptr;
+				tail_leaf_ptr_ = nullptr;
+			}
+
+		private:
+			/// The amount of nodes to hold amount items with about per_node each, but no fewer than min_size each
+			static size_t group_amount(size_t amount, double per_node, size_t min_size) {
+				const size_t per_node_amount = std::max<size_t>(1, static_cast<size_t>(per_node));
+				return std::max<size_t>(1, std::min((amount + per_node_amount - 1) / per_node_amount, amount / min_size));
+			}
+
+			/// The index of child holding key, i.e. the amount of separators not greater than key
+			uint32_t child_index(const InnerNodeType *inner_ptr, const Key &key) const {
+				const Key *pos_ptr = search::lower_bound(inner_ptr->keys_, inner_ptr->keys_ + inner_ptr->size_, key,
+				                                         [this](const Key &lhs, const Key &rhs) { return !cmp_(rhs, lhs); });
+				return pos_ptr - inner_ptr->keys_;
+			}
+
+			uint32_t leaf_lower_bound(const LeafNodeType *leaf_ptr, const Key &key) const {
+				return search::lower_bound(leaf_ptr->keys_, leaf_ptr->keys_ + leaf_ptr->size_, key, cmp_) - leaf_ptr->keys_;
+			}
+
+			/// Walk down to the leaf of key, with inner nodes along recorded in path if any
+			LeafNodeType *descend(const Key &key, Path *path) const {
+				NodeType *node_ptr = root_ptr_;
+				for (uint32_t level = 0; level < height_; ++level) {
+					InnerNodeType *inner_ptr = static_cast<InnerNodeType *>(node_ptr);
+					const uint32_t child_idx = child_index(inner_ptr, key);
+					if (path != nullptr) {
+						path->node_ptr[level]  = inner_ptr;
+						path->child_idx[level] = child_idx;
+					}
+					node_ptr = inner_ptr->child_ptr_[child_idx];
+					prefetch_node(node_ptr);
+				}
+				return static_cast<LeafNodeType *>(node_ptr);
+			}
+
+			/// Fetch all lines of the node ahead of the search inside
+			static void prefetch_node(const NodeType *node_ptr) {
+				for (size_t offset = 0; offset < NodeBytes; offset += memory::CACHE_LINE_SIZE) {
+					__builtin_prefetch(reinterpret_cast<const char *>(node_ptr) + offset, 0, 3);
+				}
+			}
+
+			void destroy(NodeType *node_ptr, uint32_t height) {
+				if (height == 0) {
+					leaf_allocator_.deconstruct(static_cast<LeafNodeType *>(node_ptr));
+					return;
+				}
+				InnerNodeType *inner_ptr = static_cast<InnerNodeType *>(node_ptr);
+				for (uint32_t idx = 0; idx <= inner_ptr->size_; ++idx) { destroy(inner_ptr->child_ptr_[idx], height - 1); }
+				inner_allocator_.deconstruct(inner_ptr);
+			}
+
+		private:
+			/// Link new_ptr after prev_ptr in the chain of leaves, or as the head if prev_ptr is null
+			void link_after(LeafNodeType *prev_ptr, LeafNodeType *new_ptr) {
+				LeafNodeType *next_ptr = (prev_ptr == nullptr) ? head_leaf_ptr_ : prev_ptr->next_ptr_;
+				new_ptr->prev_ptr_ = prev_ptr;
+				new_ptr->next_ptr_ = next_ptr;
+				if (prev_ptr == nullptr) { head_leaf_ptr_ = new_ptr; } else { prev_ptr->next_ptr_ = new_ptr; }
+				if (next_ptr == nullptr) { tail_leaf_ptr_ = new_ptr; } else { next_ptr->prev_ptr_ = new_ptr; }
+			}
+
+			void unlink(LeafNodeType *leaf_ptr) {
+				if (leaf_ptr->prev_ptr_ == nullptr) { head_leaf_ptr_ = leaf_ptr->next_ptr_; } else { leaf_ptr->prev_ptr_->next_ptr_ = leaf_ptr->next_ptr_; }
+				if (leaf_ptr->next_ptr_ == nullptr) { tail_leaf_ptr_ = leaf_ptr->prev_ptr_; } else { leaf_ptr->next_ptr_->prev_ptr_ = leaf_ptr->prev_ptr_; }
+			}
+
+			static void leaf_insert_at(LeafNodeType *leaf_ptr, uint32_t pos, const Key &key, const Value &value) {
+				std::move_backward(leaf_ptr->keys_ + pos, leaf_ptr->keys_ + leaf_ptr->size_, leaf_ptr->keys_ + leaf_ptr->size_ + 1);
+				std::move_backward(leaf_ptr->values_ + pos, leaf_ptr->values_ + leaf_ptr->size_, leaf_ptr->values_ + leaf_ptr->size_ + 1);
+				leaf_ptr->keys_[pos]   = key;
+				leaf_ptr->values_[pos] = value;
+				++leaf_ptr->size_;
+			}
+
+			/// Move pairs from pos on to the end of dst_ptr
+			static void leaf_move_tail(LeafNodeType *src_ptr, uint32_t pos, LeafNodeType *dst_ptr) {
+				std::move(src_ptr->keys_ + pos, src_ptr->keys_ + src_ptr->size_, dst_ptr->keys_ + dst_ptr->size_);
+				std::move(src_ptr->values_ + pos, src_ptr->values_ + src_ptr->size_, dst_ptr->values_ + dst_ptr->size_);
+				dst_ptr->size_ += src_ptr->size_ - pos;
+				src_ptr->size_  = pos;
+			}
+
+			/*!
+			 * @brief Insert the separator and the new right node after the child taken at level - 1, splitting full nodes upward
+			 */
+			void insert_into_parent(Path *path, uint32_t level, Key separator, NodeType *right_ptr) {
+				while (level > 0) {
+					--level;
+					InnerNodeType *inner_ptr = path->node_ptr[level];
+					const uint32_t pos       = path->child_idx[level];
+
+					if (inner_ptr->size_ < INNER_CAPACITY) {
+						inner_insert_at(inner_ptr, pos, std::move(separator), right_ptr);
+						return;
+					}
+
+					// Split around the median of the INNER_CAPACITY + 1 keys, which moves up instead of staying
+					InnerNodeType *new_ptr = inner_allocator_.construct();
+					constexpr uint32_t LEFT_SIZE = (INNER_CAPACITY + 1) / 2;
+					if (pos < LEFT_SIZE) {
+						inner_move_tail(inner_ptr, LEFT_SIZE - 1, new_ptr);
+						inner_insert_at(inner_ptr, pos, std::move(separator), right_ptr);
+					}
+					else {
+						inner_move_tail(inner_ptr, LEFT_SIZE, new_ptr);
+						inner_insert_at(new_ptr, pos - LEFT_SIZE, std::move(separator), right_ptr);
+					}
+					// The head of the right node holds the median, with its left child kept as the first child
+					separator           = std::move(new_ptr->keys_[0]);
+					new_ptr->child_ptr_[0] = new_ptr->child_ptr_[1];
+					std::move(new_ptr->keys_ + 1, new_ptr->keys_ + new_ptr->size_, new_ptr->keys_);
+					std::move(new_ptr->child_ptr_ + 2, new_ptr->child_ptr_ + new_ptr->size_ + 1, new_ptr->child_ptr_ + 1);
+					--new_ptr->size_;
+					right_ptr = new_ptr;
+				}
+
+				InnerNodeType *root_ptr = inner_allocator_.construct();
+				root_ptr->keys_[0]      = std::move(separator);
+				root_ptr->child_ptr_[0] = root_ptr_;
+				root_ptr->child_ptr_[1] = right_ptr;
+				root_ptr->size_         = 1;
+				root_ptr_ = root_ptr;
+				++height_;
+			}
+
+			/// Insert the key at pos, with child_ptr following it
+			static void inner_insert_at(InnerNodeType *inner_ptr, uint32_t pos, Key &&key, NodeType *child_ptr) {
+				std::move_backward(inner_ptr->keys_ + pos, inner_ptr->keys_ + inner_ptr->size_, inner_ptr->keys_ + inner_ptr->size_ + 1);
+				std::move_backward(inner_ptr->child_ptr_ + pos + 1, inner_ptr->child_ptr_ + inner_ptr->size_ + 1, inner_ptr->child_ptr_ + inner_ptr->size_ + 2);
+				inner_ptr->keys_[pos]          = std::move(key);
+				inner_ptr->child_ptr_[pos + 1] = child_ptr;
+				++inner_ptr->size_;
+			}
+
+			/// Move keys from pos on, with children following them, to an empty node, where child_ptr_[0] is left unset
+			static void inner_move_tail(InnerNodeType *src_ptr, uint32_t pos, InnerNodeType *dst_ptr) {
+				std::move(src_ptr->keys_ + pos, src_ptr->keys_ + src_ptr->size_, dst_ptr->keys_);
+				std::move(src_ptr->child_ptr_ + pos + 1, src_ptr->child_ptr_ + src_ptr->size_ + 1, dst_ptr->child_ptr_ + 1);
+				dst_ptr->size_ = src_ptr->size_ - pos;
+				src_ptr->size_ = pos;
+			}
+
+			/// Remove the key at pos, with the child following it
+			static void inner_erase_at(InnerNodeType *inner_ptr, uint32_t pos) {
+				std::move(inner_ptr->keys_ + pos + 1, inner_ptr->keys_ + inner_ptr->size_, inner_ptr->keys_ + pos);
+				std::move(inner_ptr->child_ptr_ + pos + 2, inner_ptr->child_ptr_ + inner_ptr->size_ + 1, inner_ptr->child_ptr_ + pos + 1);
+				--inner_ptr->size_;
+			}
+
+		private:
+			void rebalance_leaf(Path *path, LeafNodeType *leaf_ptr) {
+				InnerNodeType *parent_ptr = path->node_ptr[height_ - 1];
+				const uint32_t child_idx  = path->child_idx[height_ - 1];
+
+				if (child_idx > 0) {
+					LeafNodeType *left_ptr = static_cast<LeafNodeType *>(parent_ptr->child_ptr_[child_idx - 1]);
+					if (left_ptr->size_ > MIN_LEAF_SIZE) {
+						--left_ptr->size_;
+						leaf_insert_at(leaf_ptr, 0, left_ptr->keys_[left_ptr->size_], left_ptr->values_[left_ptr->size_]);
+						parent_ptr->keys_[child_idx - 1] = leaf_ptr->keys_[0];
+						return;
+					}
+					merge_leaf(path, left_ptr, leaf_ptr, child_idx - 1);
+					return;
+				}
+
+				LeafNodeType *right_ptr = static_cast<LeafNodeType *>(parent_ptr->child_ptr_[child_idx + 1]);
+				if (right_ptr->size_ > MIN_LEAF_SIZE) {
+					leaf_ptr->keys_[leaf_ptr->size_]   = std::move(right_ptr->keys_[0]);
+					leaf_ptr->values_[leaf_ptr->size_] = std::move(right_ptr->values_[0]);
+					++leaf_ptr->size_;
+					std::move(right_ptr->keys_ + 1, right_ptr->keys_ + right_ptr->size_, right_ptr->keys_);
+					std::move(right_ptr->values_ + 1, right_ptr->values_ + right_ptr->size_, right_ptr->values_);
+					--right_ptr->size_;
+					parent_ptr->keys_[child_idx] = right_ptr->keys_[0];
+					return;
+				}
+				merge_leaf(path, leaf_ptr, right_ptr, child_idx);
+			}
+
+			/// Merge the right leaf into the left one, separated by keys_[separator_idx] of the parent
+			void merge_leaf(Path *path, LeafNodeType *left_ptr, LeafNodeType *right_ptr, uint32_t separator_idx) {
+				leaf_move_tail(right_ptr, 0, left_ptr);
+				unlink(right_ptr);
+				leaf_allocator_.deconstruct(right_ptr);
+
+				InnerNodeType *parent_ptr = path->node_ptr[height_ - 1];
+				inner_erase_at(parent_ptr, separator_idx);
+				rebalance_inner(path, height_ - 1);
+			}
+
+			/// Fix the inner node at level after losing a child, which may shrink the tree from the root
+			void rebalance_inner(Path *path, uint32_t level) {
+				while (true) {
+					InnerNodeType *inner_ptr = path->node_ptr[level];
+					if (level == 0) {
+						if (inner_ptr->size_ == 0) {
+							root_ptr_ = inner_ptr->child_ptr_[0];
+							inner_allocator_.deconstruct(inner_ptr);
+							--height_;
+						}
+						return;
+					}
+					if (inner_ptr->size_ + 1 >= MIN_INNER_CHILDREN) { return; }
+
+					InnerNodeType *parent_ptr = path->node_ptr[level - 1];
+					const uint32_t child_idx  = path->child_idx[level - 1];
+
+					if (child_idx > 0) {
+						InnerNodeType *left_ptr = static_cast<InnerNodeType *>(parent_ptr->child_ptr_[child_idx - 1]);
+						if (left_ptr->size_ + 1 > MIN_INNER_CHILDREN) {
+							// Rotate the last child of the left sibling through the separator
+							std::move_backward(inner_ptr->keys_, inner_ptr->keys_ + inner_ptr->size_, inner_ptr->keys_ + inner_ptr->size_ + 1);
+							std::move_backward(inner_ptr->child_ptr_, inner_ptr->child_ptr_ + inner_ptr->size_ + 1, inner_ptr->child_ptr_ + inner_ptr->size_ + 2);
+							inner_ptr->keys_[0]      = std::move(parent_ptr->keys_[child_idx - 1]);
+							inner_ptr->child_ptr_[0] = left_ptr->child_ptr_[left_ptr->size_];
+							++inner_ptr->size_;
+							parent_ptr->keys_[child_idx - 1] = std::move(left_ptr->keys_[left_ptr->size_ - 1]);
+							--left_ptr->size_;
+							return;
+						}
+						merge_inner(left_ptr, inner_ptr, parent_ptr, child_idx - 1);
+					}
+					else {
+						InnerNodeType *right_ptr = static_cast<InnerNodeType *>(parent_ptr->child_ptr_[child_idx + 1]);
+						if (right_ptr->size_ + 1 > MIN_INNER_CHILDREN) {
+							// Rotate the first child of the right sibling through the separator
+							inner_ptr->keys_[inner_ptr->size_]          = std::move(parent_ptr->keys_[child_idx]);
+							inner_ptr->child_ptr_[inner_ptr->size_ + 1] = right_ptr->child_ptr_[0];
+							++inner_ptr->size_;
+							parent_ptr->keys_[child_idx] = std::move(right_ptr->keys_[0]);
+							std::move(right_ptr->keys_ + 1, right_ptr->keys_ + right_ptr->size_, right_ptr->keys_);
+							std::move(right_ptr->child_ptr_ + 1, right_ptr->child_ptr_ + right_ptr->size_ + 1, right_ptr->child_ptr_);
+							--right_ptr->size_;
+							return;
+						}
+						merge_inner(inner_ptr, right_ptr, parent_ptr, child_idx);
+					}
+					--level;
+				}
+			}
+
+			/// Merge the right node into the left one, pulling down keys_[separator_idx] of the parent between them
+			void merge_inner(InnerNodeType *left_ptr, InnerNodeType *right_ptr, InnerNodeType *parent_ptr, uint32_t separator_idx) {
+				left_ptr->keys_[left_ptr->size_] = std::move(parent_ptr->keys_[separator_idx]);
+				std::move(right_ptr->keys_, right_ptr->keys_ + right_ptr->size_, left_ptr->keys_ + left_ptr->size_ + 1);
+				std::move(right_ptr->child_ptr_, right_ptr->child_ptr_ + right_ptr->size_ + 1, left_ptr->child_ptr_ + left_ptr->size_ + 1);
+				left_ptr->size_ += right_ptr->size_ + 1;
+				inner_allocator_.deconstruct(right_ptr);
+				inner_erase_at(parent_ptr, separator_idx);
+			}
+		};
+
+	}
+
+}
+
 #endif//ALGORITHM_STRUCTURE_BPTREE_H
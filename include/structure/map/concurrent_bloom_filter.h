@@ -0,0 +1,180 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_STRUCTURE_CONCURRENT_BLOOM_FILTER_H
+#define ALGORITHM_STRUCTURE_CONCURRENT_BLOOM_FILTER_H
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include <util/hash.h>
+#include <memory/cache.h>
+#include <memory/thread.h>
+#include <structure/map/bloom_filter.h>
+
+namespace algorithm::structure {
+
+	inline namespace bloom_filter {
+
+		/*!
+		 * @brief Bloom filter shared by threads inserting concurrently, with the same bits as BloomFilter of the same parameter.
+		 * Bits are set by relaxed fetch_or on 64-bit words, skipped when already set so that hot words stay shared in caches,
+		 * and the element count is kept per thread. Lookups are plain relaxed loads, hence wait-free alongside writers.
+		 * An insertion is visible to another thread once the two synchronize, e.g. by joining.
+		 */
+		template<util::HasherConcept Hasher = util::FastHasher>
+		class ConcurrentBloomFilter {
+		public:
+			using hasher_type = Hasher;
+
+			using word_type = uint64_t;
+
+			static constexpr uint64_t WORD_BITS = sizeof(word_type) * bits_per_char;
+
+		private:
+			struct alignas(memory::CACHE_LINE_SIZE) Counter {
+				std::atomic<uint64_t> value{0};
+			};
+
+			static_assert(sizeof(Counter) == memory::CACHE_LINE_SIZE, "A counter is expected to take a cache line");
+
+			/// Counters of threads with tid, followed by one shared by threads without tid
+			static constexpr uint32_t COUNTER_AMOUNT = memory::get_max_tid() + 1;
+
+		private:
+			std::unique_ptr<std::atomic<word_type>[]> word_array_;
+			std::unique_ptr<Counter[]> counter_array_;
+			uint64_t word_amount_;
+			uint64_t table_size_;
+			uint32_t hash_count_;
+			uint64_t random_seed_;
+
+		public:
+			ConcurrentBloomFilter(): word_amount_(0), table_size_(0), hash_count_(0), random_seed_(0) {}
+
+			/*!
+			 * @brief Size the filter as BloomFilter, with the table rounded up to whole words
+			 */
+			explicit ConcurrentBloomFilter(const BloomParameter &p):
+			        word_array_(std::make_unique<std::atomic<word_type>[]>((p.optimal_parameters.table_size + WORD_BITS - 1) / WORD_BITS)),
+			        counter_array_(std::make_unique<Counter[]>(COUNTER_AMOUNT)),
+			        word_amount_((p.optimal_parameters.table_size + WORD_BITS - 1) / WORD_BITS),
+			        table_size_(p.optimal_parameters.table_size),
+			        hash_count_(p.optimal_parameters.number_of_hashes),
+			        random_seed_((p.random_seed * 0xA5A5A5A5) + 1) {}
+
+		public:
+			void insert(const uint8_t *key_begin, size_t length) {
+				insert_hash(Hasher::hash(key_begin, length, random_seed_));
+			}
+
+			template<typename T>
+			void insert(const T &t) {
+				const std::span<const uint8_t> bytes = key_bytes(t);
+				insert(bytes.data(), bytes.size());
+			}
+
+			template<typename InputIterator>
+			void insert(const InputIterator begin, const InputIterator end) {
+				for (InputIterator itr = begin; itr != end; ++itr) {
+					insert(*itr);
+				}
+			}
+
+			void insert_hash(const util::Hash128 &hash) {
+				for (uint32_t i = 0; i < hash_count_; ++i) {
+					const uint64_t bit_index = bloom_index(hash, i, table_size_);
+					const word_type mask = word_type{1} << (bit_index % WORD_BITS);
+
+					std::atomic<word_type> &word = word_array_[bit_index / WORD_BITS];
+					// A set bit needs no exclusive ownership of the line
+					if ((word.load(std::memory_order_relaxed) & mask) == 0) {
+						word.fetch_or(mask, std::memory_order_relaxed);
+					}
+				}
+				count_insertion();
+			}
+
+		public:
+			bool contains(const uint8_t *key_begin, size_t length) const {
+				return contains_hash(Hasher::hash(key_begin, length, random_seed_));
+			}
+
+			template<typename T>
+			bool contains(const T &t) const {
+				const std::span<const uint8_t> bytes = key_bytes(t);
+				return contains(bytes.data(), bytes.size());
+			}
+
+			bool contains_hash(const util::Hash128 &hash) const {
+				for (uint32_t i = 0; i < hash_count_; ++i) {
+					const uint64_t bit_index = bloom_index(hash, i, table_size_);
+					const word_type mask = word_type{1} << (bit_index % WORD_BITS);
+					if ((word_array_[bit_index / WORD_BITS].load(std::memory_order_relaxed) & mask) == 0) { return false; }
+				}
+				return true;
+			}
+
+		public:
+			bool valid() const {
+				return table_size_ != 0;
+			}
+
+			/*!
+			 * @brief Drop all keys, which is not expected to run alongside insertion
+			 */
+			void clear() {
+				for (uint64_t i = 0; i < word_amount_; ++i) { word_array_[i].store(0, std::memory_order_relaxed); }
+				for (uint32_t i = 0; i < COUNTER_AMOUNT; ++i) { counter_array_[i].value.store(0, std::memory_order_relaxed); }
+			}
+
+			/*!
+			 * @brief The amount of bits in the table
+			 */
+			uint64_t size() const {
+				return table_size_;
+			}
+
+			/*!
+			 * @brief The sum of counters of all threads, which lags behind writers still running
+			 */
+			uint64_t element_count() const {
+				uint64_t res = 0;
+				for (uint32_t i = 0; i < COUNTER_AMOUNT; ++i) { res += counter_array_[i].value.load(std::memory_order_relaxed); }
+				return res;
+			}
+
+			uint32_t hash_count() const {
+				return hash_count_;
+			}
+
+			double effective_fpp() const {
+				return std::pow(1.0 - std::exp(-1.0 * hash_count_ * element_count() / table_size_), 1.0 * hash_count_);
+			}
+
+		private:
+			void count_insertion() {
+				const uint32_t tid = memory::get_tid();
+				if (tid < COUNTER_AMOUNT - 1) {
+					// Only the owner thread writes its counter
+					std::atomic<uint64_t> &value = counter_array_[tid].value;
+					value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+				}
+				else {
+					counter_array_[COUNTER_AMOUNT - 1].value.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		};
+
+	}
+
+}
+
+#endif//ALGORITHM_STRUCTURE_CONCURRENT_BLOOM_FILTER_H
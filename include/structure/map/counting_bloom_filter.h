@@ -0,0 +1,191 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_STRUCTURE_COUNTING_BLOOM_FILTER_H
+#define ALGORITHM_STRUCTURE_COUNTING_BLOOM_FILTER_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <util/hash.h>
+#include <structure/map/bloom_filter.h>
+
+namespace algorithm::structure {
+
+	inline namespace bloom_filter {
+
+		/*!
+		 * @brief Bloom filter with a 4-bit counter in place of each bit, so that keys can be erased.
+		 * Counters saturate at 15 and stay there, since their true value is lost,
+		 * which keeps erasing from ever introducing false negatives.
+		 * It takes 4 times the memory of BloomFilter with the same parameter.
+		 */
+		template<util::HasherConcept Hasher = util::FastHasher>
+		class CountingBloomFilter {
+		public:
+			using hasher_type = Hasher;
+
+			static constexpr uint8_t COUNTER_BITS = 4;
+
+			static constexpr uint8_t MAX_COUNTER = (1 << COUNTER_BITS) - 1;
+
+		private:
+			/// Two counters per byte, where the even one takes the low half
+			std::vector<uint8_t> counter_table_;
+			uint32_t hash_count_;
+			uint64_t table_size_;
+			uint64_t element_count_;
+			uint64_t random_seed_;
+
+		public:
+			CountingBloomFilter(): hash_count_(0), table_size_(0), element_count_(0), random_seed_(0) {}
+
+			explicit CountingBloomFilter(const BloomParameter &p): hash_count_(p.optimal_parameters.number_of_hashes),
+			                                                       table_size_(p.optimal_parameters.table_size),
+			                                                       element_count_(0),
+			                                                       random_seed_((p.random_seed * 0xA5A5A5A5) + 1) {
+				counter_table_.resize((table_size_ + 1) / 2, 0);
+			}
+
+		public:
+			void insert(const uint8_t *key_begin, size_t length) {
+				insert_hash(Hasher::hash(key_begin, length, random_seed_));
+			}
+
+			template<typename T>
+			void insert(const T &t) {
+				const std::span<const uint8_t> bytes = key_bytes(t);
+				insert(bytes.data(), bytes.size());
+			}
+
+			template<typename InputIterator>
+			void insert(const InputIterator begin, const InputIterator end) {
+				for (InputIterator itr = begin; itr != end; ++itr) {
+					insert(*itr);
+				}
+			}
+
+			void insert_hash(const util::Hash128 &hash) {
+				for (uint32_t i = 0; i < hash_count_; ++i) {
+					const uint64_t index = bloom_index(hash, i, table_size_);
+					const uint8_t  count = get_counter(index);
+					if (count != MAX_COUNTER) { set_counter(index, count + 1); }
+				}
+				++element_count_;
+			}
+
+		public:
+			/*!
+			 * @brief Erase a key which has been inserted. Erasing a key never inserted may erase others.
+			 * @return false if the key is certainly absent, where nothing is changed
+			 */
+			bool erase(const uint8_t *key_begin, size_t length) {
+				return erase_hash(Hasher::hash(key_begin, length, random_seed_));
+			}
+
+			template<typename T>
+			bool erase(const T &t) {
+				const std::span<const uint8_t> bytes = key_bytes(t);
+				return erase(bytes.data(), bytes.size());
+			}
+
+			bool erase_hash(const util::Hash128 &hash) {
+				if (!contains_hash(hash)) { return false; }
+
+				for (uint32_t i = 0; i < hash_count_; ++i) {
+					const uint64_t index = bloom_index(hash, i, table_size_);
+					const uint8_t  count = get_counter(index);
+					// A key may take a counter more than once, which has been counted as many times
+					if (count != MAX_COUNTER && count != 0) { set_counter(index, count - 1); }
+				}
+				--element_count_;
+				return true;
+			}
+
+		public:
+			bool contains(const uint8_t *key_begin, size_t length) const {
+				return contains_hash(Hasher::hash(key_begin, length, random_seed_));
+			}
+
+			template<typename T>
+			bool contains(const T &t) const {
+				const std::span<const uint8_t> bytes = key_bytes(t);
+				return contains(bytes.data(), bytes.size());
+			}
+
+			bool contains_hash(const util::Hash128 &hash) const {
+				for (uint32_t i = 0; i < hash_count_; ++i) {
+					if (get_counter(bloom_index(hash, i, table_size_)) == 0) { return false; }
+				}
+				return true;
+			}
+
+			/*!
+			 * @brief An upper bound of the times a key has been inserted, i.e. the least of its counters
+			 */
+			template<typename T>
+			uint8_t count(const T &t) const {
+				const std::span<const uint8_t> bytes = key_bytes(t);
+				const util::Hash128 hash = Hasher::hash(bytes.data(), bytes.size(), random_seed_);
+
+				uint8_t res = MAX_COUNTER;
+				for (uint32_t i = 0; i < hash_count_; ++i) {
+					res = std::min(res, get_counter(bloom_index(hash, i, table_size_)));
+				}
+				return res;
+			}
+
+		public:
+			bool valid() const {
+				return table_size_ != 0;
+			}
+
+			void clear() {
+				std::fill(counter_table_.begin(), counter_table_.end(), static_cast<uint8_t>(0));
+				element_count_ = 0;
+			}
+
+			/*!
+			 * @brief The amount of counters
+			 */
+			uint64_t size() const {
+				return table_size_;
+			}
+
+			uint64_t element_count() const {
+				return element_count_;
+			}
+
+			uint32_t hash_count() const {
+				return hash_count_;
+			}
+
+			double effective_fpp() const {
+				return std::pow(1.0 - std::exp(-1.0 * hash_count_ * element_count_ / table_size_), 1.0 * hash_count_);
+			}
+
+		private:
+			uint8_t get_counter(uint64_t index) const {
+				return (counter_table_[index / 2] >> ((index % 2) * COUNTER_BITS)) & MAX_COUNTER;
+			}
+
+			void set_counter(uint64_t index, uint8_t count) {
+				const uint8_t shift = (index % 2) * COUNTER_BITS;
+				uint8_t &cell = counter_table_[index / 2];
+				cell = static_cast<uint8_t>((cell & ~(MAX_COUNTER << shift)) | (count << shift));
+			}
+		};
+
+	}
+
+}
+
+#endif//ALGORITHM_STRUCTURE_COUNTING_BLOOM_FILTER_H
@@ -0,0 +1,174 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_STRUCTURE_SCALABLE_BLOOM_FILTER_H
+#define ALGORITHM_STRUCTURE_SCALABLE_BLOOM_FILTER_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <util/hash.h>
+#include <structure/map/bloom_filter.h>
+
+namespace algorithm::structure {
+
+	inline namespace bloom_filter {
+
+		/*!
+		 * @brief Bloom filter growing with its keys instead of being sized up front.
+		 * Once the newest slice has taken its projected amount of keys, a slice `growth` times larger
+		 * is appended, whose false positive probability is `tightening` times the previous one.
+		 * With the first slice at p * (1 - tightening), the compound probability stays below p.
+		 * A key is hashed once and probed against all slices.
+		 */
+		template<util::HasherConcept Hasher = util::FastHasher>
+		class ScalableBloomFilter {
+		public:
+			using hasher_type = Hasher;
+
+			using slice_type = BloomFilter<Hasher>;
+
+		private:
+			std::vector<slice_type> slice_list_;
+			/// Projected amount of keys of the first slice
+			uint64_t initial_capacity_;
+			/// Projected amount of keys of the newest slice
+			uint64_t slice_capacity_;
+			/// False positive probability of the newest slice
+			double slice_fpp_;
+			double growth_;
+			double tightening_;
+			double desired_false_positive_probability_;
+			uint64_t random_seed_;
+
+		public:
+			ScalableBloomFilter(): initial_capacity_(0), slice_capacity_(0), slice_fpp_(0.0), growth_(0.0), tightening_(0.0),
+			                       desired_false_positive_probability_(0.0), random_seed_(0) {}
+
+			/*!
+			 * @param p The parameter of the first slice, whose probability is taken as the compound bound
+			 * @param growth The ratio of capacity between adjacent slices
+			 * @param tightening The ratio of false positive probability between adjacent slices, within (0, 1)
+			 */
+			explicit ScalableBloomFilter(const BloomParameter &p, double growth = 2.0, double tightening = 0.5):
+			        initial_capacity_(p.projected_element_count),
+			        slice_capacity_(p.projected_element_count),
+			        slice_fpp_(p.false_positive_probability * (1.0 - tightening)),
+			        growth_(growth),
+			        tightening_(tightening),
+			        desired_false_positive_probability_(p.false_positive_probability),
+			        random_seed_((p.random_seed * 0xA5A5A5A5) + 1) {
+				append_slice();
+			}
+
+		public:
+			void insert(const uint8_t *key_begin, size_t length) {
+				insert_hash(Hasher::hash(key_begin, length, random_seed_));
+			}
+
+			template<typename T>
+			void insert(const T &t) {
+				const std::span<const uint8_t> bytes = key_bytes(t);
+				insert(bytes.data(), bytes.size());
+			}
+
+			template<typename InputIterator>
+			void insert(const InputIterator begin, const InputIterator end) {
+				for (InputIterator itr = begin; itr != end; ++itr) {
+					insert(*itr);
+				}
+			}
+
+			void insert_hash(const util::Hash128 &hash) {
+				if (slice_list_.back().element_count() >= slice_capacity_) {
+					slice_capacity_ = static_cast<uint64_t>(std::ceil(slice_capacity_ * growth_));
+					slice_fpp_ *= tightening_;
+					append_slice();
+				}
+				slice_list_.back().insert_hash(hash);
+			}
+
+		public:
+			bool contains(const uint8_t *key_begin, size_t length) const {
+				return contains_hash(Hasher::hash(key_begin, length, random_seed_));
+			}
+
+			template<typename T>
+			bool contains(const T &t) const {
+				const std::span<const uint8_t> bytes = key_bytes(t);
+				return contains(bytes.data(), bytes.size());
+			}
+
+			bool contains_hash(const util::Hash128 &hash) const {
+				// The newest slice is the largest one, holding most of the keys
+				for (auto itr = slice_list_.rbegin(); itr != slice_list_.rend(); ++itr) {
+					if (itr->contains_hash(hash)) { return true; }
+				}
+				return false;
+			}
+
+		public:
+			bool valid() const {
+				return !slice_list_.empty();
+			}
+
+			/*!
+			 * @brief Drop all keys and slices but the first one
+			 */
+			void clear() {
+				slice_list_.resize(1);
+				slice_list_.front().clear();
+				slice_capacity_ = initial_capacity_;
+				slice_fpp_      = desired_false_positive_probability_ * (1.0 - tightening_);
+			}
+
+			/*!
+			 * @brief The amount of bits of all slices
+			 */
+			uint64_t size() const {
+				uint64_t res = 0;
+				for (const slice_type &slice: slice_list_) { res += slice.size(); }
+				return res;
+			}
+
+			uint64_t element_count() const {
+				uint64_t res = 0;
+				for (const slice_type &slice: slice_list_) { res += slice.element_count(); }
+				return res;
+			}
+
+			size_t slice_count() const {
+				return slice_list_.size();
+			}
+
+			const slice_type &slice(size_t index) const {
+				return slice_list_[index];
+			}
+
+			double effective_fpp() const {
+				double negative = 1.0;
+				for (const slice_type &slice: slice_list_) { negative *= 1.0 - slice.effective_fpp(); }
+				return 1.0 - negative;
+			}
+
+		private:
+			void append_slice() {
+				BloomParameter parameter;
+				parameter.projected_element_count    = slice_capacity_;
+				parameter.false_positive_probability = slice_fpp_;
+				parameter.compute_optimal_parameters();
+				slice_list_.emplace_back(parameter);
+			}
+		};
+
+	}
+
+}
+
+#endif//ALGORITHM_STRUCTURE_SCALABLE_BLOOM_FILTER_H
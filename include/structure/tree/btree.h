@@ -1,5 +1,5 @@
 /*
- * @author: BL-GS 
+ * @author: BL-GS
  * @date:   2023/5/11
  */
 
@@ -9,10 +9,12 @@
 
 #include <cstddef>
 #include <algorithm>
+#include <functional>
+#include <tuple>
 #include <utility>
 
-#include <util/compare.h>
 #include <allocator/allocator.h>
+#include <algorithm/search/binary_search.h>
 
 namespace algorithm::structure {
 
@@ -39,13 +41,21 @@ namespace algorithm::structure {
 			size_t size() const {
 				return size_;
 			}
+
+			bool is_leaf() const {
+				return child_ptr_[0] == nullptr;
+			}
 		};
 
-		template<class Value, size_t WIDTH = 8, class Cmp = util::Less, class Allocator = allocator::BaseAllocator>
+		/*!
+		 * @brief B-tree set, where full nodes are split on the way down so that an insertion never walks back up.
+		 * For an ordered map with scans, see BPlusTree in structure/map/bptree.h.
+		 */
+		template<class Value, size_t WIDTH = 8, class Cmp = std::less<Value>, class Allocator = allocator::ReserveAllocator<Value>>
 		    requires allocator::AllocatorConcept<Allocator>
 		class BTree {
 		public:
-			using Self = BTree<Value, WIDTH, Allocator>;
+			using Self = BTree<Value, WIDTH, Cmp, Allocator>;
 
 			using ValueType     = std::remove_reference_t<Value>;
 			using ReferenceType = ValueType &;
@@ -53,66 +63,156 @@ namespace algorithm::structure {
 
 			using NodeType      = BTreeNode<ValueType, WIDTH>;
 
-			using AllocatorType = Allocator;
+			using AllocatorType = Allocator::template Rebind<NodeType>::type;
 
+			static_assert(WIDTH >= 3, "A node should hold at least 3 values");
 
 			static constexpr size_t MAX_NODE_CAPACITY = WIDTH;
-			static constexpr size_t MIN_NODE_CAPACITY = (WIDTH + 1) / 2;
+			static constexpr size_t MIN_NODE_CAPACITY = (WIDTH - 1) / 2;
 
 		private:
-			NodeType root_node_;
+			NodeType *root_node_ptr_;
 
 			size_t size_;
 
+			[[no_unique_address]] Cmp cmp_;
+
 			AllocatorType allocator_;
 
 		public:
-			BTree() = default;
+			BTree(): root_node_ptr_(nullptr), size_(0) {}
+
+			BTree(const BTree &other) = delete;
+
+			~BTree() {
+				clear();
+			}
 
 		public:
 			bool insert(const ValueType &new_value) {
-				auto [found, node_ptr, pos] = inner_find(new_value);
+				if (root_node_ptr_ == nullptr) { root_node_ptr_ = allocator_.construct(); }
 
-				if (found) { return false; }
+				if (root_node_ptr_->size() == MAX_NODE_CAPACITY) {
+					NodeType *new_root_ptr = allocator_.construct();
+					new_root_ptr->child_ptr_[0] = root_node_ptr_;
+					root_node_ptr_ = new_root_ptr;
+					split_child(new_root_ptr, 0);
+				}
 
-				if (node_ptr.size() == MAX_NODE_CAPACITY) {
+				NodeType *node_ptr = root_node_ptr_;
+				while (true) {
+					size_t pos = lower_bound(node_ptr, new_value);
+					if (pos < node_ptr->size() && !cmp_(new_value, node_ptr->value_[pos])) { return false; }
+
+					if (node_ptr->is_leaf()) {
+						std::move_backward(node_ptr->value_ + pos, node_ptr->value_ + node_ptr->size_, node_ptr->value_ + node_ptr->size_ + 1);
+						node_ptr->value_[pos] = new_value;
+						++node_ptr->size_;
+						++size_;
+						return true;
+					}
 
-				}
-				else {
-					for (size_t i = node_ptr.size(); i > pos; --i) {
-						node_ptr->value_[i] = node_ptr->value_[i - 1];
+					if (node_ptr->child_ptr_[pos]->size() == MAX_NODE_CAPACITY) {
+						split_child(node_ptr, pos);
+						// The median moved up to pos decides the side to go
+						if (!cmp_(new_value, node_ptr->value_[pos])) {
+							if (!cmp_(node_ptr->value_[pos], new_value)) { return false; }
+							++pos;
+						}
 					}
-					node_ptr->value_[pos] = new_value;
-					++node_ptr->size_;
+					node_ptr = node_ptr->child_ptr_[pos];
 				}
 			}
 
+			bool contains(const ValueType &value) const {
+				return std::get<0>(inner_find(value));
+			}
+
+			size_t size() const {
+				return size_;
+			}
+
+			bool empty() const {
+				return size_ == 0;
+			}
+
+			void clear() {
+				if (root_node_ptr_ != nullptr) { destroy(root_node_ptr_); }
+				root_node_ptr_ = nullptr;
+				size_          = 0;
+			}
+
+			/*!
+			 * @brief Visit values in order by func(value)
+			 */
+			template<class Func>
+			void for_each(Func &&func) const {
+				if (root_node_ptr_ != nullptr) { for_each(root_node_ptr_, func); }
+			}
+
 		private:
+			size_t lower_bound(const NodeType *node_ptr, const ValueType &value) const {
+				return search::lower_bound(node_ptr->value_, node_ptr->value_ + node_ptr->size_, value, cmp_) - node_ptr->value_;
+			}
+
+			/*!
+			 * @brief Split the full child at pos in halves, with the median moved up into the parent
+			 */
+			void split_child(NodeType *parent_ptr, size_t pos) {
+				NodeType *left_ptr  = parent_ptr->child_ptr_[pos];
+				NodeType *right_ptr = allocator_.construct();
+
+				constexpr size_t MEDIAN = MAX_NODE_CAPACITY / 2;
+				right_ptr->size_ = MAX_NODE_CAPACITY - MEDIAN - 1;
+				std::move(left_ptr->value_ + MEDIAN + 1, left_ptr->value_ + MAX_NODE_CAPACITY, right_ptr->value_);
+				if (!left_ptr->is_leaf()) {
+					std::copy(left_ptr->child_ptr_ + MEDIAN + 1, left_ptr->child_ptr_ + MAX_NODE_CAPACITY + 1, right_ptr->child_ptr_);
+					std::fill(left_ptr->child_ptr_ + MEDIAN + 1, left_ptr->child_ptr_ + MAX_NODE_CAPACITY + 1, nullptr);
+				}
+				left_ptr->size_ = MEDIAN;
+
+				std::move_backward(parent_ptr->value_ + pos, parent_ptr->value_ + parent_ptr->size_, parent_ptr->value_ + parent_ptr->size_ + 1);
+				std::move_backward(parent_ptr->child_ptr_ + pos + 1, parent_ptr->child_ptr_ + parent_ptr->size_ + 1, parent_ptr->child_ptr_ + parent_ptr->size_ + 2);
+				parent_ptr->value_[pos]         = std::move(left_ptr->value_[MEDIAN]);
+				parent_ptr->child_ptr_[pos + 1] = right_ptr;
+				++parent_ptr->size_;
+			}
+
+			/*!
+			 * @return Whether the value is found, the node where it is or it stops, and the position in that node
+			 */
 			std::tuple<bool, NodeType *, size_t> inner_find(NodeType *cur_node_ptr, const ValueType &value) const {
-				for (size_t i = 0; i < cur_node_ptr->size(); ++i) {
-					if (value == cur_node_ptr->value_[i]) {
-						return { true, cur_node_ptr, i };
+				while (true) {
+					const size_t pos = lower_bound(cur_node_ptr, value);
+					if (pos < cur_node_ptr->size() && !cmp_(value, cur_node_ptr->value_[pos])) {
+						return { true, cur_node_ptr, pos };
 					}
-					else if (!Cmp(value, cur_node_ptr->value_[i])) {
-						NodeType *next_ptr = cur_node_ptr->child_ptr_[i];
-						if (next_ptr == nullptr) {
-							return { false, cur_node_ptr, i };
-						}
-
-						return inner_find(cur_node_ptr->child_ptr_[i], value);
+					if (cur_node_ptr->is_leaf()) {
+						return { false, cur_node_ptr, pos };
 					}
+					cur_node_ptr = cur_node_ptr->child_ptr_[pos];
 				}
+			}
 
-				NodeType *next_ptr = cur_node_ptr->child_ptr_[cur_node_ptr->size()];
-				if (next_ptr == nullptr) {
-					return { false, cur_node_ptr, i };
-				}
+			std::tuple<bool, NodeType *, size_t> inner_find(const ValueType &value) const {
+				if (root_node_ptr_ == nullptr) { return { false, nullptr, 0 }; }
+				return inner_find(root_node_ptr_, value);
+			}
 
-				return inner_find(cur_node_ptr->child_ptr_[cur_node_ptr->size()], value);
+			template<class Func>
+			static void for_each(const NodeType *node_ptr, Func &func) {
+				for (size_t i = 0; i < node_ptr->size(); ++i) {
+					if (!node_ptr->is_leaf()) { for_each(node_ptr->child_ptr_[i], func); }
+					func(node_ptr->value_[i]);
+				}
+				if (!node_ptr->is_leaf()) { for_each(node_ptr->child_ptr_[node_ptr->size()], func); }
 			}
 
-			std::pair<NodeType *, size_t> inner_find(const ValueType &value) const {
-				return inner_find(&root_node_, value);
+			void destroy(NodeType *node_ptr) {
+				if (!node_ptr->is_leaf()) {
+					for (size_t i = 0; i <= node_ptr->size(); ++i) { destroy(node_ptr->child_ptr_[i]); }
+				}
+				allocator_.deconstruct(node_ptr);
 			}
 
 		};
@@ -0,0 +1,458 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_THREAD_THREAD_POOL_H
+#define ALGORITHM_THREAD_THREAD_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <memory/memory.h>
+#include <thread/cpu_bind_thread.h>
+#include <thread/numa_bind_thread.h>
+#include <thread/work_steal_deque.h>
+
+namespace algorithm::thread {
+
+	/*!
+	 * @brief Counter of unfinished tasks, which can be waited on until all are done.
+	 */
+	class WaitGroup {
+	private:
+		std::atomic<int64_t> count_;
+
+		std::mutex mutex_;
+
+		std::condition_variable done_cv_;
+
+	public:
+		WaitGroup(): count_(0) {}
+
+		WaitGroup(const WaitGroup &other) = delete;
+
+		~WaitGroup() = default;
+
+	public:
+		void add(int64_t amount = 1) {
+			count_.fetch_add(amount, std::memory_order::acq_rel);
+		}
+
+		void done() {
+			// Decrease under lock, so that the group is never destroyed by a waiter during notification
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (count_.fetch_sub(1, std::memory_order::acq_rel) == 1) {
+				done_cv_.notify_all();
+			}
+		}
+
+		[[nodiscard]] bool is_done() const {
+			return count_.load(std::memory_order::acquire) == 0;
+		}
+
+		void wait() {
+			std::unique_lock<std::mutex> lock(mutex_);
+			done_cv_.wait(lock, [this] { return is_done(); });
+		}
+
+		template<class Rep, class Period>
+		bool wait_for(const std::chrono::duration<Rep, Period> &timeout) {
+			std::unique_lock<std::mutex> lock(mutex_);
+			return done_cv_.wait_for(lock, timeout, [this] { return is_done(); });
+		}
+	};
+
+	/*!
+	 * @brief Persistent pool of workers pinned to cpus, each with a Chase-Lev deque.
+	 * Tasks spawned by workers are pushed to their own deques, while others go through a shared queue.
+	 * Idle workers steal from victims on the same NUMA node first, then from the others.
+	 * Threads waiting for a group execute pending tasks meanwhile, so that nested parallelism never deadlocks.
+	 * @note Tasks should not throw, except those submitted with futures.
+	 */
+	class ThreadPool {
+	public:
+		/// Rounds of spinning before an idle worker sleeps
+		static constexpr size_t SPIN_ROUND = 64;
+		/// The max interval of sleep, as a safety net for wake-ups
+		static constexpr auto SLEEP_INTERVAL = std::chrono::milliseconds(10);
+		/// The interval a waiter blocks on a group before looking for tasks again
+		static constexpr auto WAIT_INTERVAL  = std::chrono::microseconds(100);
+
+	private:
+		struct TaskBase {
+			virtual ~TaskBase() = default;
+
+			virtual void execute() = 0;
+		};
+
+		template<class Func>
+		struct Task: public TaskBase {
+			Func func_;
+
+			explicit Task(Func &&func): func_(std::move(func)) {}
+
+			void execute() override { func_(); }
+		};
+
+		struct alignas(memory::CACHE_LINE_SIZE) Worker {
+			WorkStealDeque<TaskBase *> deque_;
+			/// The node the worker runs on
+			int numa_id_ = 0;
+			/// Workers to steal from, those on the same node first
+			std::vector<size_t> victim_array_;
+		};
+
+		struct WorkerContext {
+			ThreadPool *pool_ptr_ = nullptr;
+
+			size_t worker_idx_ = 0;
+		};
+
+	private:
+		std::vector<std::unique_ptr<Worker>> worker_array_;
+
+		std::vector<std::unique_ptr<CPUBindThread>> cpu_thread_array_;
+
+		std::vector<std::unique_ptr<NUMABindThread>> numa_thread_array_;
+		/// Tasks submitted by threads other than workers
+		std::mutex inject_mutex_;
+
+		std::deque<TaskBase *> inject_queue_;
+
+		std::atomic<size_t> inject_size_;
+
+		std::mutex sleep_mutex_;
+
+		std::condition_variable sleep_cv_;
+
+		std::atomic<size_t> sleeping_amount_;
+
+		std::atomic<size_t> ready_amount_;
+
+		std::atomic<bool> started_;
+
+		std::atomic<bool> stop_;
+
+	public:
+		/*!
+		 * @brief Create workers pinned to spare cpus by ThreadConfig::allocate_cpu
+		 * @param worker_amount The amount of workers
+		 */
+		explicit ThreadPool(size_t worker_amount = std::thread::hardware_concurrency()) {
+			init_worker(worker_amount);
+			for (size_t worker_idx = 0; worker_idx < worker_array_.size(); ++worker_idx) {
+				cpu_thread_array_.emplace_back(std::make_unique<CPUBindThread>(
+				        [this, worker_idx] { worker_loop(worker_idx); }
+				));
+			}
+			start();
+		}
+
+		/*!
+		 * @brief Create workers pinned to spare cpus on specific node by ThreadConfig::allocate_cpu_on_node
+		 * @param worker_amount The amount of workers
+		 * @param numa_id The id of numa node
+		 */
+		ThreadPool(size_t worker_amount, int numa_id) {
+			init_worker(worker_amount);
+			for (size_t worker_idx = 0; worker_idx < worker_array_.size(); ++worker_idx) {
+				numa_thread_array_.emplace_back(std::make_unique<NUMABindThread>(
+				        numa_id, [this, worker_idx] { worker_loop(worker_idx); }
+				));
+			}
+			start();
+		}
+
+		ThreadPool(const ThreadPool &other) = delete;
+
+		~ThreadPool() {
+			{
+				std::lock_guard<std::mutex> lock(sleep_mutex_);
+				stop_.store(true, std::memory_order::release);
+				sleep_cv_.notify_all();
+			}
+			for (auto &thread_ptr: cpu_thread_array_) { thread_ptr->get_origin_thread().join(); }
+			for (auto &thread_ptr: numa_thread_array_) { thread_ptr->get_origin_thread().join(); }
+		}
+
+	public:
+		/*!
+		 * @brief Execute the function asynchronously
+		 * @return The future of result
+		 */
+		template<class Func>
+		auto submit(Func &&func) -> std::future<std::invoke_result_t<std::decay_t<Func>>> {
+			using ResultType = std::invoke_result_t<std::decay_t<Func>>;
+
+			std::packaged_task<ResultType()> packaged_task(std::forward<Func>(func));
+			std::future<ResultType> res_future = packaged_task.get_future();
+			spawn([task = std::move(packaged_task)]() mutable { task(); });
+			return res_future;
+		}
+
+		/*!
+		 * @brief Execute the function asynchronously as a member of group
+		 */
+		template<class Func>
+		void submit(WaitGroup &group, Func &&func) {
+			group.add(1);
+			spawn([&group, inner_func = std::forward<Func>(func)]() mutable {
+				inner_func();
+				group.done();
+			});
+		}
+
+		/*!
+		 * @brief Wait until all tasks of group are done, with pending tasks executed meanwhile
+		 */
+		void wait(WaitGroup &group) {
+			const WorkerContext &context = get_context();
+			while (!group.is_done()) {
+				TaskBase *task_ptr = (context.pool_ptr_ == this) ? find_task(context.worker_idx_) : find_task_outside();
+				if (task_ptr != nullptr) {
+					run_task(task_ptr);
+				}
+				else {
+					group.wait_for(WAIT_INTERVAL);
+				}
+			}
+			// Synchronize with the last done()
+			group.wait();
+		}
+
+		/*!
+		 * @brief Apply the function on [start, end) in parallel, and return after all are done.
+		 * @param func Invoked with either an index or a range [chunk_start, chunk_end)
+		 * @param grain_size The size of chunk per task, which is decided by the amount of workers if zero
+		 */
+		template<class Func>
+		void parallel_for(size_t start, size_t end, Func &&func, size_t grain_size = 0) {
+			if (start >= end) { return; }
+
+			if (grain_size == 0) {
+				grain_size = std::max<size_t>(1, (end - start) / (worker_array_.size() * 4));
+			}
+
+			auto invoke_chunk = [&func](size_t chunk_start, size_t chunk_end) {
+				if constexpr (std::is_invocable_v<Func &, size_t, size_t>) {
+					func(chunk_start, chunk_end);
+				}
+				else {
+					for (size_t idx = chunk_start; idx < chunk_end; ++idx) { func(idx); }
+				}
+			};
+
+			WaitGroup group;
+			const size_t first_end = std::min(end, start + grain_size);
+			for (size_t chunk_start = first_end; chunk_start < end; chunk_start += grain_size) {
+				const size_t chunk_end = std::min(end, chunk_start + grain_size);
+				submit(group, [&invoke_chunk, chunk_start, chunk_end] { invoke_chunk(chunk_start, chunk_end); });
+			}
+			// The caller takes the first chunk itself
+			invoke_chunk(start, first_end);
+			wait(group);
+		}
+
+	public:
+		[[nodiscard]] size_t get_worker_amount() const {
+			return worker_array_.size();
+		}
+
+		[[nodiscard]] int get_worker_numa_id(size_t worker_idx) const {
+			return worker_array_[worker_idx]->numa_id_;
+		}
+
+		/*!
+		 * @brief Acquire the index of the current worker, or -1 if the caller is not a worker of this pool
+		 */
+		[[nodiscard]] int get_current_worker_idx() const {
+			const WorkerContext &context = get_context();
+			return (context.pool_ptr_ == this) ? static_cast<int>(context.worker_idx_) : -1;
+		}
+
+	private:
+		void init_worker(size_t worker_amount) {
+			inject_size_.store(0, std::memory_order::relaxed);
+			sleeping_amount_.store(0, std::memory_order::relaxed);
+			ready_amount_.store(0, std::memory_order::relaxed);
+			started_.store(false, std::memory_order::relaxed);
+			stop_.store(false, std::memory_order::relaxed);
+
+			worker_amount = std::max<size_t>(worker_amount, 1);
+			for (size_t worker_idx = 0; worker_idx < worker_amount; ++worker_idx) {
+				worker_array_.emplace_back(std::make_unique<Worker>());
+			}
+		}
+
+		/*!
+		 * @brief Wait for all workers to locate their nodes, and then decide the order of victims
+		 */
+		void start() {
+			const size_t worker_amount = worker_array_.size();
+			while (ready_amount_.load(std::memory_order::acquire) != worker_amount) {
+				std::this_thread::yield();
+			}
+
+			for (size_t worker_idx = 0; worker_idx < worker_amount; ++worker_idx) {
+				Worker &worker = *worker_array_[worker_idx];
+				// Rotate from the next worker, so that thieves spread over victims
+				for (size_t offset = 1; offset < worker_amount; ++offset) {
+					size_t victim_idx = (worker_idx + offset) % worker_amount;
+					if (worker_array_[victim_idx]->numa_id_ == worker.numa_id_) {
+						worker.victim_array_.push_back(victim_idx);
+					}
+				}
+				for (size_t offset = 1; offset < worker_amount; ++offset) {
+					size_t victim_idx = (worker_idx + offset) % worker_amount;
+					if (worker_array_[victim_idx]->numa_id_ != worker.numa_id_) {
+						worker.victim_array_.push_back(victim_idx);
+					}
+				}
+			}
+			started_.store(true, std::memory_order::release);
+		}
+
+		void worker_loop(size_t worker_idx) {
+			worker_array_[worker_idx]->numa_id_ = static_cast<int>(memory::get_cpu_numa_id());
+			get_context() = { this, worker_idx };
+
+			ready_amount_.fetch_add(1, std::memory_order::acq_rel);
+			while (!started_.load(std::memory_order::acquire)) {
+				std::this_thread::yield();
+			}
+
+			size_t idle_round = 0;
+			while (true) {
+				TaskBase *task_ptr = find_task(worker_idx);
+				if (task_ptr != nullptr) {
+					run_task(task_ptr);
+					idle_round = 0;
+					continue;
+				}
+
+				// Exit only if no task is left
+				if (stop_.load(std::memory_order::acquire)) { break; }
+
+				if (++idle_round < SPIN_ROUND) {
+					memory::pause();
+				}
+				else {
+					sleep();
+					idle_round = 0;
+				}
+			}
+
+			get_context() = {};
+		}
+
+		template<class Func>
+		void spawn(Func &&func) {
+			TaskBase *task_ptr = new Task<std::decay_t<Func>>(std::forward<Func>(func));
+
+			const WorkerContext &context = get_context();
+			if (context.pool_ptr_ == this) {
+				worker_array_[context.worker_idx_]->deque_.push(task_ptr);
+			}
+			else {
+				std::lock_guard<std::mutex> lock(inject_mutex_);
+				inject_queue_.push_back(task_ptr);
+				inject_size_.fetch_add(1, std::memory_order::release);
+			}
+			wake_worker();
+		}
+
+		TaskBase *find_task(size_t worker_idx) {
+			Worker &worker = *worker_array_[worker_idx];
+			if (auto task_opt = worker.deque_.pop()) { return *task_opt; }
+
+			if (TaskBase *task_ptr = pop_inject(); task_ptr != nullptr) { return task_ptr; }
+
+			for (size_t victim_idx: worker.victim_array_) {
+				if (auto task_opt = worker_array_[victim_idx]->deque_.steal()) { return *task_opt; }
+			}
+			return nullptr;
+		}
+
+		TaskBase *find_task_outside() {
+			if (TaskBase *task_ptr = pop_inject(); task_ptr != nullptr) { return task_ptr; }
+
+			for (auto &worker_ptr: worker_array_) {
+				if (auto task_opt = worker_ptr->deque_.steal()) { return *task_opt; }
+			}
+			return nullptr;
+		}
+
+		TaskBase *pop_inject() {
+			if (inject_size_.load(std::memory_order::acquire) == 0) { return nullptr; }
+
+			std::lock_guard<std::mutex> lock(inject_mutex_);
+			if (inject_queue_.empty()) { return nullptr; }
+
+			TaskBase *task_ptr = inject_queue_.front();
+			inject_queue_.pop_front();
+			inject_size_.fetch_sub(1, std::memory_order::release);
+			return task_ptr;
+		}
+
+		[[nodiscard]] bool has_task() const {
+			if (inject_size_.load(std::memory_order::relaxed) != 0) { return true; }
+			return std::any_of(worker_array_.begin(), worker_array_.end(), [](const auto &worker_ptr) {
+				return !worker_ptr->deque_.empty();
+			});
+		}
+
+		void sleep() {
+			std::unique_lock<std::mutex> lock(sleep_mutex_);
+			sleeping_amount_.fetch_add(1, std::memory_order::seq_cst);
+			// Pairs with the fence in wake_worker(), so that either the task or the sleeper is seen
+			std::atomic_thread_fence(std::memory_order::seq_cst);
+			if (!has_task() && !stop_.load(std::memory_order::acquire)) {
+				sleep_cv_.wait_for(lock, SLEEP_INTERVAL);
+			}
+			sleeping_amount_.fetch_sub(1, std::memory_order::relaxed);
+		}
+
+		void wake_worker() {
+			std::atomic_thread_fence(std::memory_order::seq_cst);
+			if (sleeping_amount_.load(std::memory_order::relaxed) != 0) {
+				std::lock_guard<std::mutex> lock(sleep_mutex_);
+				sleep_cv_.notify_one();
+			}
+		}
+
+		static void run_task(TaskBase *task_ptr) {
+			task_ptr->execute();
+			delete task_ptr;
+		}
+
+		static WorkerContext &get_context() {
+			thread_local WorkerContext context;
+			return context;
+		}
+	};
+
+	/*!
+	 * @brief Acquire the pool shared by the library, with one worker per cpu
+	 */
+	inline ThreadPool &get_default_thread_pool() {
+		static ThreadPool default_thread_pool;
+		return default_thread_pool;
+	}
+
+}
+
+#endif//ALGORITHM_THREAD_THREAD_POOL_H
@@ -0,0 +1,159 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_THREAD_WORK_STEAL_DEQUE_H
+#define ALGORITHM_THREAD_WORK_STEAL_DEQUE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include <memory/cache.h>
+
+namespace algorithm::thread {
+
+	/*!
+	 * @brief Chase-Lev work-stealing deque, in the memory model of Lê et al. (PPoPP'13).
+	 * The owner pushes and pops at the bottom, while thieves steal from the top.
+	 * The buffer grows without bound, and old buffers are kept until destruction since thieves may still read them.
+	 * @tparam T Trivially copyable elements, usually pointers to tasks
+	 */
+	template<class T>
+	    requires std::is_trivially_copyable_v<T>
+	class WorkStealDeque {
+	public:
+		static constexpr size_t INIT_CAPACITY = 256;
+
+	private:
+		struct Buffer {
+			size_t capacity_;
+
+			std::unique_ptr<std::atomic<T>[]> slot_array_;
+
+			explicit Buffer(size_t capacity): capacity_(capacity), slot_array_(new std::atomic<T>[capacity]) {}
+
+			void put(int64_t idx, T value) {
+				slot_array_[static_cast<size_t>(idx) & (capacity_ - 1)].store(value, std::memory_order::relaxed);
+			}
+
+			T get(int64_t idx) const {
+				return slot_array_[static_cast<size_t>(idx) & (capacity_ - 1)].load(std::memory_order::relaxed);
+			}
+		};
+
+		alignas(memory::CACHE_LINE_SIZE) std::atomic<int64_t> top_;
+
+		alignas(memory::CACHE_LINE_SIZE) std::atomic<int64_t> bottom_;
+
+		std::atomic<Buffer *> buffer_ptr_;
+		/// All buffers ever allocated, which are only touched by the owner
+		std::vector<std::unique_ptr<Buffer>> buffer_array_;
+
+	public:
+		explicit WorkStealDeque(size_t init_capacity = INIT_CAPACITY): top_(0), bottom_(0) {
+			buffer_array_.emplace_back(std::make_unique<Buffer>(std::bit_ceil(init_capacity)));
+			buffer_ptr_.store(buffer_array_.back().get(), std::memory_order::relaxed);
+		}
+
+		WorkStealDeque(const WorkStealDeque &other) = delete;
+
+		~WorkStealDeque() = default;
+
+	public:
+		/*!
+		 * @brief Push an element at the bottom, only called by the owner
+		 */
+		void push(T value) {
+			int64_t bottom     = bottom_.load(std::memory_order::relaxed);
+			int64_t top        = top_.load(std::memory_order::acquire);
+			Buffer *buffer_ptr = buffer_ptr_.load(std::memory_order::relaxed);
+
+			if (bottom - top > static_cast<int64_t>(buffer_ptr->capacity_) - 1) {
+				buffer_ptr = grow(buffer_ptr, top, bottom);
+			}
+			buffer_ptr->put(bottom, value);
+			std::atomic_thread_fence(std::memory_order::release);
+			bottom_.store(bottom + 1, std::memory_order::relaxed);
+		}
+
+		/*!
+		 * @brief Pop an element from the bottom, only called by the owner
+		 */
+		std::optional<T> pop() {
+			int64_t bottom     = bottom_.load(std::memory_order::relaxed) - 1;
+			Buffer *buffer_ptr = buffer_ptr_.load(std::memory_order::relaxed);
+			bottom_.store(bottom, std::memory_order::relaxed);
+			std::atomic_thread_fence(std::memory_order::seq_cst);
+			int64_t top = top_.load(std::memory_order::relaxed);
+
+			if (top > bottom) { // Empty
+				bottom_.store(bottom + 1, std::memory_order::relaxed);
+				return std::nullopt;
+			}
+
+			T value = buffer_ptr->get(bottom);
+			if (top == bottom) { // The last element, which races with thieves
+				bool win = top_.compare_exchange_strong(top, top + 1, std::memory_order::seq_cst, std::memory_order::relaxed);
+				bottom_.store(bottom + 1, std::memory_order::relaxed);
+				if (!win) { return std::nullopt; }
+			}
+			return value;
+		}
+
+		/*!
+		 * @brief Steal an element from the top, which can be called by any thread
+		 * @return The element, or nullopt if the deque is empty or the race is lost
+		 */
+		std::optional<T> steal() {
+			int64_t top = top_.load(std::memory_order::acquire);
+			std::atomic_thread_fence(std::memory_order::seq_cst);
+			int64_t bottom = bottom_.load(std::memory_order::acquire);
+
+			if (top >= bottom) { return std::nullopt; }
+
+			Buffer *buffer_ptr = buffer_ptr_.load(std::memory_order::acquire);
+			T value = buffer_ptr->get(top);
+			if (!top_.compare_exchange_strong(top, top + 1, std::memory_order::seq_cst, std::memory_order::relaxed)) {
+				return std::nullopt;
+			}
+			return value;
+		}
+
+		/*!
+		 * @brief Whether the deque seems empty, which may be stale at once
+		 */
+		[[nodiscard]] bool empty() const {
+			int64_t bottom = bottom_.load(std::memory_order::relaxed);
+			int64_t top    = top_.load(std::memory_order::relaxed);
+			return top >= bottom;
+		}
+
+		[[nodiscard]] size_t size() const {
+			int64_t bottom = bottom_.load(std::memory_order::relaxed);
+			int64_t top    = top_.load(std::memory_order::relaxed);
+			return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+		}
+
+	private:
+		Buffer *grow(Buffer *old_buffer_ptr, int64_t top, int64_t bottom) {
+			buffer_array_.emplace_back(std::make_unique<Buffer>(old_buffer_ptr->capacity_ * 2));
+			Buffer *new_buffer_ptr = buffer_array_.back().get();
+			for (int64_t idx = top; idx < bottom; ++idx) {
+				new_buffer_ptr->put(idx, old_buffer_ptr->get(idx));
+			}
+			buffer_ptr_.store(new_buffer_ptr, std::memory_order::release);
+			return new_buffer_ptr;
+		}
+	};
+
+}
+
+#endif//ALGORITHM_THREAD_WORK_STEAL_DEQUE_H
@@ -0,0 +1,348 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#pragma once
+#ifndef ALGORITHM_UTIL_HASH_H
+#define ALGORITHM_UTIL_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <concepts>
+
+#include <immintrin.h>
+
+#include <algorithm/simd/cpu_feature.h>
+
+namespace algorithm::util {
+
+	inline namespace hash {
+
+		struct Hash128 {
+			uint64_t low;
+			uint64_t high;
+
+			bool operator==(const Hash128 &other) const = default;
+		};
+
+		namespace detail {
+
+			inline constexpr uint64_t HASH_PRIME_0 = 0xA0761D6478BD642FULL;
+			inline constexpr uint64_t HASH_PRIME_1 = 0xE7037ED1A0B428DBULL;
+			inline constexpr uint64_t HASH_PRIME_2 = 0x8EBC6AF09C88C6E3ULL;
+			inline constexpr uint64_t HASH_PRIME_3 = 0x589965CC75374CC3ULL;
+			inline constexpr uint64_t HASH_PRIME_4 = 0x1D8E4E27C47D124FULL;
+
+			/// Keys of lanes of stripes, and those scrambling accumulators
+			alignas(64) inline constexpr uint64_t HASH_SECRET[16] = {
+			        0xBE4BA423396CFEB8ULL, 0x1CAD21F72C81017CULL, 0xDB979083E96DD4DEULL, 0x1F67B3B7A4A44072ULL,
+			        0x78E5C0CC4EE679CBULL, 0x2172FFCC7DD05A82ULL, 0x8E2443F7744608B8ULL, 0x4C263A81E69035E0ULL,
+			        0xCB00C391BB52283CULL, 0xA32E531B8B65D088ULL, 0x4EF90DA297486471ULL, 0xD8ACDEA946EF1938ULL,
+			        0x3F349CE33F76FAA8ULL, 0x1D4F0BC7C7BBDCF9ULL, 0x3159B4CD4BE0518AULL, 0x647378D9C97E9FC8ULL
+			};
+
+			/// Bytes of a stripe, which are accumulated into 8 lanes
+			inline constexpr size_t STRIPE_SIZE = 64;
+
+			/// The amount of stripes between two scrambles of accumulators
+			inline constexpr size_t STRIPES_PER_BLOCK = 16;
+
+			/// Inputs longer than it are hashed by stripes
+			inline constexpr size_t LONG_HASH_THRESHOLD = 256;
+
+			inline uint64_t read_u64(const uint8_t *ptr) {
+				uint64_t value;
+				std::memcpy(&value, ptr, sizeof(value));
+				return value;
+			}
+
+			inline uint64_t read_u32(const uint8_t *ptr) {
+				uint32_t value;
+				std::memcpy(&value, ptr, sizeof(value));
+				return value;
+			}
+
+			/// Fold the 128-bit product into 64 bits
+			inline uint64_t mix(uint64_t a, uint64_t b) {
+				const __uint128_t product = static_cast<__uint128_t>(a) * b;
+				return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+			}
+
+			inline uint64_t avalanche(uint64_t hash) {
+				hash ^= hash >> 37;
+				hash *= 0x165667919E3779F9ULL;
+				return hash ^ (hash >> 32);
+			}
+
+			/// Read 1 to 16 bytes into two words by overlapping loads
+			inline void read_short(const uint8_t *ptr, size_t length, uint64_t &a, uint64_t &b) {
+				if (length >= 8) {
+					a = read_u64(ptr);
+					b = read_u64(ptr + length - 8);
+				}
+				else if (length >= 4) {
+					a = read_u32(ptr);
+					b = read_u32(ptr + length - 4);
+				}
+				else if (length > 0) {
+					a = (static_cast<uint64_t>(ptr[0]) << 16) | (static_cast<uint64_t>(ptr[length >> 1]) << 8) | ptr[length - 1];
+					b = 0;
+				}
+				else {
+					a = b = 0;
+				}
+			}
+
+			namespace scalar {
+
+				/*!
+				 * @brief Accumulate stripes into 8 lanes, where each lane adds the product of the low and high halves
+				 * of its keyed input, and its neighbour adds the input itself to keep all input bits.
+				 */
+				inline void accumulate(uint64_t *acc, const uint8_t *ptr, size_t stripe_amount, const uint64_t *secret) {
+					for (size_t stripe = 0; stripe < stripe_amount; ++stripe, ptr += STRIPE_SIZE) {
+						for (size_t lane = 0; lane < 8; ++lane) {
+							const uint64_t data = read_u64(ptr + lane * 8);
+							const uint64_t key  = data ^ secret[lane];
+							acc[lane ^ 1] += data;
+							acc[lane] += (key & 0xFFFFFFFFULL) * (key >> 32);
+						}
+					}
+				}
+
+				inline void scramble(uint64_t *acc, const uint64_t *secret) {
+					for (size_t lane = 0; lane < 8; ++lane) {
+						acc[lane] = (acc[lane] ^ (acc[lane] >> 47) ^ secret[lane]) * 0x9E3779B1ULL;
+					}
+				}
+
+			}
+
+#pragma GCC push_options
+#pragma GCC target("avx2,bmi,bmi2,popcnt")
+
+			namespace avx2 {
+
+				inline __m256i accumulate_vec(__m256i acc, __m256i data, __m256i secret) {
+					const __m256i key     = _mm256_xor_si256(data, secret);
+					const __m256i product = _mm256_mul_epu32(key, _mm256_srli_epi64(key, 32));
+					// Swap neighbouring 64-bit lanes
+					const __m256i swapped = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+					return _mm256_add_epi64(acc, _mm256_add_epi64(product, swapped));
+				}
+
+				inline __m256i scramble_vec(__m256i acc, __m256i secret) {
+					const __m256i prime = _mm256_set1_epi64x(0x9E3779B1LL);
+					acc = _mm256_xor_si256(_mm256_xor_si256(acc, _mm256_srli_epi64(acc, 47)), secret);
+					// 64-bit by 32-bit multiplication from two 32-bit ones
+					const __m256i low  = _mm256_mul_epu32(acc, prime);
+					const __m256i high = _mm256_mul_epu32(_mm256_srli_epi64(acc, 32), prime);
+					return _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+				}
+
+				inline void accumulate(uint64_t *acc, const uint8_t *ptr, size_t stripe_amount, const uint64_t *secret) {
+					__m256i acc_0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(acc));
+					__m256i acc_1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(acc + 4));
+					const __m256i secret_0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(secret));
+					const __m256i secret_1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(secret + 4));
+
+					for (size_t stripe = 0; stripe < stripe_amount; ++stripe, ptr += STRIPE_SIZE) {
+						acc_0 = accumulate_vec(acc_0, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr)), secret_0);
+						acc_1 = accumulate_vec(acc_1, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr + 32)), secret_1);
+					}
+					_mm256_storeu_si256(reinterpret_cast<__m256i *>(acc), acc_0);
+					_mm256_storeu_si256(reinterpret_cast<__m256i *>(acc + 4), acc_1);
+				}
+
+				inline void scramble(uint64_t *acc, const uint64_t *secret) {
+					for (size_t lane = 0; lane < 8; lane += 4) {
+						const __m256i acc_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(acc + lane));
+						const __m256i secret_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(secret + lane));
+						_mm256_storeu_si256(reinterpret_cast<__m256i *>(acc + lane), scramble_vec(acc_vec, secret_vec));
+					}
+				}
+
+			}
+
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f,avx512bw,avx512vl,avx512dq,avx2,bmi,bmi2,popcnt")
+
+			namespace avx512 {
+
+				inline void accumulate(uint64_t *acc, const uint8_t *ptr, size_t stripe_amount, const uint64_t *secret) {
+					__m512i acc_vec = _mm512_loadu_si512(acc);
+					const __m512i secret_vec = _mm512_loadu_si512(secret);
+
+					for (size_t stripe = 0; stripe < stripe_amount; ++stripe, ptr += STRIPE_SIZE) {
+						const __m512i data    = _mm512_loadu_si512(ptr);
+						const __m512i key     = _mm512_xor_si512(data, secret_vec);
+						const __m512i product = _mm512_mul_epu32(key, _mm512_srli_epi64(key, 32));
+						const __m512i swapped = _mm512_shuffle_epi32(data, _MM_PERM_BADC);
+						acc_vec = _mm512_add_epi64(acc_vec, _mm512_add_epi64(product, swapped));
+					}
+					_mm512_storeu_si512(acc, acc_vec);
+				}
+
+				inline void scramble(uint64_t *acc, const uint64_t *secret) {
+					__m512i acc_vec = _mm512_loadu_si512(acc);
+					acc_vec = _mm512_xor_si512(_mm512_xor_si512(acc_vec, _mm512_srli_epi64(acc_vec, 47)), _mm512_loadu_si512(secret));
+					_mm512_storeu_si512(acc, _mm512_mullo_epi64(acc_vec, _mm512_set1_epi64(0x9E3779B1LL)));
+				}
+
+			}
+
+#pragma GCC pop_options
+
+			template<class AccumulateFunc, class ScrambleFunc>
+			inline void hash_long_impl(uint64_t *acc, const uint8_t *ptr, size_t length, const uint64_t *secret,
+			                           AccumulateFunc &&accumulate_func, ScrambleFunc &&scramble_func) {
+				constexpr size_t BLOCK_SIZE = STRIPE_SIZE * STRIPES_PER_BLOCK;
+
+				size_t block_amount = (length - 1) / BLOCK_SIZE;
+				for (; block_amount > 0; --block_amount, ptr += BLOCK_SIZE, length -= BLOCK_SIZE) {
+					accumulate_func(acc, ptr, STRIPES_PER_BLOCK, secret);
+					scramble_func(acc, secret + 8);
+				}
+				// Whole stripes of the last block, and the last stripe overlapping them
+				const size_t stripe_amount = (length - 1) / STRIPE_SIZE;
+				accumulate_func(acc, ptr, stripe_amount, secret);
+				accumulate_func(acc, ptr + length - STRIPE_SIZE, 1, secret + 8);
+			}
+
+			/*!
+			 * @brief Accumulate an input longer than a stripe into 8 lanes, with the secret keyed by seed
+			 */
+			inline void hash_long(uint64_t *acc, const uint8_t *ptr, size_t length, uint64_t seed) {
+				alignas(64) uint64_t secret[16];
+				for (size_t idx = 0; idx < 16; ++idx) {
+					secret[idx] = HASH_SECRET[idx] + ((idx & 1) ? -seed : seed);
+				}
+				acc[0] = HASH_PRIME_0; acc[1] = HASH_PRIME_1; acc[2] = HASH_PRIME_2; acc[3] = HASH_PRIME_3;
+				acc[4] = HASH_PRIME_4; acc[5] = ~HASH_PRIME_0; acc[6] = ~HASH_PRIME_1; acc[7] = ~HASH_PRIME_2;
+
+				switch (simd::get_isa()) {
+					case simd::ISA::AVX512:
+						hash_long_impl(acc, ptr, length, secret, avx512::accumulate, avx512::scramble);
+						break;
+					case simd::ISA::AVX2:
+						hash_long_impl(acc, ptr, length, secret, avx2::accumulate, avx2::scramble);
+						break;
+					default:
+						hash_long_impl(acc, ptr, length, secret, scalar::accumulate, scalar::scramble);
+						break;
+				}
+			}
+
+			inline uint64_t fold_long(const uint64_t *acc, uint64_t init, const uint64_t *secret) {
+				uint64_t hash = init;
+				for (size_t lane = 0; lane < 8; lane += 2) {
+					hash += mix(acc[lane] ^ secret[lane], acc[lane + 1] ^ secret[lane + 1]);
+				}
+				return avalanche(hash);
+			}
+
+		}
+
+		/*!
+		 * @brief 64-bit hash of bytes by folded multiplication.
+		 * Up to 16 bytes are read by two overlapping loads, up to 256 bytes are mixed 16 bytes a round,
+		 * and longer inputs are accumulated by 64-byte stripes in vectors.
+		 */
+		inline uint64_t hash64(const void *data, size_t length, uint64_t seed = 0) {
+			using namespace detail;
+			const auto *ptr = static_cast<const uint8_t *>(data);
+
+			seed ^= HASH_PRIME_0;
+			uint64_t a, b;
+			if (length <= 16) {
+				read_short(ptr, length, a, b);
+			}
+			else if (length <= LONG_HASH_THRESHOLD) {
+				size_t remaining = length;
+				for (; remaining > 16; remaining -= 16, ptr += 16) {
+					seed = mix(read_u64(ptr) ^ HASH_PRIME_1, read_u64(ptr + 8) ^ seed);
+				}
+				a = read_u64(ptr + remaining - 16);
+				b = read_u64(ptr + remaining - 8);
+			}
+			else {
+				uint64_t acc[8];
+				hash_long(acc, ptr, length, seed);
+				return fold_long(acc, length * HASH_PRIME_1, HASH_SECRET + 3);
+			}
+			return mix(HASH_PRIME_1 ^ length, mix(a ^ HASH_PRIME_1, b ^ seed) ^ HASH_PRIME_2);
+		}
+
+		/*!
+		 * @brief 128-bit hash of bytes, which shares the mixing of hash64,
+		 * with the two halves finalized by independent multiplications
+		 */
+		inline Hash128 hash128(const void *data, size_t length, uint64_t seed = 0) {
+			using namespace detail;
+			const auto *ptr = static_cast<const uint8_t *>(data);
+
+			seed ^= HASH_PRIME_0;
+			uint64_t a, b;
+			if (length <= 16) {
+				read_short(ptr, length, a, b);
+			}
+			else if (length <= LONG_HASH_THRESHOLD) {
+				size_t remaining = length;
+				for (; remaining > 16; remaining -= 16, ptr += 16) {
+					seed = mix(read_u64(ptr) ^ HASH_PRIME_1, read_u64(ptr + 8) ^ seed);
+				}
+				a = read_u64(ptr + remaining - 16);
+				b = read_u64(ptr + remaining - 8);
+			}
+			else {
+				uint64_t acc[8];
+				hash_long(acc, ptr, length, seed);
+				return {
+					.low  = fold_long(acc, length * HASH_PRIME_1, HASH_SECRET + 3),
+					.high = fold_long(acc, ~length * HASH_PRIME_2, HASH_SECRET + 7)
+				};
+			}
+			return {
+				.low  = mix(HASH_PRIME_1 ^ length, mix(a ^ HASH_PRIME_1, b ^ seed) ^ HASH_PRIME_2),
+				.high = mix(HASH_PRIME_4 ^ length, mix(b ^ HASH_PRIME_3, a ^ seed ^ HASH_PRIME_4) ^ HASH_PRIME_3)
+			};
+		}
+
+		/*!
+		 * @brief The i-th value of Kirsch–Mitzenmacher double hashing, i.e. h1 + i * h2,
+		 * where the step is made odd so that values of a round differ modulo any power of two.
+		 */
+		inline uint64_t double_hash(const Hash128 &hash, uint32_t i) {
+			return hash.low + static_cast<uint64_t>(i) * (hash.high | 1);
+		}
+
+		/*!
+		 * @brief Map a hash into [0, range) by multiplication instead of modulo, which is led by its high bits
+		 */
+		inline uint64_t fast_range(uint64_t hash, uint64_t range) {
+			return static_cast<uint64_t>((static_cast<__uint128_t>(hash) * range) >> 64);
+		}
+
+		/*!
+		 * @brief Hashers of bytes with a seed into 128 bits, from which filters derive indices by double hashing
+		 */
+		template<class Hasher>
+		concept HasherConcept = requires(const uint8_t *ptr, size_t length, uint64_t seed) {
+			{ Hasher::hash(ptr, length, seed) } -> std::same_as<Hash128>;
+		};
+
+		struct FastHasher {
+			static Hash128 hash(const uint8_t *ptr, size_t length, uint64_t seed) {
+				return hash128(ptr, length, seed);
+			}
+		};
+
+	}
+
+}
+
+#endif//ALGORITHM_UTIL_HASH_H
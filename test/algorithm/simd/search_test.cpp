@@ -0,0 +1,105 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+
+#include <random>
+#include <vector>
+#include <limits>
+#include <gtest/gtest.h>
+
+#include <algorithm/simd/search.h>
+
+namespace {
+
+	template<class T>
+	std::vector<T> get_random_values(size_t size, uint64_t range) {
+		std::vector<T> vec;
+		std::mt19937_64 rander(size * 7 + range);
+		for (size_t i = 0; i < size; ++i) {
+			// Negative values and values with the sign bit set are included
+			vec.push_back(static_cast<T>(static_cast<int64_t>(rander() % range) - static_cast<int64_t>(range / 2)));
+		}
+		return vec;
+	}
+
+	std::vector<uint64_t> get_bit_mask(const std::vector<bool> &match_array) {
+		std::vector<uint64_t> mask_array(algorithm::simd::bit_mask_size(match_array.size()), 0);
+		for (size_t idx = 0; idx < match_array.size(); ++idx) {
+			if (match_array[idx]) { mask_array[idx / 64] |= uint64_t(1) << (idx % 64); }
+		}
+		return mask_array;
+	}
+
+	template<class T, class Find, class Count, class FindAll, class FindIfLess>
+	void check_isa(Find &&find, Count &&count, FindAll &&find_all, FindIfLess &&find_if_less) {
+		// Offsets cover starts not aligned to vectors
+		const std::vector<T> value_array = get_random_values<T>(1024, 16);
+		for (size_t offset = 0; offset < 4; ++offset) {
+			for (size_t size = 0; size + offset <= 300; ++size) {
+				const T *ptr = value_array.data() + offset;
+				for (T value: {static_cast<T>(0), static_cast<T>(3), static_cast<T>(-5), static_cast<T>(100)}) {
+					std::vector<bool> eq_array(size), lt_array(size);
+					for (size_t idx = 0; idx < size; ++idx) {
+						eq_array[idx] = (ptr[idx] == value);
+						lt_array[idx] = (ptr[idx] < value);
+					}
+					const size_t eq_count = std::count(eq_array.begin(), eq_array.end(), true);
+					const size_t lt_count = std::count(lt_array.begin(), lt_array.end(), true);
+
+					EXPECT_EQ(find(ptr, size, value), std::find(ptr, ptr + size, value) - ptr) << "find in " << size;
+					EXPECT_EQ(count(ptr, size, value), eq_count) << "count in " << size;
+
+					std::vector<uint64_t> mask_array(algorithm::simd::bit_mask_size(size), ~uint64_t(0));
+					EXPECT_EQ(find_all(ptr, size, value, mask_array.data()), eq_count);
+					EXPECT_EQ(mask_array, get_bit_mask(eq_array)) << "find_all in " << size;
+
+					std::fill(mask_array.begin(), mask_array.end(), ~uint64_t(0));
+					EXPECT_EQ(find_if_less(ptr, size, value, mask_array.data()), lt_count);
+					EXPECT_EQ(mask_array, get_bit_mask(lt_array)) << "find_if_less in " << size;
+				}
+			}
+		}
+	}
+
+}
+
+template<class T>
+class SIMDSearchTest: public testing::Test {};
+
+using SIMDSearchTypes = testing::Types<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, float, double>;
+TYPED_TEST_SUITE(SIMDSearchTest, SIMDSearchTypes);
+
+TYPED_TEST(SIMDSearchTest, ScalarTest) {
+	using T = TypeParam;
+	using namespace algorithm::simd;
+	check_isa<T>(scalar::find<T>, scalar::count<T>, scalar::find_all<T>, scalar::find_if_less<T>);
+}
+
+TYPED_TEST(SIMDSearchTest, AVX2Test) {
+	using T = TypeParam;
+	using namespace algorithm::simd;
+	if (!is_isa_supported(ISA::AVX2)) { GTEST_SKIP(); }
+	check_isa<T>(avx2::find<T>, avx2::count<T>, avx2::find_all<T>, avx2::find_if_less<T>);
+}
+
+TYPED_TEST(SIMDSearchTest, AVX512Test) {
+	using T = TypeParam;
+	using namespace algorithm::simd;
+	if (!is_isa_supported(ISA::AVX512)) { GTEST_SKIP(); }
+	check_isa<T>(avx512::find<T>, avx512::count<T>, avx512::find_all<T>, avx512::find_if_less<T>);
+}
+
+TEST(SIMDSearchTest, DispatchTest) {
+	std::vector<int32_t> id_array(10000);
+	for (size_t idx = 0; idx < id_array.size(); ++idx) { id_array[idx] = static_cast<int32_t>(idx * 3); }
+
+	EXPECT_EQ(algorithm::simd::find(id_array.data(), id_array.size(), 2997), 999);
+	EXPECT_EQ(algorithm::simd::find(id_array.data(), id_array.size(), 1), id_array.size());
+	EXPECT_EQ(algorithm::simd::count(id_array.data(), id_array.size(), 0), 1);
+
+	const std::vector<float> float_array{1.0f, std::numeric_limits<float>::quiet_NaN(), -0.0f, 2.0f};
+	EXPECT_EQ(algorithm::simd::find(float_array.data(), float_array.size(), 0.0f), 2);
+	EXPECT_EQ(algorithm::simd::find(float_array.data(), float_array.size(), std::numeric_limits<float>::quiet_NaN()), 4);
+}
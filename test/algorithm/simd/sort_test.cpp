@@ -0,0 +1,101 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <gtest/gtest.h>
+
+#include <algorithm/simd/sort.h>
+#include <algorithm/sort/quick_sort.h>
+
+namespace {
+
+	template<class T>
+	std::vector<T> get_random_values(size_t size, uint64_t range) {
+		std::vector<T> vec;
+		std::mt19937_64 rander(size * 7 + range);
+		for (size_t i = 0; i < size; ++i) {
+			// Negative values are included
+			vec.push_back(static_cast<T>(static_cast<int64_t>(rander() % range) - static_cast<int64_t>(range / 2)));
+		}
+		return vec;
+	}
+
+	template<class T, class SortNetwork, class Partition>
+	void check_isa(SortNetwork &&sort_network, Partition &&partition) {
+		for (size_t size = 0; size <= algorithm::simd::SORT_NETWORK_MAX_SIZE; ++size) {
+			std::vector<T> vec = get_random_values<T>(size, 100);
+			std::vector<T> test_vec{vec};
+			std::sort(vec.begin(), vec.end());
+			sort_network(test_vec.data(), size);
+			EXPECT_EQ(test_vec, vec) << "sorting network of " << size;
+		}
+
+		for (size_t size: {0, 1, 7, 31, 32, 33, 100, 1000, 4097}) {
+			for (uint64_t range: {3, 1000}) {
+				std::vector<T> vec = get_random_values<T>(size, range);
+				std::vector<T> test_vec{vec};
+				const T pivot = static_cast<T>(0);
+
+				T *mid_ptr = partition(test_vec.data(), test_vec.data() + size, pivot);
+				const size_t mid = mid_ptr - test_vec.data();
+				EXPECT_EQ(mid, std::count_if(vec.begin(), vec.end(), [pivot](T value) { return value < pivot; }));
+				EXPECT_TRUE(std::all_of(test_vec.begin(), test_vec.begin() + mid, [pivot](T value) { return value < pivot; }));
+				EXPECT_TRUE(std::all_of(test_vec.begin() + mid, test_vec.end(), [pivot](T value) { return !(value < pivot); }));
+
+				std::sort(vec.begin(), vec.end());
+				std::sort(test_vec.begin(), test_vec.end());
+				EXPECT_EQ(test_vec, vec) << "partition of " << size;
+			}
+		}
+	}
+
+}
+
+template<class T>
+class SIMDSortTest: public testing::Test {};
+
+using SIMDSortTypes = testing::Types<int32_t, int64_t, float, double>;
+TYPED_TEST_SUITE(SIMDSortTest, SIMDSortTypes);
+
+TYPED_TEST(SIMDSortTest, ScalarTest) {
+	using T = TypeParam;
+	check_isa<T>(algorithm::simd::scalar::sort_network<T>, algorithm::simd::scalar::partition_less<T>);
+}
+
+TYPED_TEST(SIMDSortTest, AVX2Test) {
+	using T = TypeParam;
+	if (!algorithm::simd::is_isa_supported(algorithm::simd::ISA::AVX2)) { GTEST_SKIP(); }
+	check_isa<T>(algorithm::simd::avx2::sort_network<T>, algorithm::simd::avx2::partition_less<T>);
+}
+
+TYPED_TEST(SIMDSortTest, AVX512Test) {
+	using T = TypeParam;
+	if (!algorithm::simd::is_isa_supported(algorithm::simd::ISA::AVX512)) { GTEST_SKIP(); }
+	check_isa<T>(algorithm::simd::avx512::sort_network<T>, algorithm::simd::avx512::partition_less<T>);
+}
+
+TYPED_TEST(SIMDSortTest, PartitionLessEqualTest) {
+	using T = TypeParam;
+	std::vector<T> vec = get_random_values<T>(10000, 5);
+	std::vector<T> test_vec{vec};
+
+	T *mid_ptr = algorithm::simd::partition_less_equal(test_vec.data(), test_vec.data() + test_vec.size(), T(0));
+	EXPECT_TRUE(std::all_of(test_vec.data(), mid_ptr, [](T value) { return value <= T(0); }));
+	EXPECT_TRUE(std::all_of(mid_ptr, test_vec.data() + test_vec.size(), [](T value) { return value > T(0); }));
+}
+
+TYPED_TEST(SIMDSortTest, QuickSortTest) {
+	using T = TypeParam;
+	for (uint64_t range: {1, 16, 1 << 30}) {
+		std::vector<T> vec = get_random_values<T>(200000, range);
+		std::vector<T> test_vec{vec};
+		std::sort(vec.begin(), vec.end());
+		algorithm::sort::quick_sort(test_vec.begin(), test_vec.end());
+		EXPECT_EQ(test_vec, vec);
+	}
+}
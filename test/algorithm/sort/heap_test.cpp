@@ -0,0 +1,41 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <gtest/gtest.h>
+
+#include <algorithm/sort/heap_sort.h>
+
+TEST(HeapSortTest, HeapSortRandomTest) {
+	std::vector<uint32_t> vec;
+	std::default_random_engine rander;
+
+	for (uint32_t i = 0; i < 10000; ++i) {
+		vec.push_back(rander() % 1000);
+	}
+
+	std::vector<uint32_t> test_vec{vec};
+	std::sort(vec.begin(), vec.end());
+
+	algorithm::sort::heap_sort(test_vec.begin(), test_vec.end());
+	EXPECT_EQ(test_vec, vec);
+
+	std::reverse(vec.begin(), vec.end());
+	algorithm::sort::heap_sort(test_vec.begin(), test_vec.end(), std::greater<>());
+	EXPECT_EQ(test_vec, vec);
+}
+
+TEST(HeapSortTest, HeapSortSmallTest) {
+	std::vector<uint32_t> test_vec;
+	algorithm::sort::heap_sort(test_vec.begin(), test_vec.end());
+	EXPECT_TRUE(test_vec.empty());
+
+	test_vec.push_back(1);
+	algorithm::sort::heap_sort(test_vec.begin(), test_vec.end());
+	EXPECT_EQ(test_vec[0], 1);
+}
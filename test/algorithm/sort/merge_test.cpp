@@ -0,0 +1,144 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+
+#include <random>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <gtest/gtest.h>
+
+#include <allocator/allocator.h>
+#include <algorithm/sort/merge_sort.h>
+
+namespace {
+
+	using KeyPair = std::pair<uint32_t, uint32_t>;
+
+	/// Keys with many duplicates, tagged by the original position to check stability
+	std::vector<KeyPair> get_tagged_keys(uint32_t size, uint32_t range) {
+		std::vector<KeyPair> vec;
+		std::default_random_engine rander;
+		for (uint32_t i = 0; i < size; ++i) {
+			vec.emplace_back(rander() % range, i);
+		}
+		return vec;
+	}
+
+	bool key_less(const KeyPair &lhs, const KeyPair &rhs) {
+		return lhs.first < rhs.first;
+	}
+
+}
+
+TEST(MergeSortTest, MergeSortStableTest) {
+	for (uint32_t size: {0, 1, 31, 33, 1000, 100000}) {
+		std::vector<KeyPair> vec      = get_tagged_keys(size, 100);
+		std::vector<KeyPair> test_vec = vec;
+
+		std::stable_sort(vec.begin(), vec.end(), key_less);
+		algorithm::sort::merge_sort(test_vec.begin(), test_vec.end(), key_less);
+		EXPECT_EQ(test_vec, vec);
+	}
+}
+
+TEST(MergeSortTest, MergeSortAllocatorTest) {
+	std::vector<uint32_t> vec;
+	std::default_random_engine rander;
+	for (uint32_t i = 0; i < 10000; ++i) {
+		vec.push_back(rander());
+	}
+
+	std::vector<uint32_t> test_vec{vec};
+	std::sort(vec.begin(), vec.end());
+	algorithm::sort::merge_sort<algorithm::allocator::SimpleAllocator<std::byte>>(test_vec.begin(), test_vec.end(), std::less<>());
+	EXPECT_EQ(test_vec, vec);
+}
+
+TEST(MergeSortTest, MergeSortNonTrivialTest) {
+	std::vector<std::string> vec;
+	std::default_random_engine rander;
+	for (uint32_t i = 0; i < 5000; ++i) {
+		vec.push_back(std::to_string(rander() % 1000) + "#" + std::to_string(i));
+	}
+
+	// Compare the prefix only, so that the suffix tells the stability
+	auto prefix_less = [](const std::string &lhs, const std::string &rhs) {
+		return lhs.substr(0, lhs.find('#')) < rhs.substr(0, rhs.find('#'));
+	};
+
+	std::vector<std::string> test_vec{vec};
+	std::stable_sort(vec.begin(), vec.end(), prefix_less);
+	algorithm::sort::merge_sort(test_vec.begin(), test_vec.end(), prefix_less);
+	EXPECT_EQ(test_vec, vec);
+}
+
+TEST(MergeSortTest, ParallelMergeSortTest) {
+	std::vector<KeyPair> vec      = get_tagged_keys(1000000, 1000);
+	std::vector<KeyPair> test_vec = vec;
+	std::stable_sort(vec.begin(), vec.end(), key_less);
+
+	algorithm::thread::ThreadPool pool(4);
+	algorithm::sort::parallel_merge_sort(test_vec.begin(), test_vec.end(), key_less, pool);
+	EXPECT_EQ(test_vec, vec);
+
+	std::vector<std::string> str_vec;
+	for (uint32_t i = 0; i < 100000; ++i) {
+		str_vec.push_back(std::to_string(vec[i].first * 7 % 1000));
+	}
+	std::vector<std::string> test_str_vec{str_vec};
+	std::sort(str_vec.begin(), str_vec.end());
+	algorithm::sort::parallel_merge_sort(test_str_vec.begin(), test_str_vec.end(), std::less<>(), pool);
+	EXPECT_EQ(test_str_vec, str_vec);
+}
+
+TEST(MergeSortTest, KWayMergeTest) {
+	using Iterator = std::vector<KeyPair>::const_iterator;
+
+	std::vector<std::vector<KeyPair>> run_array;
+	std::vector<KeyPair> vec;
+	std::default_random_engine rander;
+	for (uint32_t run_idx = 0; run_idx < 13; ++run_idx) {
+		auto &run = run_array.emplace_back();
+		for (uint32_t i = rander() % 500; i > 0; --i) {
+			run.emplace_back(rander() % 50, run_idx);
+		}
+		std::stable_sort(run.begin(), run.end(), key_less);
+		vec.insert(vec.end(), run.begin(), run.end());
+	}
+	// Stable across runs in order
+	std::stable_sort(vec.begin(), vec.end(), key_less);
+
+	std::vector<std::pair<Iterator, Iterator>> range_array;
+	for (const auto &run: run_array) {
+		range_array.emplace_back(run.cbegin(), run.cend());
+	}
+	std::vector<KeyPair> test_vec;
+	algorithm::sort::kway_merge(range_array, std::back_inserter(test_vec), key_less);
+	EXPECT_EQ(test_vec, vec);
+}
+
+TEST(MergeSortTest, LoserTreeTest) {
+	using Iterator = std::vector<uint32_t>::const_iterator;
+
+	const std::vector<uint32_t> first_run{1, 4, 7};
+	const std::vector<uint32_t> second_run{2, 5};
+	const std::vector<uint32_t> empty_run;
+
+	algorithm::sort::LoserTree<Iterator> loser_tree;
+	EXPECT_TRUE(loser_tree.empty());
+
+	loser_tree.add_run(first_run.cbegin(), first_run.cend());
+	loser_tree.add_run(empty_run.cbegin(), empty_run.cend());
+	loser_tree.add_run(second_run.cbegin(), second_run.cend());
+
+	std::vector<uint32_t> res_vec;
+	while (!loser_tree.empty()) {
+		res_vec.push_back(loser_tree.top());
+		loser_tree.pop();
+	}
+	EXPECT_EQ(res_vec, (std::vector<uint32_t>{1, 2, 4, 5, 7}));
+}
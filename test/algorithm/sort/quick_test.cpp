@@ -5,6 +5,8 @@
 
 
 #include <random>
+#include <string>
+#include <algorithm>
 #include <vector>
 #include <gtest/gtest.h>
 
@@ -46,4 +48,86 @@ TEST(QuickSortTest, QuickSortSmallTest) {
 		EXPECT_EQ(test_vec.size(), 1);
 		EXPECT_EQ(test_vec[0], vec[0]);
 	}
-}
\ No newline at end of file
+}
+
+TEST(QuickSortTest, QuickSortPatternTest) {
+	constexpr uint32_t TEST_SIZE = 100000;
+
+	std::vector<uint32_t> sorted_vec(TEST_SIZE);
+	for (uint32_t i = 0; i < TEST_SIZE; ++i) { sorted_vec[i] = i; }
+
+	// Sorted
+	{
+		std::vector<uint32_t> test_vec{sorted_vec};
+		algorithm::sort::quick_sort(test_vec.begin(), test_vec.end());
+		EXPECT_EQ(test_vec, sorted_vec);
+	}
+	// Reversed
+	{
+		std::vector<uint32_t> test_vec{sorted_vec.rbegin(), sorted_vec.rend()};
+		algorithm::sort::quick_sort(test_vec.begin(), test_vec.end());
+		EXPECT_EQ(test_vec, sorted_vec);
+	}
+	// Organ pipe
+	{
+		std::vector<uint32_t> test_vec(TEST_SIZE);
+		for (uint32_t i = 0; i < TEST_SIZE; ++i) { test_vec[i] = std::min(i, TEST_SIZE - i); }
+		std::vector<uint32_t> vec{test_vec};
+		std::sort(vec.begin(), vec.end());
+		algorithm::sort::quick_sort(test_vec.begin(), test_vec.end());
+		EXPECT_EQ(test_vec, vec);
+	}
+}
+
+TEST(QuickSortTest, QuickSortDuplicateTest) {
+	constexpr uint32_t TEST_SIZE = 100000;
+
+	std::default_random_engine rander;
+	for (uint32_t range: {1, 2, 16, 1000}) {
+		std::vector<uint32_t> vec;
+		for (uint32_t i = 0; i < TEST_SIZE; ++i) {
+			vec.push_back(rander() % range);
+		}
+
+		std::vector<uint32_t> test_vec{vec};
+		std::sort(vec.begin(), vec.end());
+		algorithm::sort::quick_sort(test_vec.begin(), test_vec.end());
+		EXPECT_EQ(test_vec, vec);
+	}
+}
+
+TEST(QuickSortTest, QuickSortCompareTest) {
+	constexpr uint32_t TEST_SIZE = 10000;
+
+	std::vector<std::string> vec;
+	std::default_random_engine rander;
+	for (uint32_t i = 0; i < TEST_SIZE; ++i) {
+		vec.push_back(std::to_string(rander() % 5000));
+	}
+
+	std::vector<std::string> test_vec{vec};
+	std::sort(vec.begin(), vec.end(), std::greater<>());
+	algorithm::sort::quick_sort(test_vec.begin(), test_vec.end(), std::greater<>());
+	EXPECT_EQ(test_vec, vec);
+}
+
+TEST(QuickSortTest, ParallelQuickSortTest) {
+	constexpr uint32_t TEST_SIZE = 1000000;
+
+	std::vector<uint64_t> vec;
+	std::mt19937_64 rander;
+	for (uint32_t i = 0; i < TEST_SIZE; ++i) {
+		vec.push_back(rander() % (TEST_SIZE / 4));
+	}
+
+	std::vector<uint64_t> test_vec{vec};
+	std::sort(vec.begin(), vec.end());
+
+	algorithm::thread::ThreadPool pool(4);
+	algorithm::sort::parallel_quick_sort(test_vec.begin(), test_vec.end(), std::less<>(), pool);
+	EXPECT_EQ(test_vec, vec);
+
+	algorithm::sort::parallel_quick_sort(test_vec.begin(), test_vec.end(), std::greater<>());
+	std::reverse(vec.begin(), vec.end());
+	EXPECT_EQ(test_vec, vec);
+}
@@ -0,0 +1,132 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+
+#include <array>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <gtest/gtest.h>
+
+#include <algorithm/sort/radix_sort.h>
+
+namespace {
+
+	struct Record {
+		uint64_t id;
+		uint32_t seq;
+
+		bool operator==(const Record &other) const = default;
+	};
+
+	template<class T>
+	std::vector<T> get_random_keys(size_t size) {
+		std::vector<T> vec;
+		std::mt19937_64 rander(size);
+		for (size_t i = 0; i < size; ++i) {
+			vec.push_back(static_cast<T>(rander()));
+		}
+		return vec;
+	}
+
+}
+
+TEST(RadixSortTest, RadixSortIntegerTest) {
+	for (size_t size: {0, 1, 64, 65, 100000}) {
+		std::vector<uint32_t> vec = get_random_keys<uint32_t>(size);
+		std::vector<uint32_t> test_vec_8{vec}, test_vec_11{vec}, test_vec_16{vec};
+		std::sort(vec.begin(), vec.end());
+
+		algorithm::sort::radix_sort(test_vec_8.begin(), test_vec_8.end());
+		algorithm::sort::radix_sort<11>(test_vec_11.begin(), test_vec_11.end());
+		algorithm::sort::radix_sort<16>(test_vec_16.begin(), test_vec_16.end());
+		EXPECT_EQ(test_vec_8, vec);
+		EXPECT_EQ(test_vec_11, vec);
+		EXPECT_EQ(test_vec_16, vec);
+	}
+}
+
+TEST(RadixSortTest, RadixSortSignedTest) {
+	std::vector<int64_t> vec = get_random_keys<int64_t>(100000);
+	// Keys of narrow range, where most passes are skipped
+	for (size_t i = 0; i < vec.size(); i += 2) { vec[i] %= 1000; }
+
+	std::vector<int64_t> test_vec{vec};
+	std::sort(vec.begin(), vec.end());
+	algorithm::sort::radix_sort<11>(test_vec.begin(), test_vec.end());
+	EXPECT_EQ(test_vec, vec);
+}
+
+TEST(RadixSortTest, RadixSortKeyTest) {
+	std::vector<Record> vec;
+	std::mt19937_64 rander;
+	for (uint32_t i = 0; i < 100000; ++i) {
+		vec.push_back({rander() % 5000, i});
+	}
+	std::vector<Record> test_vec{vec};
+	std::stable_sort(vec.begin(), vec.end(), [](const Record &lhs, const Record &rhs) { return lhs.id < rhs.id; });
+
+	// Stable on the key
+	algorithm::sort::radix_sort(test_vec.begin(), test_vec.end(), [](const Record &record) { return record.id; });
+	EXPECT_EQ(test_vec, vec);
+}
+
+TEST(RadixSortTest, ParallelRadixSortTest) {
+	std::vector<uint64_t> vec = get_random_keys<uint64_t>(1000000);
+	std::vector<uint64_t> test_vec{vec};
+	std::sort(vec.begin(), vec.end());
+
+	algorithm::thread::ThreadPool pool(4);
+	algorithm::sort::parallel_radix_sort<11>(test_vec.begin(), test_vec.end(), std::identity(), pool);
+	EXPECT_EQ(test_vec, vec);
+
+	std::vector<std::pair<uint32_t, std::string>> str_vec;
+	for (uint32_t i = 0; i < 200000; ++i) {
+		str_vec.emplace_back(vec[i] % 1000, std::to_string(i));
+	}
+	auto test_str_vec = str_vec;
+	std::stable_sort(str_vec.begin(), str_vec.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+	algorithm::sort::parallel_radix_sort(test_str_vec.begin(), test_str_vec.end(), [](const auto &value) { return value.first; });
+	EXPECT_EQ(test_str_vec, str_vec);
+}
+
+TEST(RadixSortTest, MSDRadixSortStringTest) {
+	std::vector<std::string> vec;
+	std::mt19937 rander;
+	for (uint32_t i = 0; i < 50000; ++i) {
+		std::string str;
+		for (uint32_t len = rander() % 12; len > 0; --len) {
+			// Bytes above 0x7F should go after ASCII ones
+			str.push_back(static_cast<char>("ab\xF0z"[rander() % 4]));
+		}
+		vec.push_back(std::move(str));
+	}
+
+	std::vector<std::string> test_vec{vec};
+	std::sort(vec.begin(), vec.end());
+	algorithm::sort::msd_radix_sort(test_vec.begin(), test_vec.end());
+	EXPECT_EQ(test_vec, vec);
+}
+
+TEST(RadixSortTest, MSDRadixSortFixedWidthTest) {
+	using Key = std::array<char, 8>;
+
+	std::vector<std::pair<Key, uint32_t>> vec;
+	std::mt19937 rander;
+	for (uint32_t i = 0; i < 50000; ++i) {
+		Key key;
+		for (auto &ch: key) { ch = static_cast<char>('0' + rander() % 3); }
+		vec.emplace_back(key, i);
+	}
+
+	auto test_vec = vec;
+	std::sort(vec.begin(), vec.end());
+	algorithm::sort::msd_radix_sort(test_vec.begin(), test_vec.end(), [](const auto &value) -> const Key & { return value.first; });
+	// Not stable, so that only keys are compared
+	for (size_t i = 0; i < vec.size(); ++i) {
+		EXPECT_EQ(test_vec[i].first, vec[i].first);
+	}
+}
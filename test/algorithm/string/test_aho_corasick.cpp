@@ -0,0 +1,179 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <gtest/gtest.h>
+
+#include <algorithm/string/search.h>
+
+namespace {
+
+	using Match = std::pair<size_t, size_t>;
+
+	std::vector<Match> brute_force_find_all(const std::vector<std::string> &pattern_array, const std::string &text) {
+		std::vector<Match> match_array;
+		for (size_t pattern_id = 0; pattern_id < pattern_array.size(); ++pattern_id) {
+			const std::string &pattern = pattern_array[pattern_id];
+			if (pattern.empty()) { continue; }
+			for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+				match_array.emplace_back(pattern_id, pos);
+			}
+		}
+		std::sort(match_array.begin(), match_array.end());
+		return match_array;
+	}
+
+	std::string get_random_string(std::default_random_engine &rander, size_t size, char alphabet) {
+		std::string str(size, 'a');
+		for (auto &c: str) { c = static_cast<char>(rander() % alphabet + 'a'); }
+		return str;
+	}
+
+}
+
+TEST(AhoCorasickTest, SimpleTest) {
+	const std::vector<std::string> pattern_array{"he", "she", "his", "hers", ""};
+	algorithm::AhoCorasick<char> matcher{pattern_array};
+
+	std::vector<Match> match_array;
+	matcher.find_all(std::string_view{"ushers"}.begin(), std::string_view{"ushers"}.end(), [&](size_t pattern_id, size_t offset) {
+		match_array.emplace_back(pattern_id, offset);
+	});
+	EXPECT_EQ(match_array, (std::vector<Match>{{1, 1}, {0, 2}, {3, 2}}));
+}
+
+TEST(AhoCorasickTest, RandomTest) {
+	std::default_random_engine rander;
+
+	for (uint32_t i = 0; i < 100; ++i) {
+		const char alphabet = (i % 2 == 0) ? 3 : 26;
+		std::vector<std::string> pattern_array(rander() % 200 + 1);
+		for (auto &pattern: pattern_array) { pattern = get_random_string(rander, rander() % 6 + 1, alphabet); }
+		const std::string text = get_random_string(rander, rander() % 2000, alphabet);
+
+		algorithm::AhoCorasick<char> matcher{pattern_array, 'a', 'z'};
+		std::vector<Match> match_array;
+		matcher.find_all(text.begin(), text.end(), [&](size_t pattern_id, size_t offset) {
+			match_array.emplace_back(pattern_id, offset);
+		});
+		std::sort(match_array.begin(), match_array.end());
+		EXPECT_EQ(match_array, brute_force_find_all(pattern_array, text));
+	}
+}
+
+TEST(AhoCorasickTest, StreamTest) {
+	std::default_random_engine rander;
+
+	for (uint32_t i = 0; i < 100; ++i) {
+		std::vector<std::string> pattern_array(rander() % 50 + 1);
+		for (auto &pattern: pattern_array) { pattern = get_random_string(rander, rander() % 8 + 1, 2); }
+		const std::string text = get_random_string(rander, rander() % 2000, 2);
+
+		algorithm::AhoCorasick<char> matcher{pattern_array};
+		std::vector<Match> match_array;
+		// Chunks as short as one value split matches at every position
+		for (size_t pos = 0; pos < text.size();) {
+			const size_t chunk_size = std::min<size_t>(rander() % 16 + 1, text.size() - pos);
+			matcher.feed(std::span<const char>{text.data() + pos, chunk_size}, [&](size_t pattern_id, size_t offset) {
+				match_array.emplace_back(pattern_id, offset);
+			});
+			pos += chunk_size;
+		}
+		std::sort(match_array.begin(), match_array.end());
+		EXPECT_EQ(match_array, brute_force_find_all(pattern_array, text));
+
+		// Values out of range break matches
+		matcher.reset();
+		size_t match_amount = 0;
+		const std::string broken_text = "ab\x01" "ab";
+		matcher.feed(broken_text.begin(), broken_text.end(), [&](size_t, size_t) { ++match_amount; });
+		algorithm::AhoCorasick<char> limited_matcher{pattern_array, 'a', 'b'};
+		size_t limited_match_amount = 0;
+		limited_matcher.feed(broken_text.begin(), broken_text.end(), [&](size_t, size_t) { ++limited_match_amount; });
+		EXPECT_EQ(match_amount, limited_match_amount);
+	}
+}
+
+TEST(AhoCorasickTest, WideAlphabetTest) {
+	// Shallow states of a 16-bit alphabet would take a row of 64Ki entries each
+	std::default_random_engine rander;
+	std::vector<std::vector<uint16_t>> pattern_array(2000);
+	for (auto &pattern: pattern_array) {
+		pattern.resize(3);
+		for (auto &value: pattern) { value = static_cast<uint16_t>(rander()); }
+	}
+	std::vector<uint16_t> text(20000);
+	for (size_t i = 0; i < text.size(); ++i) {
+		text[i] = (i % 100 < 3) ? pattern_array[i / 100 % pattern_array.size()][i % 100] : static_cast<uint16_t>(rander());
+	}
+
+	algorithm::AhoCorasick<uint16_t> matcher{pattern_array};
+	EXPECT_EQ(matcher.dense_state_amount(), algorithm::AhoCorasick<uint16_t>::DENSE_MAX_TABLE_SIZE / (64 * 1024));
+	EXPECT_LE(matcher.table_bytes(), algorithm::AhoCorasick<uint16_t>::DENSE_MAX_TABLE_SIZE * sizeof(uint32_t) + matcher.state_amount() * 16);
+
+	std::vector<Match> expected_array;
+	for (size_t pattern_id = 0; pattern_id < pattern_array.size(); ++pattern_id) {
+		const std::vector<uint16_t> &pattern = pattern_array[pattern_id];
+		for (auto iter = std::search(text.begin(), text.end(), pattern.begin(), pattern.end()); iter != text.end();
+		     iter = std::search(iter + 1, text.end(), pattern.begin(), pattern.end())) {
+			expected_array.emplace_back(pattern_id, iter - text.begin());
+		}
+	}
+	std::sort(expected_array.begin(), expected_array.end());
+
+	std::vector<Match> match_array;
+	matcher.find_all(text.begin(), text.end(), [&](size_t pattern_id, size_t offset) { match_array.emplace_back(pattern_id, offset); });
+	std::sort(match_array.begin(), match_array.end());
+	EXPECT_GE(match_array.size(), text.size() / 100);
+	EXPECT_EQ(match_array, expected_array);
+
+	// All shallow states of 8-bit values are still dense
+	algorithm::AhoCorasick<char> char_matcher{std::vector<std::string>{"ab", "b", "ca"}};
+	EXPECT_EQ(char_matcher.dense_state_amount(), 4);
+}
+
+TEST(AhoCorasickTest, IntTest) {
+	// The alphabet of int is too wide for dense rows, unless bounded explicitly
+	std::default_random_engine rander;
+	const std::vector<int> value_array{std::numeric_limits<int>::min(), std::numeric_limits<int>::max(), 0, -1, 5};
+
+	for (uint32_t i = 0; i < 50; ++i) {
+		std::vector<std::vector<int>> pattern_array(rander() % 20 + 1);
+		for (auto &pattern: pattern_array) {
+			pattern.resize(rander() % 4 + 1);
+			for (auto &value: pattern) { value = value_array[rander() % value_array.size()]; }
+		}
+		std::vector<int> text(rander() % 500);
+		for (auto &value: text) { value = value_array[rander() % value_array.size()]; }
+
+		std::vector<Match> expected_array;
+		for (size_t pattern_id = 0; pattern_id < pattern_array.size(); ++pattern_id) {
+			const std::vector<int> &pattern = pattern_array[pattern_id];
+			for (auto iter = std::search(text.begin(), text.end(), pattern.begin(), pattern.end()); iter != text.end();
+			     iter = std::search(iter + 1, text.end(), pattern.begin(), pattern.end())) {
+				expected_array.emplace_back(pattern_id, iter - text.begin());
+			}
+		}
+		std::sort(expected_array.begin(), expected_array.end());
+
+		algorithm::AhoCorasick<int> matcher{pattern_array};
+		std::vector<Match> match_array;
+		matcher.find_all(text.begin(), text.end(), [&](size_t pattern_id, size_t offset) { match_array.emplace_back(pattern_id, offset); });
+		std::sort(match_array.begin(), match_array.end());
+		EXPECT_EQ(match_array, expected_array);
+	}
+
+	const std::vector<std::vector<int>> pattern_array{{1, 2}, {2, 3}};
+	const std::vector<int> text{0, 1, 2, 3, 1, 2};
+	algorithm::AhoCorasick<int> bounded_matcher{pattern_array, 0, 9};
+	std::vector<Match> match_array;
+	bounded_matcher.find_all(text.begin(), text.end(), [&](size_t pattern_id, size_t offset) { match_array.emplace_back(pattern_id, offset); });
+	EXPECT_EQ(match_array, (std::vector<Match>{{0, 1}, {1, 2}, {0, 4}}));
+}
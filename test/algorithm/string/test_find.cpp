@@ -4,8 +4,12 @@
 */
 
 
+#include <deque>
+#include <limits>
+#include <list>
 #include <random>
 #include <vector>
+#include <algorithm>
 #include <gtest/gtest.h>
 
 #include <algorithm/string/search.h>
@@ -108,4 +112,118 @@ TEST(StringAlgorithmTest, StringAlgorithmRandomBoyerMooreFindTest) {
 			EXPECT_EQ(iter - base_str.begin(), res_pos);
 		}
 	}
-}
\ No newline at end of file
+}
+
+TEST(StringAlgorithmTest, StringAlgorithmRandomHorspoolFindTest) {
+	std::default_random_engine rander;
+
+	for (uint32_t i = 0; i < 200; ++i) {
+		size_t base_length    = std::max(rander(), 128UL) % 4096UL;
+		size_t pattern_length = rander() % 4 + 1;
+
+		std::string base_str; base_str.resize(base_length);
+		std::string pattern_str; pattern_str.resize(pattern_length);
+
+		for (auto &c: base_str) {
+			c = rander() % 4 + 'a';
+		}
+		for (auto &c: pattern_str) {
+			c = rander() % 4 + 'a';
+		}
+
+		auto iter = algorithm::string::horspool_find(pattern_str.begin(), pattern_str.end(),
+		                                             base_str.begin(), base_str.end());
+		auto res_pos = base_str.find(pattern_str);
+
+		if (res_pos == std::string::npos) {
+			EXPECT_EQ(iter, base_str.end());
+		}
+		else {
+			EXPECT_EQ(iter - base_str.begin(), res_pos);
+		}
+	}
+}
+
+template<class Value>
+void check_wide_value_find() {
+	// Tables of the whole type are clamped, where extremes of the type share slots with small values
+	std::default_random_engine rander;
+	const std::vector<Value> value_array{std::numeric_limits<Value>::min(), std::numeric_limits<Value>::max(),
+	                                     static_cast<Value>(0), static_cast<Value>(1), static_cast<Value>(1 << 16)};
+	for (uint32_t i = 0; i < 200; ++i) {
+		std::vector<Value> pattern(rander() % 4 + 1), base(rander() % 1000);
+		for (auto &value: pattern) { value = value_array[rander() % value_array.size()]; }
+		for (auto &value: base)    { value = value_array[rander() % value_array.size()]; }
+
+		const auto expected_iter = std::search(base.begin(), base.end(), pattern.begin(), pattern.end());
+		EXPECT_EQ(algorithm::string::boyer_moore_find(pattern.begin(), pattern.end(), base.begin(), base.end()), expected_iter);
+		EXPECT_EQ(algorithm::string::horspool_find(pattern.begin(), pattern.end(), base.begin(), base.end()), expected_iter);
+	}
+}
+
+TEST(StringAlgorithmTest, StringAlgorithmWideValueFindTest) {
+	check_wide_value_find<int>();
+	check_wide_value_find<uint64_t>();
+}
+
+TEST(StringAlgorithmTest, StringAlgorithmRandomSIMDFindTest) {
+	std::default_random_engine rander;
+
+	for (uint32_t i = 0; i < 2000; ++i) {
+		// Small alphabets and patterns produce both candidates failing memcmp and matches near the end
+		size_t base_length    = rander() % 300;
+		size_t pattern_length = rander() % 6;
+		char   alphabet       = (i % 2 == 0) ? 2 : 26;
+
+		std::string base_str; base_str.resize(base_length);
+		std::string pattern_str; pattern_str.resize(pattern_length);
+
+		for (auto &c: base_str) {
+			c = rander() % alphabet + 'a';
+		}
+		for (auto &c: pattern_str) {
+			c = rander() % alphabet + 'a';
+		}
+
+		auto res_pos = base_str.find(pattern_str);
+		auto check = [&](auto iter, auto begin_iter) {
+			if (res_pos == std::string::npos) {
+				EXPECT_EQ(std::distance(begin_iter, iter), base_length) << base_str << " " << pattern_str;
+			}
+			else {
+				EXPECT_EQ(std::distance(begin_iter, iter), res_pos) << base_str << " " << pattern_str;
+			}
+		};
+
+		check(algorithm::string::simd_find(pattern_str.begin(), pattern_str.end(), base_str.begin(), base_str.end()),
+		      base_str.begin());
+
+		// Non-contiguous ranges fall back
+		std::deque<char> base_deque(base_str.begin(), base_str.end());
+		check(algorithm::string::simd_find(pattern_str.begin(), pattern_str.end(), base_deque.begin(), base_deque.end()),
+		      base_deque.begin());
+		std::list<char> base_list(base_str.begin(), base_str.end());
+		check(algorithm::string::simd_find(pattern_str.begin(), pattern_str.end(), base_list.begin(), base_list.end()),
+		      base_list.begin());
+	}
+}
+
+TEST(StringAlgorithmTest, StringAlgorithmSIMDSubstringISATest) {
+	using namespace algorithm::simd;
+	std::default_random_engine rander;
+
+	for (uint32_t i = 0; i < 2000; ++i) {
+		std::vector<uint8_t> base(rander() % 300), pattern(rander() % 5 + 2);
+		for (auto &c: base)    { c = rander() % 2; }
+		for (auto &c: pattern) { c = rander() % 2; }
+
+		const size_t res_pos = std::search(base.begin(), base.end(), pattern.begin(), pattern.end()) - base.begin();
+		EXPECT_EQ(scalar::find_substring(base.data(), base.size(), pattern.data(), pattern.size()), res_pos);
+		if (is_isa_supported(ISA::AVX2)) {
+			EXPECT_EQ(avx2::find_substring(base.data(), base.size(), pattern.data(), pattern.size()), res_pos);
+		}
+		if (is_isa_supported(ISA::AVX512)) {
+			EXPECT_EQ(avx512::find_substring(base.data(), base.size(), pattern.data(), pattern.size()), res_pos);
+		}
+	}
+}
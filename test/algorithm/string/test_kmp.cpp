@@ -0,0 +1,143 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <algorithm/string/search.h>
+
+namespace {
+
+	std::vector<size_t> brute_force_find_all(const std::string &pattern, const std::string &text, bool overlapping) {
+		std::vector<size_t> pos_array;
+		for (size_t pos = text.find(pattern); pos != std::string::npos;
+		     pos = text.find(pattern, pos + (overlapping ? 1 : pattern.size()))) {
+			pos_array.push_back(pos);
+		}
+		return pos_array;
+	}
+
+	std::string get_random_string(std::default_random_engine &rander, size_t size, char alphabet) {
+		std::string str(size, 'a');
+		for (auto &c: str) { c = static_cast<char>(rander() % alphabet + 'a'); }
+		return str;
+	}
+
+	/*
+	 * Periodic patterns have long borders, and long patterns exceed the limit of DFA.
+	 */
+	void check_kmp(const std::string &pattern, const std::string &text, std::default_random_engine &rander) {
+		algorithm::KMP<char> finder{pattern.begin(), pattern.end()};
+
+		const std::vector<size_t> overlap_array     = brute_force_find_all(pattern, text, true);
+		const std::vector<size_t> non_overlap_array = brute_force_find_all(pattern, text, false);
+
+		const auto iter = finder.find(text.begin(), text.end());
+		EXPECT_EQ(iter - text.begin(), overlap_array.empty() ? text.size() : overlap_array.front());
+
+		std::vector<size_t> iter_pos_array;
+		for (auto match_iter: finder.find_all(text.begin(), text.end())) { iter_pos_array.push_back(match_iter - text.begin()); }
+		EXPECT_EQ(iter_pos_array, overlap_array);
+
+		std::vector<size_t> pos_array(text.size() + 1);
+		pos_array.resize(finder.find_all(std::span<const char>{text}, std::span<size_t>{pos_array}));
+		EXPECT_EQ(pos_array, overlap_array);
+
+		pos_array.resize(text.size() + 1);
+		pos_array.resize(finder.find_all(std::span<const char>{text}, std::span<size_t>{pos_array}, algorithm::KMPMatchMode::NonOverlapping));
+		EXPECT_EQ(pos_array, non_overlap_array);
+
+		// A buffer stops the search when full
+		if (overlap_array.size() > 1) {
+			std::vector<size_t> short_pos_array(1);
+			EXPECT_EQ(finder.find_all(std::span<const char>{text}, std::span<size_t>{short_pos_array}), 1);
+			EXPECT_EQ(short_pos_array.front(), overlap_array.front());
+		}
+
+		std::vector<size_t> stream_pos_array;
+		for (size_t pos = 0; pos < text.size();) {
+			const size_t chunk_size = std::min<size_t>(rander() % 16 + 1, text.size() - pos);
+			finder.feed(std::span<const char>{text.data() + pos, chunk_size}, [&](size_t offset) {
+				stream_pos_array.push_back(offset);
+			});
+			pos += chunk_size;
+		}
+		EXPECT_EQ(stream_pos_array, overlap_array);
+	}
+
+}
+
+TEST(KMPTest, DFATest) {
+	std::default_random_engine rander;
+	for (uint32_t i = 0; i < 200; ++i) {
+		const char alphabet = (i % 2 == 0) ? 2 : 26;
+		const std::string pattern = get_random_string(rander, rander() % 8 + 1, alphabet);
+		const std::string text    = get_random_string(rander, rander() % 2000, alphabet);
+
+		EXPECT_TRUE((algorithm::KMP<char>{pattern.begin(), pattern.end()}.is_dfa()));
+		check_kmp(pattern, text, rander);
+	}
+}
+
+TEST(KMPTest, FailureFunctionTest) {
+	std::default_random_engine rander;
+	for (uint32_t i = 0; i < 50; ++i) {
+		// A periodic pattern over many kinds of value
+		const std::string period  = get_random_string(rander, rander() % 100 + 26, 26) + "abcdefghijklmnopqrstuvwxyz";
+		std::string pattern;
+		while (pattern.size() < 3000) { pattern += period; }
+		std::string text;
+		while (text.size() < 20000) { text += (rander() % 4 == 0) ? get_random_string(rander, 10, 26) : period; }
+
+		EXPECT_FALSE((algorithm::KMP<char>{pattern.begin(), pattern.end()}.is_dfa()));
+		check_kmp(pattern, text, rander);
+	}
+}
+
+TEST(KMPTest, AlphabetTest) {
+	// Values out of [min_value, max_value] in the base never match
+	const std::string pattern = "abab";
+	const std::string text    = "xxababab!abab";
+	algorithm::KMP<char> finder{pattern.begin(), pattern.end(), 'a', 'z'};
+	EXPECT_EQ(finder.find_all(text.begin(), text.end()).size(), 3);
+	EXPECT_EQ(algorithm::kmp_find(pattern.begin(), pattern.end(), text.begin(), text.end(), 'a', 'z') - text.begin(), 2);
+}
+
+template<class Value>
+void check_wide_value() {
+	// The alphabet of the whole type is wider than the class map, including extremes of the type
+	std::default_random_engine rander;
+	const std::vector<Value> value_array{std::numeric_limits<Value>::min(), std::numeric_limits<Value>::max(),
+	                                     static_cast<Value>(0), static_cast<Value>(-1)};
+	for (uint32_t i = 0; i < 50; ++i) {
+		std::vector<Value> pattern(rander() % 6 + 1), text(rander() % 500);
+		for (auto &value: pattern) { value = value_array[rander() % 3]; }
+		for (auto &value: text)    { value = value_array[rander() % value_array.size()]; }
+
+		const algorithm::KMP<Value> finder{pattern.begin(), pattern.end()};
+		EXPECT_FALSE(finder.is_dfa());
+
+		const auto expected_iter = std::search(text.begin(), text.end(), pattern.begin(), pattern.end());
+		EXPECT_EQ(finder.find(text.begin(), text.end()), expected_iter);
+		EXPECT_EQ(algorithm::kmp_find(pattern.begin(), pattern.end(), text.begin(), text.end()), expected_iter);
+	}
+
+	// An explicit narrow range still compiles to DFA
+	const std::vector<Value> pattern{1, 2, 1};
+	const std::vector<Value> text{0, 1, 2, 1, 2, 1};
+	const algorithm::KMP<Value> finder{pattern.begin(), pattern.end(), static_cast<Value>(0), static_cast<Value>(9)};
+	EXPECT_TRUE(finder.is_dfa());
+	EXPECT_EQ(finder.find_all(text.begin(), text.end()).size(), 2);
+}
+
+TEST(KMPTest, WideValueTest) {
+	check_wide_value<int>();
+	check_wide_value<uint64_t>();
+}
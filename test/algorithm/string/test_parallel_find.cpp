@@ -0,0 +1,86 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <file/file_descriptor.h>
+#include <algorithm/string/search.h>
+
+namespace {
+
+	/// A text file in the temporary directory, removed on destruction
+	struct TextFile {
+		std::string path;
+
+		explicit TextFile(const std::string &text) {
+			path = (std::filesystem::temp_directory_path() / ("parallel_find_test_" + std::to_string(getpid()))).string();
+			std::ofstream(path, std::ios::binary).write(text.data(), static_cast<std::streamsize>(text.size()));
+		}
+
+		~TextFile() {
+			std::filesystem::remove(path);
+		}
+	};
+
+	std::vector<size_t> brute_force_find_all(const std::string &pattern, const std::string &text) {
+		std::vector<size_t> pos_array;
+		for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+			pos_array.push_back(pos);
+		}
+		return pos_array;
+	}
+
+	std::span<const uint8_t> as_bytes(const std::string &str) {
+		return {reinterpret_cast<const uint8_t *>(str.data()), str.size()};
+	}
+
+}
+
+TEST(ParallelFindTest, RangeTest) {
+	std::default_random_engine rander;
+	std::string text(300 * 1024, 'a');
+	for (auto &c: text) { c = static_cast<char>(rander() % 2 + 'a'); }
+
+	for (const std::string pattern: {"a", "abba", "ababababab", "bbbbbbbbbbbbbbbbbbbb"}) {
+		const std::vector<size_t> pos_array = brute_force_find_all(pattern, text);
+		// Small chunks put many matches across the edges of chunks
+		for (size_t thread_amount: {1, 2, 3}) {
+			EXPECT_EQ(algorithm::parallel_find_all(as_bytes(text), as_bytes(pattern), thread_amount, 1), pos_array);
+			EXPECT_EQ(algorithm::parallel_find_all<algorithm::BoyerMoore<uint8_t>>(as_bytes(text), as_bytes(pattern), thread_amount, 8192),
+			          pos_array);
+		}
+	}
+	EXPECT_TRUE(algorithm::parallel_find_all(as_bytes(text), as_bytes(""), 2).empty());
+}
+
+TEST(ParallelFindTest, FileTest) {
+	std::default_random_engine rander;
+	std::string text(1024 * 1024 + 123, 'a');
+	for (auto &c: text) { c = static_cast<char>(rander() % 26 + 'a'); }
+	const std::string pattern = "needle";
+	for (size_t pos = 4090; pos < text.size(); pos += 65536) { text.replace(pos, pattern.size(), pattern); }
+
+	TextFile text_file(text);
+	algorithm::file::FileDescriptor descriptor(text_file.path, algorithm::file::FileOpenType::ReadOnly);
+	ASSERT_TRUE(descriptor.is_open());
+	const algorithm::file::FileMapper mapper = descriptor.get_mapper(algorithm::file::FileMmapProt::Readable,
+	                                                                 algorithm::file::FileMmapFlag::Private);
+	ASSERT_TRUE(mapper.is_mapped());
+
+	const std::vector<size_t> pos_array = brute_force_find_all(pattern, text);
+	EXPECT_EQ(pos_array.size(), 16);
+	for (size_t thread_amount: {1, 4}) {
+		EXPECT_EQ(algorithm::parallel_find_all(mapper, as_bytes(pattern), thread_amount, 4096), pos_array);
+	}
+}
@@ -0,0 +1,92 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+
+#include <random>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <algorithm/string/search.h>
+
+namespace {
+
+	std::vector<size_t> brute_force_find_all(const std::string &pattern, const std::string &text) {
+		std::vector<size_t> pos_array;
+		for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+			pos_array.push_back(pos);
+		}
+		return pos_array;
+	}
+
+	std::string get_random_string(std::default_random_engine &rander, size_t size, char alphabet) {
+		std::string str(size, 'a');
+		for (auto &c: str) { c = static_cast<char>(rander() % alphabet + 'a'); }
+		return str;
+	}
+
+}
+
+template<class Searcher>
+class StreamSearcherTest: public testing::Test {};
+
+using SearcherTypes = testing::Types<algorithm::SimpleSearcher<char>, algorithm::KMP<char>,
+                                     algorithm::BoyerMoore<char>, algorithm::Horspool<char>>;
+TYPED_TEST_SUITE(StreamSearcherTest, SearcherTypes);
+
+TYPED_TEST(StreamSearcherTest, WholeTest) {
+	std::default_random_engine rander;
+	for (uint32_t i = 0; i < 200; ++i) {
+		const char alphabet = (i % 2 == 0) ? 2 : 4;
+		const std::string pattern = get_random_string(rander, rander() % 12 + 1, alphabet);
+		const std::string text    = get_random_string(rander, rander() % 2000, alphabet);
+		const std::vector<size_t> pos_array = brute_force_find_all(pattern, text);
+
+		const TypeParam searcher{pattern.begin(), pattern.end()};
+		const auto iter = searcher.find(text.begin(), text.end());
+		EXPECT_EQ(iter - text.begin(), pos_array.empty() ? text.size() : pos_array.front()) << pattern << " in " << text;
+	}
+}
+
+TYPED_TEST(StreamSearcherTest, ChunkTest) {
+	std::default_random_engine rander;
+	for (uint32_t i = 0; i < 200; ++i) {
+		const char alphabet = (i % 2 == 0) ? 2 : 4;
+		const std::string pattern = get_random_string(rander, rander() % 12 + 1, alphabet);
+		const std::string text    = get_random_string(rander, rander() % 2000, alphabet);
+
+		algorithm::StreamSearcher<TypeParam> stream_searcher{pattern.begin(), pattern.end()};
+		std::vector<size_t> pos_array;
+		// Chunks shorter than the pattern, including empty ones, are fed as well
+		for (size_t pos = 0; pos < text.size();) {
+			const size_t max_chunk_size = (i % 3 == 0) ? 4 : 64;
+			const size_t chunk_size     = std::min<size_t>(rander() % (max_chunk_size + 1), text.size() - pos);
+			stream_searcher.feed(std::span<const char>{text.data() + pos, chunk_size}, [&](size_t offset) {
+				pos_array.push_back(offset);
+			});
+			pos += chunk_size;
+		}
+		EXPECT_EQ(stream_searcher.get_offset(), text.size());
+		EXPECT_EQ(pos_array, brute_force_find_all(pattern, text)) << pattern << " in " << text;
+
+		stream_searcher.reset();
+		pos_array.clear();
+		stream_searcher.feed(std::span<const char>{text}, [&](size_t offset) { pos_array.push_back(offset); });
+		EXPECT_EQ(pos_array, brute_force_find_all(pattern, text));
+	}
+}
+
+TEST(StreamSearcherTest, BoyerMooreFindAllTest) {
+	std::default_random_engine rander;
+	for (uint32_t i = 0; i < 200; ++i) {
+		const std::string pattern = get_random_string(rander, rander() % 8 + 1, 2);
+		const std::string text    = get_random_string(rander, rander() % 1000, 2);
+
+		const algorithm::BoyerMoore<char> searcher{pattern.begin(), pattern.end()};
+		std::vector<size_t> pos_array;
+		for (auto iter: searcher.find_all(text.begin(), text.end())) { pos_array.push_back(iter - text.begin()); }
+		EXPECT_EQ(pos_array, brute_force_find_all(pattern, text)) << pattern << " in " << text;
+	}
+}
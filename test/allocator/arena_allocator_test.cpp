@@ -0,0 +1,75 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstdint>
+#include <gtest/gtest.h>
+
+#include <allocator/allocator.h>
+#include <structure/list/list.h>
+#include <structure/list/forward_list.h>
+
+using namespace algorithm;
+
+static_assert(allocator::AllocatorConcept<allocator::ArenaAllocator<uint64_t>>);
+
+TEST(ArenaAllocatorTest, ArenaAllocatorTestAlign) {
+	allocator::Arena arena;
+
+	void *byte_ptr = arena.allocate(1, 1);
+	void *word_ptr = arena.allocate(sizeof(uint64_t), alignof(uint64_t));
+	EXPECT_NE(byte_ptr, word_ptr);
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(word_ptr) % alignof(uint64_t), 0);
+
+	// Allocation larger than a block is placed in a dedicated block
+	void *large_ptr = arena.allocate(allocator::Arena::MAX_BLOCK_SIZE * 2, 64);
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(large_ptr) % 64, 0);
+	EXPECT_GE(arena.get_reserved_size(), allocator::Arena::MAX_BLOCK_SIZE * 2);
+}
+
+TEST(ArenaAllocatorTest, ArenaAllocatorTestRewind) {
+	allocator::Arena arena;
+	allocator::ArenaAllocator<uint64_t> allocator(arena);
+
+	uint64_t *first_ptr = allocator.construct(1);
+	auto marker = arena.get_marker();
+
+	uint64_t *second_ptr = allocator.construct(2);
+	for (size_t i = 0; i < 100000; ++i) {
+		allocator.construct(i);
+	}
+	arena.rewind(marker);
+
+	// Memory after the marker is reused
+	EXPECT_EQ(allocator.construct(3), second_ptr);
+	EXPECT_EQ(*first_ptr, 1);
+
+	arena.reset();
+	EXPECT_LE(arena.get_reserved_size(), allocator::Arena::MAX_BLOCK_SIZE);
+}
+
+TEST(ArenaAllocatorTest, ArenaAllocatorTestContainer) {
+	allocator::Arena arena;
+	{
+		allocator::ArenaScope scope(arena);
+
+		structure::List<uint32_t, allocator::ArenaAllocator<uint32_t>> list;
+		structure::ForwardList<uint32_t, allocator::ArenaAllocator<uint32_t>> forward_list;
+		for (uint32_t i = 0; i < 160; ++i) {
+			list.push_back(i);
+			forward_list.push_back(i);
+		}
+		EXPECT_EQ(list.size(), 160);
+		EXPECT_EQ(forward_list.size(), 160);
+		for (uint32_t idx = 0; uint32_t &iter: list) {
+			EXPECT_EQ(iter, idx);
+			++idx;
+		}
+	}
+	EXPECT_GT(arena.get_reserved_size(), 0);
+	EXPECT_EQ(&allocator::ArenaAllocator<uint32_t>().get_arena(), &allocator::get_current_arena());
+	EXPECT_NE(&allocator::get_current_arena(), &arena);
+
+	arena.reset();
+}
@@ -0,0 +1,112 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <numaif.h>
+
+#include <allocator/allocator.h>
+#include <structure/list/list.h>
+#include <structure/array/small_vector.h>
+
+using namespace algorithm;
+
+namespace {
+
+	/// Query the node on which the page of address resides, or -1 if unknown
+	int get_node_of_address(void *ptr) {
+		int node_id = -1;
+		if (get_mempolicy(&node_id, nullptr, 0, ptr, MPOL_F_NODE | MPOL_F_ADDR) != 0) {
+			return -1;
+		}
+		return node_id;
+	}
+
+}
+
+static_assert(allocator::AllocatorConcept<allocator::NUMAAllocator<uint64_t>>);
+static_assert(allocator::AllocatorConcept<allocator::NUMAAllocator<uint64_t, allocator::NUMAPolicy::Interleaved>>);
+
+TEST(NUMAAllocatorTest, NUMAAllocatorTestConstruct) {
+	constexpr size_t ALLOC_AMOUNT = 1000;
+
+	allocator::NUMAAllocator<uint64_t> allocator;
+	std::vector<uint64_t *> ptr_array;
+	for (size_t i = 0; i < ALLOC_AMOUNT; ++i) {
+		ptr_array.push_back(allocator.construct(i));
+	}
+	for (size_t i = 0; i < ALLOC_AMOUNT; ++i) {
+		EXPECT_EQ(*ptr_array[i], i);
+		allocator.deconstruct(ptr_array[i]);
+	}
+}
+
+TEST(NUMAAllocatorTest, NUMAAllocatorTestAllocateOn) {
+	constexpr size_t SMALL_AMOUNT = 64;
+	constexpr size_t LARGE_AMOUNT = 1024 * 1024;
+
+	allocator::NUMAAllocator<uint8_t> allocator;
+	for (int node_id = 0; node_id < allocator::get_numa_allocator_pool().get_node_amount(); ++node_id) {
+		for (size_t amount: {SMALL_AMOUNT, LARGE_AMOUNT}) {
+			uint8_t *ptr = allocator.allocate_on(node_id, amount);
+			// Touch pages before querying their placement
+			std::memset(ptr, 0xFF, amount);
+			if (memory::is_numa_available()) {
+				EXPECT_EQ(get_node_of_address(ptr), node_id);
+			}
+			allocator.deallocate(ptr, amount);
+		}
+	}
+}
+
+TEST(NUMAAllocatorTest, NUMAAllocatorTestReallocate) {
+	allocator::NUMAAllocator<uint32_t, allocator::NUMAPolicy::Interleaved> allocator;
+
+	uint32_t *ptr = allocator.allocate(4);
+	for (uint32_t i = 0; i < 4; ++i) { ptr[i] = i; }
+
+	ptr = allocator.reallocate(ptr, 4, 1024);
+	for (uint32_t i = 0; i < 4; ++i) { EXPECT_EQ(ptr[i], i); }
+	allocator.deallocate(ptr, 1024);
+}
+
+TEST(NUMAAllocatorTest, NUMAAllocatorTestRemoteFree) {
+	constexpr size_t ALLOC_AMOUNT = 1000;
+
+	std::vector<uint64_t *> ptr_array;
+	std::thread producer([&] {
+		allocator::NUMAAllocator<uint64_t> allocator;
+		for (size_t i = 0; i < ALLOC_AMOUNT; ++i) {
+			ptr_array.push_back(allocator.construct(i));
+		}
+	});
+	producer.join();
+
+	// Chunks cached by the exited thread are given back to heaps
+	allocator::NUMAAllocator<uint64_t> allocator;
+	for (size_t i = 0; i < ALLOC_AMOUNT; ++i) {
+		EXPECT_EQ(*ptr_array[i], i);
+		allocator.deconstruct(ptr_array[i]);
+	}
+}
+
+TEST(NUMAAllocatorTest, NUMAAllocatorTestContainer) {
+	structure::List<uint32_t, allocator::NUMAAllocator<uint32_t>> list;
+	structure::SmallVector<uint32_t, 2, allocator::NUMAAllocator<uint32_t>> vector;
+	for (uint32_t i = 0; i < 160; ++i) {
+		list.push_back(i);
+		vector.push_back(i);
+	}
+
+	EXPECT_EQ(list.size(), 160);
+	for (uint32_t idx = 0; uint32_t &iter: list) {
+		EXPECT_EQ(iter, idx);
+		EXPECT_EQ(vector[idx], idx);
+		++idx;
+	}
+}
@@ -0,0 +1,168 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <allocator/allocator.h>
+#include <structure/list/list.h>
+
+using namespace algorithm;
+
+namespace {
+
+	constexpr size_t HEAP_SIZE = 4 * 1024 * 1024;
+
+	/// A heap file on tmpfs (or the temporary directory), removed on destruction
+	struct HeapFile {
+		std::string path;
+
+		HeapFile() {
+			std::filesystem::path dir = std::filesystem::exists("/dev/shm") ?
+			                            std::filesystem::path("/dev/shm") : std::filesystem::temp_directory_path();
+			path = (dir / ("persistent_heap_test_" + std::to_string(getpid()))).string();
+			std::filesystem::remove(path);
+		}
+
+		~HeapFile() {
+			std::filesystem::remove(path);
+		}
+	};
+
+	struct Record {
+		uint64_t key;
+		uint64_t value;
+	};
+
+}
+
+static_assert(allocator::AllocatorConcept<allocator::PersistentAllocator<uint64_t>>);
+
+TEST(PersistentAllocatorTest, PersistentAllocatorTestReuse) {
+	HeapFile heap_file;
+	allocator::PersistentHeap heap(heap_file.path, HEAP_SIZE);
+
+	void *small_ptr = heap.allocate(64);
+	void *large_ptr = heap.allocate(64 * 1024);
+	EXPECT_EQ(heap.get_used_size(), 64 + 64 * 1024);
+
+	heap.deallocate(small_ptr, 64);
+	heap.deallocate(large_ptr, 64 * 1024);
+	EXPECT_EQ(heap.get_used_size(), 0);
+
+	EXPECT_EQ(heap.allocate(64), small_ptr);
+	EXPECT_THROW(heap.allocate(HEAP_SIZE), std::bad_alloc);
+}
+
+TEST(PersistentAllocatorTest, PersistentAllocatorTestMerge) {
+	HeapFile heap_file;
+	allocator::PersistentHeap heap(heap_file.path, HEAP_SIZE);
+
+	// Fill the heap with small blocks, then free all of them
+	std::vector<void *> ptr_array;
+	while (heap.get_used_size() < heap.get_capacity()) { ptr_array.push_back(heap.allocate(64)); }
+	EXPECT_THROW(heap.allocate(64), std::bad_alloc);
+	for (void *ptr: ptr_array) { heap.deallocate(ptr, 64); }
+	EXPECT_EQ(heap.get_used_size(), 0);
+
+	// Small blocks are merged to serve larger requests, up to the whole heap
+	void *medium_ptr = heap.allocate(128);
+	void *large_ptr  = heap.allocate(6400);
+	heap.deallocate(medium_ptr, 128);
+	heap.deallocate(large_ptr, 6400);
+	EXPECT_EQ(heap.get_used_size(), 0);
+	void *whole_ptr = heap.allocate(heap.get_capacity());
+	EXPECT_EQ(whole_ptr, ptr_array.front());
+}
+
+TEST(PersistentAllocatorTest, PersistentAllocatorTestRecover) {
+	constexpr size_t RECORD_AMOUNT = 1000;
+
+	HeapFile heap_file;
+	std::vector<uint64_t> offset_array;
+	size_t used_size;
+	{
+		allocator::PersistentHeap heap(heap_file.path, HEAP_SIZE);
+		auto *root_ptr = static_cast<uint64_t *>(heap.allocate(sizeof(uint64_t) * RECORD_AMOUNT));
+		for (size_t i = 0; i < RECORD_AMOUNT; ++i) {
+			auto *record_ptr = static_cast<Record *>(heap.allocate(sizeof(Record)));
+			*record_ptr = { i, i * i };
+			allocator::PersistentHeap::persist(record_ptr, sizeof(Record));
+
+			root_ptr[i] = heap.to_offset(record_ptr);
+			offset_array.push_back(root_ptr[i]);
+		}
+		allocator::PersistentHeap::persist(root_ptr, sizeof(uint64_t) * RECORD_AMOUNT);
+		heap.set_root(root_ptr);
+
+		// Release half of records, whose space is spare after restart
+		for (size_t i = 0; i < RECORD_AMOUNT; i += 2) {
+			heap.deallocate(heap.from_offset(offset_array[i]), sizeof(Record));
+		}
+		used_size = heap.get_used_size();
+	}
+
+	allocator::PersistentHeap heap(heap_file.path, 0);
+	EXPECT_EQ(heap.get_used_size(), used_size);
+
+	auto *root_ptr = heap.get_root<uint64_t>();
+	ASSERT_NE(root_ptr, nullptr);
+	for (size_t i = 1; i < RECORD_AMOUNT; i += 2) {
+		auto *record_ptr = static_cast<Record *>(heap.from_offset(root_ptr[i]));
+		EXPECT_EQ(record_ptr->key, i);
+		EXPECT_EQ(record_ptr->value, i * i);
+	}
+
+	// New blocks never overlap alive records
+	for (size_t i = 0; i < RECORD_AMOUNT / 2; ++i) {
+		uint64_t offset = heap.to_offset(heap.allocate(sizeof(Record)));
+		for (size_t j = 1; j < RECORD_AMOUNT; j += 2) {
+			ASSERT_NE(offset, offset_array[j]);
+		}
+	}
+}
+
+TEST(PersistentAllocatorTest, PersistentAllocatorTestList) {
+	using List = structure::List<uint64_t, allocator::PersistentAllocator<uint64_t>>;
+
+	HeapFile heap_file;
+	{
+		allocator::PersistentHeap heap(heap_file.path, HEAP_SIZE);
+		allocator::bind_persistent_heap(heap);
+
+		List *list_ptr = allocator::PersistentAllocator<List>().construct();
+		for (uint64_t i = 0; i < 160; ++i) {
+			list_ptr->push_back(i);
+		}
+		// List is unaware of persistence, so that the whole heap is persisted
+		heap.sync();
+		heap.set_root(list_ptr);
+		allocator::unbind_persistent_heap();
+	}
+
+	allocator::PersistentHeap heap(heap_file.path, 0);
+	if (!heap.is_address_stable()) {
+		GTEST_SKIP() << "The heap is relocated on restart";
+	}
+	allocator::bind_persistent_heap(heap);
+
+	List *list_ptr = heap.get_root<List>();
+	EXPECT_EQ(list_ptr->size(), 160);
+	for (uint64_t idx = 0; uint64_t &iter: *list_ptr) {
+		EXPECT_EQ(iter, idx);
+		++idx;
+	}
+	list_ptr->push_back(160);
+	EXPECT_EQ(list_ptr->size(), 161);
+
+	allocator::PersistentAllocator<List>().deconstruct(list_ptr);
+	EXPECT_EQ(heap.get_used_size(), 0);
+	allocator::unbind_persistent_heap();
+}
@@ -0,0 +1,191 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+
+#include <array>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <allocator/allocator.h>
+
+using namespace algorithm;
+
+TEST(ReserveAllocatorTest, ReserveAllocatorTestLocalReuse) {
+	auto &pool = allocator::get_thread_allocator_pool();
+
+	void *ptr = pool.allocate(64);
+	pool.deallocate(ptr, 64);
+
+	EXPECT_EQ(pool.allocate(64), ptr);
+	pool.deallocate(ptr, 64);
+}
+
+TEST(ReserveAllocatorTest, ReserveAllocatorTestRemoteFree) {
+	constexpr size_t ALLOC_AMOUNT = 1000;
+	constexpr size_t ALLOC_SIZE   = 64;
+
+	std::vector<void *> ptr_array;
+
+	std::thread producer([&] {
+		auto &pool = allocator::get_thread_allocator_pool();
+		for (size_t i = 0; i < ALLOC_AMOUNT; ++i) {
+			ptr_array.push_back(pool.allocate(ALLOC_SIZE));
+		}
+		size_t page_count = pool.stats().total_page_count();
+
+		// Release all chunks on another thread
+		std::thread consumer([&] {
+			auto &consumer_pool = allocator::get_thread_allocator_pool();
+			for (void *ptr: ptr_array) {
+				consumer_pool.deallocate(ptr, ALLOC_SIZE);
+			}
+		});
+		consumer.join();
+
+		// Chunks released remotely should be drained back by the owner instead of carving new pages
+		ptr_array.clear();
+		for (size_t i = 0; i < ALLOC_AMOUNT; ++i) {
+			ptr_array.push_back(pool.allocate(ALLOC_SIZE));
+		}
+		EXPECT_LE(pool.stats().total_page_count(), page_count);
+
+		for (void *ptr: ptr_array) {
+			pool.deallocate(ptr, ALLOC_SIZE);
+		}
+	});
+	producer.join();
+}
+
+TEST(ReserveAllocatorTest, ReserveAllocatorTestRetiredOwner) {
+	constexpr size_t ALLOC_AMOUNT = 1000;
+
+	std::vector<uint64_t *> ptr_array;
+
+	std::thread producer([&] {
+		allocator::ReserveAllocator<uint64_t> allocator;
+		for (size_t i = 0; i < ALLOC_AMOUNT; ++i) {
+			ptr_array.push_back(allocator.construct(i));
+		}
+	});
+	producer.join();
+
+	// The pool of producer has been retired, but its chunks are still valid.
+	allocator::ReserveAllocator<uint64_t> allocator;
+	for (size_t i = 0; i < ALLOC_AMOUNT; ++i) {
+		EXPECT_EQ(*ptr_array[i], i);
+		allocator.deconstruct(ptr_array[i]);
+	}
+}
+
+TEST(ReserveAllocatorTest, ReserveAllocatorTestPageReclaim) {
+	constexpr size_t ALLOC_AMOUNT = 1000;
+	constexpr size_t ALLOC_SIZE   = 64;
+	constexpr size_t CLASS_IDX    = allocator::ReserveAllocatorPool::get_chunk_idx(ALLOC_SIZE);
+
+	std::thread owner([&] {
+		auto &pool = allocator::get_thread_allocator_pool();
+
+		std::vector<void *> ptr_array;
+		for (size_t i = 0; i < ALLOC_AMOUNT; ++i) {
+			ptr_array.push_back(pool.allocate(ALLOC_SIZE));
+		}
+
+		auto stats = pool.stats().class_stats[CLASS_IDX];
+		EXPECT_EQ(stats.chunk_size, ALLOC_SIZE);
+		EXPECT_EQ(stats.live_bytes, ALLOC_AMOUNT * ALLOC_SIZE);
+		EXPECT_GE(stats.page_count * allocator::ReserveAllocatorPool::ALLOC_PAGE_SIZE, ALLOC_AMOUNT * ALLOC_SIZE);
+
+		// Half of chunks are released by another thread
+		std::thread consumer([&] {
+			auto &consumer_pool = allocator::get_thread_allocator_pool();
+			for (size_t i = 0; i < ALLOC_AMOUNT / 2; ++i) {
+				consumer_pool.deallocate(ptr_array[i], ALLOC_SIZE);
+			}
+		});
+		consumer.join();
+		for (size_t i = ALLOC_AMOUNT / 2; i < ALLOC_AMOUNT; ++i) {
+			pool.deallocate(ptr_array[i], ALLOC_SIZE);
+		}
+
+		stats = pool.stats().class_stats[CLASS_IDX];
+		EXPECT_EQ(stats.live_bytes, 0);
+		EXPECT_LE(stats.page_count, pool.get_free_page_limit());
+
+		pool.trim();
+		EXPECT_EQ(pool.stats().total_page_count(), 0);
+	});
+	owner.join();
+}
+
+TEST(ReserveAllocatorTest, ReserveAllocatorTestSizeClass) {
+	using Pool = allocator::ReserveAllocatorPool;
+
+	EXPECT_EQ(Pool::get_chunk_size(Pool::get_chunk_idx(1)), 16);
+	EXPECT_EQ(Pool::get_chunk_size(Pool::get_chunk_idx(64)), 64);
+	EXPECT_EQ(Pool::get_chunk_size(Pool::get_chunk_idx(72)), 80);
+	EXPECT_EQ(Pool::get_chunk_size(Pool::get_chunk_idx(1000)), 1024);
+	EXPECT_EQ(Pool::get_chunk_size(Pool::get_chunk_idx(60000)), 65536);
+	EXPECT_EQ(Pool::max_size(), 64 * 1024);
+
+	std::thread owner([&] {
+		auto &pool = allocator::get_thread_allocator_pool();
+
+		void *ptr = pool.allocate(72);
+		EXPECT_EQ(pool.stats().class_stats[Pool::get_chunk_idx(72)].live_bytes, 80);
+		pool.deallocate(ptr, 72);
+
+		// Blocks larger than the max class bypass slabs
+		ptr = pool.allocate(Pool::max_size() + 1);
+		EXPECT_EQ(pool.stats().total_live_bytes(), 0);
+		pool.deallocate(ptr, Pool::max_size() + 1);
+	});
+	owner.join();
+}
+
+TEST(ReserveAllocatorTest, ReserveAllocatorTestCustomPool) {
+	using Pool = allocator::BasicReserveAllocatorPool<allocator::SizeClassList<32, 48, 144>, 4096>;
+	constexpr size_t ALLOC_AMOUNT = 1000;
+
+	EXPECT_EQ(Pool::get_chunk_size(Pool::get_chunk_idx(40)), 48);
+	EXPECT_EQ(Pool::get_chunk_size(Pool::get_chunk_idx(100)), 144);
+
+	std::vector<std::array<uint64_t, 5> *> ptr_array;
+	allocator::ReserveAllocator<std::array<uint64_t, 5>, Pool> allocator;
+	for (size_t i = 0; i < ALLOC_AMOUNT; ++i) {
+		ptr_array.push_back(allocator.construct(std::array<uint64_t, 5>{i, i, i, i, i}));
+	}
+	EXPECT_EQ(allocator::get_thread_allocator_pool<Pool>().stats().total_live_bytes(), ALLOC_AMOUNT * 48);
+
+	for (size_t i = 0; i < ALLOC_AMOUNT; ++i) {
+		EXPECT_EQ((*ptr_array[i])[4], i);
+		allocator.deconstruct(ptr_array[i]);
+	}
+}
+
+TEST(ReserveAllocatorTest, ReserveAllocatorTestHugePage) {
+	using Pool = allocator::BasicReserveAllocatorPool<allocator::DefaultSizeClass, 2 * 1024 * 1024, true>;
+	constexpr size_t ALLOC_AMOUNT = 10000;
+	constexpr size_t ALLOC_SIZE   = 256;
+
+	std::thread owner([&] {
+		auto &pool = allocator::get_thread_allocator_pool<Pool>();
+
+		std::vector<void *> ptr_array;
+		for (size_t i = 0; i < ALLOC_AMOUNT; ++i) {
+			ptr_array.push_back(pool.allocate(ALLOC_SIZE));
+			std::memset(ptr_array.back(), static_cast<int>(i), ALLOC_SIZE);
+		}
+		EXPECT_EQ(pool.stats().total_page_count(), 2);
+
+		for (void *ptr: ptr_array) {
+			pool.deallocate(ptr, ALLOC_SIZE);
+		}
+		pool.trim();
+		EXPECT_EQ(pool.stats().total_page_count(), 0);
+	});
+	owner.join();
+}
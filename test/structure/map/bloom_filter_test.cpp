@@ -0,0 +1,521 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <structure/map/bloom_filter.h>
+#include <structure/map/blocked_bloom_filter.h>
+#include <structure/map/scalable_bloom_filter.h>
+#include <structure/map/counting_bloom_filter.h>
+#include <structure/map/concurrent_bloom_filter.h>
+#include <thread/cpu_bind_thread.h>
+
+using namespace algorithm;
+
+namespace {
+
+	structure::BloomParameter make_parameter(uint64_t element_count, double fpp) {
+		structure::BloomParameter parameter;
+		parameter.projected_element_count    = element_count;
+		parameter.false_positive_probability = fpp;
+		parameter.compute_optimal_parameters();
+		return parameter;
+	}
+
+	/// The ratio of positives among keys never inserted, i.e. [element_count, 2 * element_count)
+	template<class Filter>
+	double measure_fpp(const Filter &filter, uint64_t element_count) {
+		uint64_t positive_amount = 0;
+		for (uint64_t key = element_count; key < 2 * element_count; ++key) {
+			positive_amount += filter.contains(key);
+		}
+		return static_cast<double>(positive_amount) / element_count;
+	}
+
+}
+
+TEST(BloomFilterTest, Parameter) {
+	structure::BloomParameter parameter;
+	EXPECT_TRUE(parameter.valid());
+	EXPECT_TRUE(parameter.compute_optimal_parameters());
+	EXPECT_GT(parameter.optimal_parameters.table_size, parameter.projected_element_count);
+	EXPECT_GT(parameter.optimal_parameters.number_of_hashes, 0);
+
+	parameter.false_positive_probability = 0.0;
+	EXPECT_FALSE(parameter.valid());
+	parameter.false_positive_probability = 0.01;
+	parameter.projected_element_count    = 0;
+	EXPECT_FALSE(parameter.valid());
+}
+
+TEST(BloomFilterTest, InsertContains) {
+	constexpr uint64_t element_count = 20000;
+	structure::BloomFilter filter(make_parameter(element_count, 0.01));
+	EXPECT_TRUE(filter.valid());
+
+	for (uint64_t key = 0; key < element_count; ++key) { filter.insert(key); }
+	for (uint64_t key = 0; key < element_count; ++key) { ASSERT_TRUE(filter.contains(key)); }
+	EXPECT_LT(measure_fpp(filter, element_count), 0.02);
+}
+
+TEST(BlockedBloomFilterTest, Parameter) {
+	uint64_t block_amount = 0;
+	uint32_t hash_count   = 0;
+	EXPECT_TRUE(structure::BlockedBloomFilter::compute_optimal_parameters(make_parameter(1000000, 0.01), block_amount, hash_count));
+	EXPECT_GE(hash_count, 1);
+	EXPECT_LE(hash_count, structure::BlockedBloomFilter::MAX_HASH_COUNT);
+	EXPECT_LE(structure::BlockedBloomFilter::block_fpp(1000000.0 / block_amount, hash_count), 0.01);
+	EXPECT_GT(structure::BlockedBloomFilter::block_fpp(1000000.0 / (block_amount - 1), hash_count), 0.01);
+
+	// Blocking costs some bits over the classic filter, but not too many
+	const auto bloom_parameter = make_parameter(1000000, 0.01);
+	EXPECT_GT(block_amount * structure::BlockedBloomFilter::BLOCK_BITS, bloom_parameter.optimal_parameters.table_size);
+	EXPECT_LT(block_amount * structure::BlockedBloomFilter::BLOCK_BITS, 2 * bloom_parameter.optimal_parameters.table_size);
+
+	structure::BloomParameter invalid_parameter;
+	invalid_parameter.false_positive_probability = 1.0;
+	EXPECT_FALSE(structure::BlockedBloomFilter::compute_optimal_parameters(invalid_parameter, block_amount, hash_count));
+}
+
+TEST(BlockedBloomFilterTest, InsertContains) {
+	for (double fpp: {0.05, 0.01, 0.001}) {
+		constexpr uint64_t element_count = 50000;
+		structure::BlockedBloomFilter filter(make_parameter(element_count, fpp));
+		EXPECT_TRUE(filter.valid());
+
+		for (uint64_t key = 0; key < element_count; ++key) { filter.insert(key); }
+		EXPECT_EQ(filter.element_count(), element_count);
+		for (uint64_t key = 0; key < element_count; ++key) { ASSERT_TRUE(filter.contains(key)); }
+
+		const double measured_fpp = measure_fpp(filter, element_count);
+		EXPECT_LT(measured_fpp, 2 * fpp);
+		EXPECT_NEAR(measured_fpp, filter.effective_fpp(), fpp);
+
+		filter.clear();
+		EXPECT_EQ(filter.element_count(), 0);
+		const std::vector<uint64_t> key_array{1, 2, 3};
+		EXPECT_EQ(filter.contains_none(key_array.begin(), key_array.end()), key_array.end());
+	}
+}
+
+TEST(BlockedBloomFilterTest, Hash) {
+	// Bits in blocks must be independent of the choice of block
+	constexpr uint64_t element_count = 1 << 18;
+	structure::BlockedBloomFilter filter(make_parameter(element_count, 1e-4));
+	std::mt19937_64 rander;
+	for (uint64_t idx = 0; idx < element_count; ++idx) { filter.insert_hash(rander()); }
+
+	uint64_t positive_amount = 0;
+	for (uint64_t idx = 0; idx < element_count; ++idx) { positive_amount += filter.contains_hash(rander()); }
+	EXPECT_LT(static_cast<double>(positive_amount) / element_count, 2e-4);
+}
+
+TEST(BlockedBloomFilterTest, String) {
+	structure::BlockedBloomFilter filter(make_parameter(1000, 0.01));
+	std::vector<std::string> key_array;
+	for (size_t idx = 0; idx < 1000; ++idx) {
+		key_array.push_back(std::string(idx % 40, 'k') + std::to_string(idx));
+	}
+	filter.insert(key_array.begin(), key_array.end());
+	EXPECT_EQ(filter.contains_all(key_array.begin(), key_array.end()), key_array.end());
+	EXPECT_TRUE(filter.contains(std::string_view{"k1"}));
+	EXPECT_TRUE(filter.contains(key_array[5].data(), key_array[5].size()));
+}
+
+TEST(BlockedBloomFilterTest, ISA) {
+	std::default_random_engine rander;
+	for (uint32_t hash_count = 1; hash_count <= structure::BlockedBloomFilter::MAX_HASH_COUNT; ++hash_count) {
+		structure::detail::Block scalar_block{}, avx2_block{}, avx512_block{};
+		for (size_t idx = 0; idx < 8; ++idx) {
+			const auto hash = static_cast<uint32_t>(rander());
+			structure::detail::scalar::block_insert(scalar_block, hash, hash_count);
+			if (simd::is_isa_supported(simd::ISA::AVX2)) { structure::detail::avx2::block_insert(avx2_block, hash, hash_count); }
+			if (simd::is_isa_supported(simd::ISA::AVX512)) { structure::detail::avx512::block_insert(avx512_block, hash, hash_count); }
+		}
+		EXPECT_LE(std::popcount(scalar_block.word_array[0]), 8);
+		for (size_t idx = hash_count; idx < structure::detail::BLOCK_WORD_AMOUNT; ++idx) {
+			EXPECT_EQ(scalar_block.word_array[idx], 0);
+		}
+		if (simd::is_isa_supported(simd::ISA::AVX2)) {
+			EXPECT_EQ(std::memcmp(&scalar_block, &avx2_block, sizeof(scalar_block)), 0);
+		}
+		if (simd::is_isa_supported(simd::ISA::AVX512)) {
+			EXPECT_EQ(std::memcmp(&scalar_block, &avx512_block, sizeof(scalar_block)), 0);
+		}
+
+		for (size_t idx = 0; idx < 256; ++idx) {
+			const auto hash = static_cast<uint32_t>(rander());
+			const bool res  = structure::detail::scalar::block_contains(scalar_block, hash, hash_count);
+			if (simd::is_isa_supported(simd::ISA::AVX2)) {
+				EXPECT_EQ(structure::detail::avx2::block_contains(scalar_block, hash, hash_count), res);
+			}
+			if (simd::is_isa_supported(simd::ISA::AVX512)) {
+				EXPECT_EQ(structure::detail::avx512::block_contains(scalar_block, hash, hash_count), res);
+			}
+		}
+	}
+}
+
+namespace {
+
+	/// Batch operations agree with those key by key, with windows left partial
+	template<class Filter>
+	void check_batch(Filter &&batch_filter, Filter &&key_filter) {
+		constexpr uint64_t element_count = 1000;
+		std::vector<uint64_t> key_array(element_count);
+		for (uint64_t idx = 0; idx < element_count; ++idx) { key_array[idx] = idx * 7 + 1; }
+
+		batch_filter.insert_batch(std::span<const uint64_t>{key_array});
+		for (uint64_t key: key_array) { key_filter.insert(key); }
+		EXPECT_EQ(batch_filter.element_count(), key_filter.element_count());
+		EXPECT_TRUE(batch_filter == key_filter);
+
+		std::vector<uint64_t> query_array(7 * element_count + 5);
+		for (uint64_t idx = 0; idx < query_array.size(); ++idx) { query_array[idx] = idx; }
+		std::vector<uint64_t> bitmap((query_array.size() + 63) / 64, ~0ULL);
+		const size_t positive_amount = batch_filter.contains_batch(std::span<const uint64_t>{query_array}, bitmap.data());
+
+		size_t expected_amount = 0;
+		for (size_t idx = 0; idx < query_array.size(); ++idx) {
+			const bool res = key_filter.contains(query_array[idx]);
+			expected_amount += res;
+			ASSERT_EQ((bitmap[idx / 64] >> (idx % 64)) & 1, res);
+		}
+		EXPECT_EQ(positive_amount, expected_amount);
+		EXPECT_GE(positive_amount, element_count);
+	}
+
+}
+
+TEST(BloomFilterTest, Batch) {
+	check_batch(structure::BloomFilter(make_parameter(1000, 0.01)), structure::BloomFilter(make_parameter(1000, 0.01)));
+
+	structure::CompressibleBloomFilter batch_filter(make_parameter(1000, 0.01));
+	structure::CompressibleBloomFilter key_filter(make_parameter(1000, 0.01));
+	EXPECT_TRUE(batch_filter.compress(30.0));
+	EXPECT_TRUE(key_filter.compress(30.0));
+	check_batch(std::move(batch_filter), std::move(key_filter));
+
+	const std::vector<std::string> key_array{"alpha", "beta", "gamma", std::string(100, 'x')};
+	structure::BloomFilter string_filter(make_parameter(1000, 0.01));
+	string_filter.insert_batch(std::span<const std::string>{key_array});
+	uint64_t bitmap = 0;
+	EXPECT_EQ(string_filter.contains_batch(std::span<const std::string>{key_array}, &bitmap), key_array.size());
+	EXPECT_EQ(bitmap, 0xF);
+	EXPECT_TRUE(string_filter.contains(std::string_view{"gamma"}));
+}
+
+TEST(BlockedBloomFilterTest, Batch) {
+	check_batch(structure::BlockedBloomFilter(make_parameter(1000, 0.01)), structure::BlockedBloomFilter(make_parameter(1000, 0.01)));
+
+	const std::vector<std::string_view> key_array{"alpha", "beta", "gamma"};
+	structure::BlockedBloomFilter string_filter(make_parameter(1000, 0.01));
+	string_filter.insert_batch(std::span<const std::string_view>{key_array});
+	EXPECT_TRUE(string_filter.contains(std::string_view{"beta"}));
+}
+
+namespace {
+
+	/// Count hashes of keys
+	struct CountingHasher {
+		static inline size_t hash_amount = 0;
+
+		static util::Hash128 hash(const uint8_t *ptr, size_t length, uint64_t seed) {
+			++hash_amount;
+			return util::hash128(ptr, length, seed);
+		}
+	};
+
+}
+
+TEST(BloomFilterTest, Hasher) {
+	structure::BloomFilter<CountingHasher> filter(make_parameter(1000, 0.001));
+	EXPECT_GT(filter.hash_count(), 1);
+
+	// Each key is hashed once regardless of the amount of hashes
+	for (uint64_t key = 0; key < 100; ++key) { filter.insert(key); }
+	EXPECT_EQ(CountingHasher::hash_amount, 100);
+	for (uint64_t key = 0; key < 100; ++key) { EXPECT_TRUE(filter.contains(key)); }
+	EXPECT_EQ(CountingHasher::hash_amount, 200);
+
+	// Strings are hashed by characters
+	filter.insert(std::string("string key"));
+	EXPECT_TRUE(filter.contains(std::string_view{"string key"}));
+}
+
+TEST(BloomFilterTest, Compress) {
+	constexpr uint64_t element_count = 1000;
+	structure::CompressibleBloomFilter filter(make_parameter(element_count, 0.001));
+	for (uint64_t key = 0; key < element_count; ++key) { filter.insert(key); }
+
+	// Compress to less than half, where folded bits wrap around
+	const uint64_t origin_size = filter.size();
+	EXPECT_TRUE(filter.compress(70.0));
+	EXPECT_LT(filter.size(), origin_size / 2);
+	EXPECT_EQ(filter.table_size_, origin_size);
+	for (uint64_t key = 0; key < element_count; ++key) { ASSERT_TRUE(filter.contains(key)); }
+}
+
+TEST(ScalableBloomFilterTest, Grow) {
+	constexpr uint64_t element_count = 1000;
+	constexpr double   fpp           = 0.01;
+	structure::ScalableBloomFilter filter(make_parameter(element_count, fpp));
+	EXPECT_TRUE(filter.valid());
+	EXPECT_EQ(filter.slice_count(), 1);
+
+	// Ten times the projection takes 1 + 2 + 4 + 8 slices of capacity
+	for (uint64_t key = 0; key < 10 * element_count; ++key) { filter.insert(key); }
+	for (uint64_t key = 0; key < 10 * element_count; ++key) { ASSERT_TRUE(filter.contains(key)); }
+	EXPECT_EQ(filter.slice_count(), 4);
+	EXPECT_EQ(filter.element_count(), 10 * element_count);
+	for (size_t i = 1; i < filter.slice_count(); ++i) {
+		EXPECT_GT(filter.slice(i).size(), filter.slice(i - 1).size());
+	}
+
+	// The compound probability keeps below the desired one
+	EXPECT_LT(filter.effective_fpp(), fpp);
+	EXPECT_LT(measure_fpp(filter, 10 * element_count), 1.5 * fpp);
+
+	filter.clear();
+	EXPECT_EQ(filter.slice_count(), 1);
+	EXPECT_EQ(filter.element_count(), 0);
+}
+
+TEST(CountingBloomFilterTest, InsertErase) {
+	constexpr uint64_t element_count = 10000;
+	structure::CountingBloomFilter filter(make_parameter(element_count, 0.01));
+	EXPECT_TRUE(filter.valid());
+
+	for (uint64_t key = 0; key < element_count; ++key) { filter.insert(key); }
+	for (uint64_t key = 0; key < element_count; ++key) { ASSERT_TRUE(filter.contains(key)); }
+	EXPECT_LT(measure_fpp(filter, element_count), 0.02);
+
+	// Erasing half keeps the other half
+	for (uint64_t key = 0; key < element_count; key += 2) { ASSERT_TRUE(filter.erase(key)); }
+	for (uint64_t key = 1; key < element_count; key += 2) { ASSERT_TRUE(filter.contains(key)); }
+	EXPECT_EQ(filter.element_count(), element_count / 2);
+
+	// Keys certainly absent are not erased
+	uint64_t absent_amount = 0;
+	for (uint64_t key = 0; key < element_count; key += 2) {
+		if (!filter.contains(key)) {
+			EXPECT_FALSE(filter.erase(key));
+			++absent_amount;
+		}
+	}
+	EXPECT_GT(absent_amount, element_count / 2 * 9 / 10);
+
+	for (uint64_t key = 1; key < element_count; key += 2) { ASSERT_TRUE(filter.erase(key)); }
+	EXPECT_EQ(filter.element_count(), 0);
+	for (uint64_t key = 0; key < element_count; ++key) { EXPECT_FALSE(filter.contains(key)); }
+}
+
+TEST(CountingBloomFilterTest, Saturate) {
+	structure::CountingBloomFilter filter(make_parameter(100, 0.01));
+	constexpr uint8_t max_counter = structure::CountingBloomFilter<>::MAX_COUNTER;
+
+	for (uint32_t i = 0; i < max_counter + 5; ++i) { filter.insert(42); }
+	EXPECT_EQ(filter.count(42), max_counter);
+
+	// Saturated counters stay, so that the key is never lost
+	for (uint32_t i = 0; i < max_counter + 5; ++i) { EXPECT_TRUE(filter.erase(42)); }
+	EXPECT_TRUE(filter.contains(42));
+	EXPECT_EQ(filter.count(42), max_counter);
+
+	filter.clear();
+	EXPECT_FALSE(filter.contains(42));
+}
+
+TEST(CountingBloomFilterTest, Churn) {
+	constexpr uint64_t window = 2000;
+	structure::CountingBloomFilter filter(make_parameter(window, 0.01));
+
+	// A sliding window of keys, where the probability stays that of the window
+	for (uint64_t key = 0; key < 20 * window; ++key) {
+		filter.insert(key);
+		if (key >= window) { ASSERT_TRUE(filter.erase(key - window)); }
+	}
+	for (uint64_t key = 19 * window; key < 20 * window; ++key) { ASSERT_TRUE(filter.contains(key)); }
+	EXPECT_EQ(filter.element_count(), window);
+
+	uint64_t positive_amount = 0;
+	for (uint64_t key = 0; key < 19 * window; ++key) { positive_amount += filter.contains(key); }
+	EXPECT_LT(static_cast<double>(positive_amount) / (19 * window), 0.03);
+}
+
+namespace {
+
+	/// Hasher of another seed, whose files are not compatible with FastHasher
+	struct OtherSeedHasher {
+		static util::Hash128 hash(const uint8_t *ptr, size_t length, uint64_t seed) {
+			return util::hash128(ptr, length, seed + 1);
+		}
+	};
+
+	/// Path of a temporary file, removed with the object
+	struct TempPath {
+		std::string path;
+
+		explicit TempPath(std::string_view name): path(std::filesystem::temp_directory_path() / name) {}
+
+		~TempPath() {
+			std::filesystem::remove(path);
+		}
+	};
+
+}
+
+TEST(BloomFilterTest, File) {
+	constexpr uint64_t element_count = 20000;
+	const TempPath file("bloom_filter_test.bloom");
+
+	structure::BloomFilter filter(make_parameter(element_count, 0.01));
+	for (uint64_t key = 0; key < element_count; ++key) { filter.insert(key); }
+	ASSERT_TRUE(filter.save(file.path));
+
+	// The table is used in place, aligned to the page
+	structure::BloomFilter<> mapped_filter = structure::BloomFilter<>::open_mapped(file.path);
+	ASSERT_TRUE(mapped_filter.valid());
+	EXPECT_TRUE(mapped_filter.is_mapped());
+	EXPECT_EQ(reinterpret_cast<uintptr_t>(mapped_filter.table()) % sysconf(_SC_PAGESIZE), 0);
+	EXPECT_TRUE(mapped_filter == filter);
+	EXPECT_EQ(mapped_filter.element_count(), element_count);
+	for (uint64_t key = 0; key < element_count; ++key) { ASSERT_TRUE(mapped_filter.contains(key)); }
+	EXPECT_EQ(measure_fpp(mapped_filter, element_count), measure_fpp(filter, element_count));
+
+	std::vector<uint64_t> bitmap((element_count + 63) / 64);
+	EXPECT_EQ(mapped_filter.contains_batch(std::span<const uint64_t>{}, bitmap.data()), 0);
+
+	// Copies share the mapping, and modification copies the table leaving the file untouched
+	structure::BloomFilter<> copied_filter = mapped_filter;
+	EXPECT_EQ(copied_filter.table(), mapped_filter.table());
+	copied_filter.insert(element_count);
+	EXPECT_FALSE(copied_filter.is_mapped());
+	EXPECT_TRUE(mapped_filter.is_mapped());
+	EXPECT_TRUE(structure::BloomFilter<>::open_mapped(file.path) == filter);
+
+	// Saving over a mapped file leaves the old mapping valid
+	ASSERT_TRUE(copied_filter.save(file.path));
+	EXPECT_TRUE(mapped_filter == filter);
+	EXPECT_TRUE(structure::BloomFilter<>::open_mapped(file.path) == copied_filter);
+}
+
+TEST(BloomFilterTest, FileCorrupt) {
+	const TempPath file("bloom_filter_corrupt_test.bloom");
+
+	structure::BloomFilter filter(make_parameter(1000, 0.01));
+	for (uint64_t key = 0; key < 1000; ++key) { filter.insert(key); }
+	ASSERT_TRUE(filter.save(file.path));
+
+	const auto corrupt = [&](size_t offset) {
+		ASSERT_TRUE(filter.save(file.path));
+		std::fstream stream(file.path, std::ios::in | std::ios::out | std::ios::binary);
+		stream.seekg(static_cast<std::streamoff>(offset));
+		const char byte = static_cast<char>(stream.get() ^ 0x01);
+		stream.seekp(static_cast<std::streamoff>(offset));
+		stream.put(byte);
+	};
+
+	// A flipped bit in the header or in the table is detected
+	corrupt(offsetof(structure::BloomFileHeader, inserted_element_count));
+	EXPECT_FALSE(structure::BloomFilter<>::open_mapped(file.path).valid());
+	corrupt(sysconf(_SC_PAGESIZE) + 7);
+	EXPECT_FALSE(structure::BloomFilter<>::open_mapped(file.path).valid());
+	EXPECT_TRUE(structure::BloomFilter<>::open_mapped(file.path, false).valid());
+
+	// Files written with another hasher are rejected
+	ASSERT_TRUE(filter.save(file.path));
+	EXPECT_FALSE(structure::BloomFilter<OtherSeedHasher>::open_mapped(file.path).valid());
+	EXPECT_FALSE(structure::BloomFilter<>::open_mapped(file.path + ".absent").valid());
+
+	// Compressed filters keep a history of sizes, which is not saved
+	structure::CompressibleBloomFilter compressible_filter(make_parameter(1000, 0.01));
+	ASSERT_TRUE(compressible_filter.compress(30.0));
+	EXPECT_FALSE(compressible_filter.save(file.path));
+}
+
+TEST(BloomFilterTest, FileCompressible) {
+	constexpr uint64_t element_count = 10000;
+	const TempPath file("bloom_filter_compressible_test.bloom");
+
+	structure::BloomFilter filter(make_parameter(element_count, 0.01));
+	for (uint64_t key = 0; key < element_count; ++key) { filter.insert(key); }
+	ASSERT_TRUE(filter.save(file.path));
+
+	// Even uncompressed, its indices differ from those of a loaded BloomFilter, so that it is not saved
+	structure::CompressibleBloomFilter compressible_filter(make_parameter(element_count, 0.01));
+	for (uint64_t key = 0; key < element_count; ++key) { compressible_filter.insert(key + element_count); }
+	EXPECT_FALSE(compressible_filter.save(file.path));
+
+	// The file saved before is left untouched
+	structure::BloomFilter<> mapped_filter = structure::BloomFilter<>::open_mapped(file.path);
+	ASSERT_TRUE(mapped_filter.valid());
+	EXPECT_TRUE(mapped_filter == filter);
+	for (uint64_t key = 0; key < element_count; ++key) { ASSERT_TRUE(mapped_filter.contains(key)); }
+}
+
+TEST(ConcurrentBloomFilterTest, InsertContains) {
+	constexpr uint64_t element_count = 20000;
+	const structure::BloomParameter parameter = make_parameter(element_count, 0.01);
+	structure::ConcurrentBloomFilter filter(parameter);
+	structure::BloomFilter classic_filter(parameter);
+	EXPECT_TRUE(filter.valid());
+
+	for (uint64_t key = 0; key < element_count; ++key) {
+		filter.insert(key);
+		classic_filter.insert(key);
+	}
+	EXPECT_EQ(filter.element_count(), element_count);
+
+	// Bits agree with those of the classic filter
+	for (uint64_t key = 0; key < 2 * element_count; ++key) { ASSERT_EQ(filter.contains(key), classic_filter.contains(key)); }
+	EXPECT_LT(measure_fpp(filter, element_count), 0.02);
+
+	filter.clear();
+	EXPECT_EQ(filter.element_count(), 0);
+	EXPECT_FALSE(filter.contains(0));
+}
+
+TEST(ConcurrentBloomFilterTest, Concurrent) {
+	constexpr uint64_t thread_amount = 4;
+	constexpr uint64_t element_count = 40000;
+	structure::ConcurrentBloomFilter filter(make_parameter(2 * element_count, 0.01));
+
+	// Keys inserted before stay visible to readers all along
+	for (uint64_t key = element_count; key < 2 * element_count; ++key) { filter.insert(key); }
+
+	std::atomic<uint64_t> miss_amount{0};
+	std::vector<std::unique_ptr<thread::CPUBindThread>> thread_array;
+	for (uint64_t thread_idx = 0; thread_idx < thread_amount; ++thread_idx) {
+		thread_array.emplace_back(std::make_unique<thread::CPUBindThread>([&filter, thread_idx] {
+			for (uint64_t key = thread_idx; key < element_count; key += thread_amount) { filter.insert(key); }
+		}));
+		thread_array.emplace_back(std::make_unique<thread::CPUBindThread>([&filter, &miss_amount, thread_idx] {
+			for (uint64_t key = element_count + thread_idx; key < 2 * element_count; key += thread_amount) {
+				miss_amount += !filter.contains(key);
+			}
+		}));
+	}
+	for (auto &thread_ptr: thread_array) { thread_ptr->get_origin_thread().join(); }
+
+	EXPECT_EQ(miss_amount.load(), 0);
+	EXPECT_EQ(filter.element_count(), 2 * element_count);
+	for (uint64_t key = 0; key < 2 * element_count; ++key) { ASSERT_TRUE(filter.contains(key)); }
+}
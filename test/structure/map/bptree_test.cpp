@@ -0,0 +1,207 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <structure/map/bptree.h>
+
+using namespace algorithm;
+
+namespace {
+
+	/// Tiny nodes of 5 pairs and 5 children, which grow tall trees from a few keys
+	using SmallTree = structure::BPlusTree<uint32_t, uint32_t, memory::CACHE_LINE_SIZE>;
+
+	uint32_t scatter(uint32_t idx) {
+		return idx * 2654435761U;
+	}
+
+	/// The tree holds the same pairs as the map, in order along leaves both ways
+	template<class Tree, class Map>
+	void check_equal(Tree &tree, const Map &expected) {
+		ASSERT_EQ(tree.size(), expected.size());
+		ASSERT_EQ(tree.empty(), expected.empty());
+
+		auto iter = tree.begin();
+		for (const auto &[key, value]: expected) {
+			ASSERT_NE(iter, tree.end());
+			ASSERT_EQ(iter.key(), key);
+			ASSERT_EQ(iter.value(), value);
+			++iter;
+		}
+		EXPECT_EQ(iter, tree.end());
+
+		auto reverse_iter = tree.last();
+		for (auto map_iter = expected.rbegin(); map_iter != expected.rend(); ++map_iter) {
+			ASSERT_NE(reverse_iter, tree.end());
+			ASSERT_EQ(reverse_iter.key(), map_iter->first);
+			--reverse_iter;
+		}
+		EXPECT_EQ(reverse_iter, tree.end());
+	}
+
+}
+
+TEST(BPlusTreeTest, Layout) {
+	using Tree = structure::BPlusTree<uint64_t, uint64_t>;
+	EXPECT_EQ(Tree::LEAF_CAPACITY, 30);
+	EXPECT_EQ(Tree::INNER_CAPACITY, 31);
+	EXPECT_LE(sizeof(Tree::LeafNodeType), 8 * memory::CACHE_LINE_SIZE);
+	EXPECT_LE(sizeof(Tree::InnerNodeType), 8 * memory::CACHE_LINE_SIZE);
+
+	EXPECT_EQ(SmallTree::LEAF_CAPACITY, 5);
+	EXPECT_EQ(SmallTree::INNER_CAPACITY, 4);
+	EXPECT_LE(sizeof(SmallTree::LeafNodeType), memory::CACHE_LINE_SIZE);
+	EXPECT_LE(sizeof(SmallTree::InnerNodeType), memory::CACHE_LINE_SIZE);
+}
+
+TEST(BPlusTreeTest, InsertFind) {
+	SmallTree tree;
+	std::map<uint32_t, uint32_t> expected;
+	for (uint32_t idx = 0; idx < 20000; ++idx) {
+		const uint32_t key = scatter(idx) % 30000;
+		EXPECT_EQ(tree.insert(key, idx), expected.emplace(key, idx).second);
+	}
+	EXPECT_GT(tree.height(), 4);
+	check_equal(tree, expected);
+
+	for (uint32_t key = 0; key < 30000; ++key) {
+		const auto iter = tree.find(key);
+		if (expected.contains(key)) {
+			ASSERT_NE(iter, tree.end());
+			ASSERT_EQ(iter.value(), expected[key]);
+		}
+		else {
+			ASSERT_EQ(iter, tree.end());
+		}
+		ASSERT_EQ(tree.lower_bound(key).key(), expected.lower_bound(key)->first);
+	}
+
+	// Values are updated in place through iterators
+	tree.find(expected.begin()->first).value() = 7;
+	EXPECT_EQ(tree.begin().value(), 7);
+}
+
+TEST(BPlusTreeTest, Erase) {
+	SmallTree tree;
+	std::map<uint32_t, uint32_t> expected;
+	for (uint32_t idx = 0; idx < 20000; ++idx) {
+		tree.insert(scatter(idx), idx);
+		expected.emplace(scatter(idx), idx);
+	}
+
+	// Erase in scattered order, with absent keys in between
+	for (uint32_t idx = 0; idx < 20000; idx += 2) {
+		ASSERT_TRUE(tree.erase(scatter(idx)));
+		ASSERT_FALSE(tree.erase(scatter(idx)));
+		expected.erase(scatter(idx));
+	}
+	check_equal(tree, expected);
+
+	// Interleave insertion and erasure, then empty the tree
+	for (uint32_t idx = 0; idx < 20000; ++idx) {
+		if (idx % 3 == 0) {
+			EXPECT_EQ(tree.insert(scatter(idx), idx), expected.emplace(scatter(idx), idx).second);
+		}
+		else {
+			EXPECT_EQ(tree.erase(scatter(idx)), expected.erase(scatter(idx)) == 1);
+		}
+	}
+	check_equal(tree, expected);
+
+	for (const auto &[key, value]: expected) { ASSERT_TRUE(tree.erase(key)); }
+	EXPECT_TRUE(tree.empty());
+	EXPECT_EQ(tree.height(), 0);
+	EXPECT_EQ(tree.begin(), tree.end());
+
+	EXPECT_TRUE(tree.insert(1, 1));
+	EXPECT_TRUE(tree.contains(1));
+}
+
+TEST(BPlusTreeTest, BulkLoad) {
+	for (uint32_t amount: {0, 1, 4, 5, 6, 11, 1000, 30001}) {
+		for (double fill_factor: {1.0, 0.7, 0.0}) {
+			std::vector<uint32_t> key_array, value_array;
+			std::map<uint32_t, uint32_t> expected;
+			for (uint32_t idx = 0; idx < amount; ++idx) {
+				key_array.push_back(3 * idx);
+				value_array.push_back(idx);
+				expected.emplace(3 * idx, idx);
+			}
+
+			SmallTree tree;
+			tree.insert(1, 1);
+			ASSERT_TRUE(tree.bulk_load(key_array, value_array, fill_factor));
+			check_equal(tree, expected);
+
+			// Loaded nodes take later insertion and erasure
+			for (uint32_t idx = 0; idx < amount; idx += 3) {
+				EXPECT_TRUE(tree.insert(3 * idx + 1, idx));
+				expected.emplace(3 * idx + 1, idx);
+			}
+			for (uint32_t idx = 0; idx < amount; idx += 2) {
+				EXPECT_TRUE(tree.erase(3 * idx));
+				expected.erase(3 * idx);
+			}
+			check_equal(tree, expected);
+		}
+	}
+
+	// Invalid input is rejected without change
+	SmallTree tree;
+	tree.insert(1, 1);
+	const std::vector<uint32_t> unsorted_array{1, 3, 3, 4};
+	EXPECT_FALSE(tree.bulk_load(unsorted_array, unsorted_array));
+	EXPECT_FALSE(tree.bulk_load(unsorted_array, std::span<const uint32_t>{unsorted_array.data(), 2}));
+	EXPECT_EQ(tree.size(), 1);
+}
+
+TEST(BPlusTreeTest, Scan) {
+	std::vector<uint64_t> key_array;
+	for (uint64_t key = 0; key < 100000; key += 2) { key_array.push_back(key); }
+
+	structure::BPlusTree<uint64_t, uint64_t> tree;
+	ASSERT_TRUE(tree.bulk_load(key_array, key_array));
+
+	std::vector<uint64_t> visited_array;
+	const size_t amount = tree.scan(1001, 2001, [&visited_array](uint64_t key, uint64_t value) {
+		EXPECT_EQ(key, value);
+		visited_array.push_back(key);
+	});
+	EXPECT_EQ(amount, 500);
+	ASSERT_EQ(visited_array.size(), 500);
+	EXPECT_EQ(visited_array.front(), 1002);
+	EXPECT_EQ(visited_array.back(), 2000);
+
+	EXPECT_EQ(tree.scan(0, 100000, [](uint64_t, uint64_t) {}), tree.size());
+	EXPECT_EQ(tree.scan(99999, 200000, [](uint64_t, uint64_t) {}), 0);
+	EXPECT_EQ(tree.lower_bound(99999), tree.end());
+}
+
+TEST(BPlusTreeTest, StringValue) {
+	// Values are moved between nodes, with a custom order of keys
+	structure::BPlusTree<uint32_t, std::string, memory::CACHE_LINE_SIZE * 8, std::greater<uint32_t>,
+	                     allocator::ReserveAllocator<uint32_t>> tree;
+	std::map<uint32_t, std::string, std::greater<uint32_t>> expected;
+	for (uint32_t idx = 0; idx < 5000; ++idx) {
+		const uint32_t key = scatter(idx) % 4000;
+		const std::string value = "value of a key long enough to be allocated " + std::to_string(key);
+		EXPECT_EQ(tree.insert(key, value), expected.emplace(key, value).second);
+	}
+	for (uint32_t key = 0; key < 4000; key += 3) {
+		EXPECT_EQ(tree.erase(key), expected.erase(key) == 1);
+	}
+	check_equal(tree, expected);
+
+	structure::BPlusTree<uint32_t, std::string, memory::CACHE_LINE_SIZE * 8, std::greater<uint32_t>,
+	                     allocator::ReserveAllocator<uint32_t>> moved_tree = std::move(tree);
+	EXPECT_TRUE(tree.empty());
+	check_equal(moved_tree, expected);
+}
@@ -0,0 +1,157 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <structure/map/bloom_filter.h>
+#include <structure/map/cuckoo_filter.h>
+#include <structure/map/binary_fuse_filter.h>
+
+using namespace algorithm;
+
+namespace {
+
+	/// Scattered keys, of which [0, element_count) are inserted and the rest are not
+	std::vector<uint64_t> make_key_array(uint64_t size) {
+		std::vector<uint64_t> key_array(size);
+		for (uint64_t idx = 0; idx < size; ++idx) { key_array[idx] = idx * 0x9E3779B97F4A7C15ULL + 1; }
+		return key_array;
+	}
+
+	/// The ratio of positives among keys never inserted
+	template<class Filter>
+	double measure_fpp(const Filter &filter, std::span<const uint64_t> absent_keys) {
+		uint64_t positive_amount = 0;
+		for (uint64_t key: absent_keys) { positive_amount += filter.contains(key); }
+		return static_cast<double>(positive_amount) / absent_keys.size();
+	}
+
+	/// Batch lookups agree with those key by key, with windows left partial
+	template<class Filter>
+	void check_batch(const Filter &filter, std::span<const uint64_t> key_array) {
+		std::vector<uint64_t> bitmap((key_array.size() + 63) / 64, ~0ULL);
+		const size_t positive_amount = filter.contains_batch(key_array, bitmap.data());
+
+		size_t expected_amount = 0;
+		for (size_t idx = 0; idx < key_array.size(); ++idx) {
+			const bool res = filter.contains(key_array[idx]);
+			expected_amount += res;
+			ASSERT_EQ((bitmap[idx / 64] >> (idx % 64)) & 1, res);
+		}
+		EXPECT_EQ(positive_amount, expected_amount);
+	}
+
+}
+
+TEST(CuckooFilterTest, InsertContains) {
+	constexpr uint64_t element_count = 100000;
+	const std::vector<uint64_t> key_array = make_key_array(2 * element_count);
+	const std::span<const uint64_t> inserted{key_array.data(), element_count};
+	const std::span<const uint64_t> absent{key_array.data() + element_count, element_count};
+
+	structure::CuckooFilter<uint16_t> filter(element_count);
+	EXPECT_TRUE(filter.valid());
+	for (uint64_t key: inserted) { ASSERT_TRUE(filter.insert(key)); }
+	for (uint64_t key: inserted) { ASSERT_TRUE(filter.contains(key)); }
+	EXPECT_EQ(filter.element_count(), element_count);
+	EXPECT_GT(filter.load_factor(), 0.9);
+
+	// 8 slots of 16-bit fingerprints are probed
+	EXPECT_LT(measure_fpp(filter, absent), 2.0 * filter.effective_fpp());
+	// Smaller than the classic filter of the same probability
+	structure::BloomParameter parameter;
+	parameter.projected_element_count    = element_count;
+	parameter.false_positive_probability = filter.effective_fpp();
+	parameter.compute_optimal_parameters();
+	EXPECT_LT(filter.size(), parameter.optimal_parameters.table_size);
+
+	check_batch(filter, std::span<const uint64_t>{key_array});
+}
+
+TEST(CuckooFilterTest, Erase) {
+	constexpr uint64_t element_count = 10000;
+	const std::vector<uint64_t> key_array = make_key_array(element_count);
+
+	structure::CuckooFilter<uint8_t> filter(element_count);
+	for (uint64_t key: key_array) { ASSERT_TRUE(filter.insert(key)); }
+
+	// Erasing half keeps the other half
+	for (uint64_t idx = 0; idx < element_count; idx += 2) { ASSERT_TRUE(filter.erase(key_array[idx])); }
+	for (uint64_t idx = 1; idx < element_count; idx += 2) { ASSERT_TRUE(filter.contains(key_array[idx])); }
+	EXPECT_EQ(filter.element_count(), element_count / 2);
+
+	for (uint64_t idx = 1; idx < element_count; idx += 2) { ASSERT_TRUE(filter.erase(key_array[idx])); }
+	EXPECT_EQ(filter.element_count(), 0);
+	for (uint64_t key: key_array) { EXPECT_FALSE(filter.contains(key)); }
+	EXPECT_FALSE(filter.erase(key_array[0]));
+
+	// Strings are hashed by characters
+	EXPECT_TRUE(filter.insert(std::string("string key")));
+	EXPECT_TRUE(filter.contains(std::string_view{"string key"}));
+	EXPECT_TRUE(filter.erase(std::string_view{"string key"}));
+}
+
+TEST(CuckooFilterTest, Full) {
+	constexpr uint64_t element_count = 1000;
+	const std::vector<uint64_t> key_array = make_key_array(4 * element_count);
+
+	// Keys beyond the capacity end up rejected, while all accepted ones stay
+	structure::CuckooFilter<uint16_t> filter(element_count);
+	uint64_t accepted_amount = 0;
+	while (accepted_amount < key_array.size() && filter.insert(key_array[accepted_amount])) { ++accepted_amount; }
+	EXPECT_LT(accepted_amount, key_array.size());
+	EXPECT_GE(accepted_amount, element_count);
+	EXPECT_FALSE(filter.insert(key_array.back()));
+	for (uint64_t idx = 0; idx < accepted_amount; ++idx) { ASSERT_TRUE(filter.contains(key_array[idx])); }
+
+	// Erasing tries to take the victim back, which is never lost
+	ASSERT_TRUE(filter.erase(key_array[0]));
+	EXPECT_EQ(filter.element_count(), accepted_amount - 1);
+	for (uint64_t idx = 1; idx < accepted_amount; ++idx) { ASSERT_TRUE(filter.contains(key_array[idx])); }
+}
+
+template<typename Fingerprint>
+void check_binary_fuse(uint64_t element_count) {
+	const std::vector<uint64_t> key_array = make_key_array(2 * element_count);
+	const std::span<const uint64_t> inserted{key_array.data(), element_count};
+	const std::span<const uint64_t> absent{key_array.data() + element_count, element_count};
+
+	structure::BinaryFuseFilter<Fingerprint> filter(inserted);
+	ASSERT_TRUE(filter.valid());
+	EXPECT_EQ(filter.element_count(), element_count);
+	for (uint64_t key: inserted) { ASSERT_TRUE(filter.contains(key)); }
+	check_batch(filter, std::span<const uint64_t>{key_array});
+	if (element_count < 100000) { return; }
+
+	EXPECT_LT(measure_fpp(filter, absent), 1.5 * filter.effective_fpp());
+	// Smaller than the classic filter of the same probability by 15%, which reaches 22% beyond a million keys
+	structure::BloomParameter parameter;
+	parameter.projected_element_count    = element_count;
+	parameter.false_positive_probability = filter.effective_fpp();
+	parameter.compute_optimal_parameters();
+	EXPECT_LT(filter.size(), 0.85 * parameter.optimal_parameters.table_size);
+}
+
+TEST(BinaryFuseFilterTest, Fuse8) {
+	for (uint64_t element_count: {0, 1, 2, 10, 1000, 100000}) { check_binary_fuse<uint8_t>(element_count); }
+}
+
+TEST(BinaryFuseFilterTest, Fuse16) {
+	for (uint64_t element_count: {0, 1, 2, 10, 1000, 100000}) { check_binary_fuse<uint16_t>(element_count); }
+}
+
+TEST(BinaryFuseFilterTest, Duplicate) {
+	std::vector<std::string> key_array;
+	for (uint32_t idx = 0; idx < 1000; ++idx) { key_array.push_back("key" + std::to_string(idx % 300)); }
+
+	structure::BinaryFuseFilter<uint16_t> filter(std::span<const std::string>{key_array});
+	ASSERT_TRUE(filter.valid());
+	EXPECT_EQ(filter.element_count(), 300);
+	for (const std::string &key: key_array) { ASSERT_TRUE(filter.contains(key)); }
+}
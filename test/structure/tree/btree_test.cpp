@@ -0,0 +1,34 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <cstdint>
+#include <set>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <structure/tree/btree.h>
+
+using namespace algorithm;
+
+TEST(BTreeTest, Insert) {
+	structure::BTree<uint32_t> tree;
+	std::set<uint32_t> expected;
+
+	// Scattered values with duplicates, which split nodes at all levels
+	for (uint32_t i = 0; i < 20000; ++i) {
+		const uint32_t value = (i * 2654435761U) % 15000;
+		EXPECT_EQ(tree.insert(value), expected.insert(value).second);
+	}
+	EXPECT_EQ(tree.size(), expected.size());
+	for (uint32_t value = 0; value < 15000; ++value) { ASSERT_EQ(tree.contains(value), expected.contains(value)); }
+
+	std::vector<uint32_t> value_array;
+	tree.for_each([&value_array](uint32_t value) { value_array.push_back(value); });
+	EXPECT_TRUE(std::equal(value_array.begin(), value_array.end(), expected.begin(), expected.end()));
+
+	tree.clear();
+	EXPECT_TRUE(tree.empty());
+	EXPECT_FALSE(tree.contains(0));
+}
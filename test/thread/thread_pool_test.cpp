@@ -0,0 +1,129 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+#include <atomic>
+#include <numeric>
+#include <set>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <thread/thread_pool.h>
+
+using namespace algorithm;
+
+TEST(WorkStealDequeTest, WorkStealDequeTestOwner) {
+	thread::WorkStealDeque<size_t> deque(4);
+	for (size_t i = 0; i < 100; ++i) {
+		deque.push(i);
+	}
+	EXPECT_EQ(deque.size(), 100);
+
+	// The owner pops in LIFO order, while thieves steal in FIFO order
+	EXPECT_EQ(deque.steal().value(), 0);
+	for (size_t i = 100; i > 1; --i) {
+		EXPECT_EQ(deque.pop().value(), i - 1);
+	}
+	EXPECT_FALSE(deque.pop().has_value());
+	EXPECT_FALSE(deque.steal().has_value());
+}
+
+TEST(WorkStealDequeTest, WorkStealDequeTestSteal) {
+	constexpr size_t ELEMENT_AMOUNT = 100000;
+	constexpr size_t THIEF_AMOUNT   = 3;
+
+	thread::WorkStealDeque<size_t> deque;
+	std::vector<std::vector<size_t>> result_array(THIEF_AMOUNT + 1);
+	std::atomic<bool> finish = false;
+
+	std::vector<std::thread> thief_array;
+	for (size_t thief_idx = 0; thief_idx < THIEF_AMOUNT; ++thief_idx) {
+		thief_array.emplace_back([&, thief_idx] {
+			while (!finish.load() || !deque.empty()) {
+				if (auto value = deque.steal()) {
+					result_array[thief_idx].push_back(*value);
+				}
+			}
+		});
+	}
+
+	for (size_t i = 0; i < ELEMENT_AMOUNT; ++i) {
+		deque.push(i);
+		if (i % 3 == 0) {
+			if (auto value = deque.pop()) {
+				result_array[THIEF_AMOUNT].push_back(*value);
+			}
+		}
+	}
+	while (auto value = deque.pop()) {
+		result_array[THIEF_AMOUNT].push_back(*value);
+	}
+	finish = true;
+	for (auto &thief: thief_array) { thief.join(); }
+
+	// Each element is taken exactly once
+	std::vector<size_t> merge_array;
+	for (auto &result: result_array) {
+		merge_array.insert(merge_array.end(), result.begin(), result.end());
+	}
+	std::sort(merge_array.begin(), merge_array.end());
+	ASSERT_EQ(merge_array.size(), ELEMENT_AMOUNT);
+	for (size_t i = 0; i < ELEMENT_AMOUNT; ++i) {
+		EXPECT_EQ(merge_array[i], i);
+	}
+}
+
+TEST(ThreadPoolTest, ThreadPoolTestSubmit) {
+	thread::ThreadPool pool(4);
+
+	std::vector<std::future<size_t>> future_array;
+	for (size_t i = 0; i < 100; ++i) {
+		future_array.emplace_back(pool.submit([i] { return i * i; }));
+	}
+	for (size_t i = 0; i < 100; ++i) {
+		EXPECT_EQ(future_array[i].get(), i * i);
+	}
+}
+
+TEST(ThreadPoolTest, ThreadPoolTestWaitGroup) {
+	thread::ThreadPool pool(4);
+
+	std::atomic<size_t> counter = 0;
+	thread::WaitGroup group;
+	for (size_t i = 0; i < 1000; ++i) {
+		pool.submit(group, [&counter] { counter.fetch_add(1); });
+	}
+	pool.wait(group);
+	EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST(ThreadPoolTest, ThreadPoolTestParallelFor) {
+	constexpr size_t ELEMENT_AMOUNT = 100000;
+
+	thread::ThreadPool pool(4);
+	std::vector<size_t> value_array(ELEMENT_AMOUNT, 0);
+
+	pool.parallel_for(0, ELEMENT_AMOUNT, [&value_array](size_t idx) { value_array[idx] = idx; });
+	for (size_t i = 0; i < ELEMENT_AMOUNT; ++i) {
+		EXPECT_EQ(value_array[i], i);
+	}
+
+	std::atomic<size_t> sum = 0;
+	pool.parallel_for(0, ELEMENT_AMOUNT, [&](size_t start, size_t end) {
+		sum.fetch_add(std::accumulate(value_array.begin() + start, value_array.begin() + end, size_t(0)));
+	}, 1000);
+	EXPECT_EQ(sum.load(), ELEMENT_AMOUNT * (ELEMENT_AMOUNT - 1) / 2);
+}
+
+TEST(ThreadPoolTest, ThreadPoolTestNested) {
+	thread::ThreadPool pool(2);
+
+	std::atomic<size_t> counter = 0;
+	// Workers waiting for inner loops execute pending tasks instead of blocking
+	pool.parallel_for(0, 16, [&](size_t) {
+		pool.parallel_for(0, 100, [&](size_t) { counter.fetch_add(1); }, 10);
+	}, 1);
+	EXPECT_EQ(counter.load(), 1600);
+}
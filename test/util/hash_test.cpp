@@ -0,0 +1,110 @@
+/*
+ * @author: BL-GS
+ * @date:   2026/10/18
+ */
+
+
+#include <bit>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include <util/hash.h>
+
+using namespace algorithm;
+
+namespace {
+
+	std::vector<uint8_t> make_bytes(size_t size) {
+		std::mt19937_64 rander(size);
+		std::vector<uint8_t> bytes(size);
+		for (auto &byte: bytes) { byte = static_cast<uint8_t>(rander()); }
+		return bytes;
+	}
+
+}
+
+TEST(HashTest, Deterministic) {
+	const std::vector<uint8_t> bytes = make_bytes(3000);
+	for (size_t length: {0, 1, 3, 4, 7, 8, 15, 16, 17, 100, 256, 257, 1024, 1025, 3000}) {
+		EXPECT_EQ(util::hash64(bytes.data(), length), util::hash64(bytes.data(), length));
+		EXPECT_EQ(util::hash128(bytes.data(), length, 7), util::hash128(bytes.data(), length, 7));
+		EXPECT_NE(util::hash64(bytes.data(), length, 1), util::hash64(bytes.data(), length, 2));
+		EXPECT_NE(util::hash128(bytes.data(), length, 1), util::hash128(bytes.data(), length, 2));
+	}
+}
+
+TEST(HashTest, Distinct) {
+	// Prefixes of all lengths, which cover every path of reading
+	const std::vector<uint8_t> bytes = make_bytes(2500);
+	std::set<uint64_t> hash64_set, low_set, high_set;
+	for (size_t length = 0; length <= bytes.size(); ++length) {
+		hash64_set.insert(util::hash64(bytes.data(), length));
+		const util::Hash128 hash = util::hash128(bytes.data(), length);
+		low_set.insert(hash.low);
+		high_set.insert(hash.high);
+		EXPECT_NE(hash.low, hash.high);
+	}
+	EXPECT_EQ(hash64_set.size(), bytes.size() + 1);
+	EXPECT_EQ(low_set.size(), bytes.size() + 1);
+	EXPECT_EQ(high_set.size(), bytes.size() + 1);
+}
+
+TEST(HashTest, Avalanche) {
+	for (size_t length: {8, 13, 64, 200, 2000}) {
+		std::vector<uint8_t> bytes = make_bytes(length);
+		const uint64_t origin_hash = util::hash64(bytes.data(), length);
+		const util::Hash128 origin_hash128 = util::hash128(bytes.data(), length);
+
+		double flip_sum = 0, flip_sum128 = 0;
+		for (size_t bit = 0; bit < length * 8; ++bit) {
+			bytes[bit / 8] ^= static_cast<uint8_t>(1 << (bit % 8));
+			flip_sum += std::popcount(util::hash64(bytes.data(), length) ^ origin_hash);
+			const util::Hash128 hash128 = util::hash128(bytes.data(), length);
+			flip_sum128 += std::popcount(hash128.low ^ origin_hash128.low) + std::popcount(hash128.high ^ origin_hash128.high);
+			bytes[bit / 8] ^= static_cast<uint8_t>(1 << (bit % 8));
+		}
+		EXPECT_NEAR(flip_sum / (length * 8), 32.0, 2.0) << length;
+		EXPECT_NEAR(flip_sum128 / (length * 8), 64.0, 3.0) << length;
+	}
+}
+
+TEST(HashTest, ISA) {
+	for (size_t length: {257, 1024, 1025, 5000}) {
+		const std::vector<uint8_t> bytes = make_bytes(length);
+		uint64_t scalar_acc[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+		util::detail::hash_long_impl(scalar_acc, bytes.data(), length, util::detail::HASH_SECRET,
+		                             util::detail::scalar::accumulate, util::detail::scalar::scramble);
+		if (simd::is_isa_supported(simd::ISA::AVX2)) {
+			uint64_t acc[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+			util::detail::hash_long_impl(acc, bytes.data(), length, util::detail::HASH_SECRET,
+			                             util::detail::avx2::accumulate, util::detail::avx2::scramble);
+			EXPECT_TRUE(std::equal(acc, acc + 8, scalar_acc));
+		}
+		if (simd::is_isa_supported(simd::ISA::AVX512)) {
+			uint64_t acc[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+			util::detail::hash_long_impl(acc, bytes.data(), length, util::detail::HASH_SECRET,
+			                             util::detail::avx512::accumulate, util::detail::avx512::scramble);
+			EXPECT_TRUE(std::equal(acc, acc + 8, scalar_acc));
+		}
+	}
+}
+
+TEST(HashTest, DoubleHash) {
+	const util::Hash128 hash = util::hash128("key", 3);
+	std::set<uint64_t> value_set;
+	for (uint32_t i = 0; i < 64; ++i) { value_set.insert(util::double_hash(hash, i) % 64); }
+	// An odd step visits every residue modulo a power of two
+	EXPECT_EQ(value_set.size(), 64);
+
+	EXPECT_EQ(util::fast_range(0, 1000), 0);
+	EXPECT_EQ(util::fast_range(~0ULL, 1000), 999);
+	// Ranges beyond 32 bits are addressed
+	constexpr uint64_t range = 1ULL << 40;
+	uint64_t max_index = 0;
+	for (uint32_t i = 0; i < 64; ++i) { max_index = std::max(max_index, util::fast_range(util::double_hash(hash, i), range)); }
+	EXPECT_GT(max_index, 1ULL << 32);
+	EXPECT_LT(max_index, range);
+}